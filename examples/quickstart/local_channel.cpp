@@ -107,7 +107,8 @@ void pingpong2()
 ///////////////////////////////////////////////////////////////////////////////
 void dispatch_work()
 {
-    hpx::lcos::local::channel<int> jobs;
+    // the jobs are sent from exactly one thread to exactly one other thread
+    hpx::lcos::local::spsc_channel<int> jobs(4);
     hpx::lcos::local::channel<> done;
 
     hpx::apply(
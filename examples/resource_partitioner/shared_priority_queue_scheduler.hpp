@@ -721,6 +721,7 @@ namespace example {
 
             using threads::thread_schedule_hint_mode;
 
+            data.schedulehint = resolve_affinity_hint(data.schedulehint);
             switch (data.schedulehint.mode) {
             case thread_schedule_hint_mode::thread_schedule_hint_mode_none:
             {
@@ -923,6 +924,7 @@ namespace example {
 
             using threads::thread_schedule_hint_mode;
 
+            schedulehint = resolve_affinity_hint(schedulehint);
             switch (schedulehint.mode) {
             case thread_schedule_hint_mode::thread_schedule_hint_mode_none:
             {
@@ -1025,6 +1027,7 @@ namespace example {
 
             using threads::thread_schedule_hint_mode;
 
+            schedulehint = resolve_affinity_hint(schedulehint);
             switch (schedulehint.mode) {
             case thread_schedule_hint_mode::thread_schedule_hint_mode_none:
             {
@@ -1117,6 +1120,83 @@ namespace example {
             thrd->get_queue<thread_queue_type>().destroy_thread(thrd, busy_count);
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Queries the number of thread objects reused from (or not found in)
+        // the per-worker thread caches.
+        std::int64_t get_thread_cache_hits(std::size_t num_thread, bool reset) override
+        {
+            std::int64_t count = 0;
+
+            if (num_thread == std::size_t(-1))
+            {
+                for (std::size_t d = 0; d < num_domains_; ++d) {
+                    for (auto &queue : lp_queues_[d].queues_) {
+                        count += queue->get_thread_cache_hits(reset);
+                    }
+
+                    for (auto &queue : np_queues_[d].queues_) {
+                        count += queue->get_thread_cache_hits(reset);
+                    }
+
+                    for (auto &queue : hp_queues_[d].queues_) {
+                        count += queue->get_thread_cache_hits(reset);
+                    }
+                }
+
+                return count;
+            }
+
+            std::size_t domain_num = d_lookup_[num_thread];
+
+            count += lp_queues_[domain_num].queues_[lp_lookup_[num_thread]]->
+                get_thread_cache_hits(reset);
+
+            count += np_queues_[domain_num].queues_[np_lookup_[num_thread]]->
+                get_thread_cache_hits(reset);
+
+            count += hp_queues_[domain_num].queues_[hp_lookup_[num_thread]]->
+                get_thread_cache_hits(reset);
+
+            return count;
+        }
+
+        std::int64_t get_thread_cache_misses(std::size_t num_thread, bool reset) override
+        {
+            std::int64_t count = 0;
+
+            if (num_thread == std::size_t(-1))
+            {
+                for (std::size_t d = 0; d < num_domains_; ++d) {
+                    for (auto &queue : lp_queues_[d].queues_) {
+                        count += queue->get_thread_cache_misses(reset);
+                    }
+
+                    for (auto &queue : np_queues_[d].queues_) {
+                        count += queue->get_thread_cache_misses(reset);
+                    }
+
+                    for (auto &queue : hp_queues_[d].queues_) {
+                        count += queue->get_thread_cache_misses(reset);
+                    }
+                }
+
+                return count;
+            }
+
+            std::size_t domain_num = d_lookup_[num_thread];
+
+            count += lp_queues_[domain_num].queues_[lp_lookup_[num_thread]]->
+                get_thread_cache_misses(reset);
+
+            count += np_queues_[domain_num].queues_[np_lookup_[num_thread]]->
+                get_thread_cache_misses(reset);
+
+            count += hp_queues_[domain_num].queues_[hp_lookup_[num_thread]]->
+                get_thread_cache_misses(reset);
+
+            return count;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // This returns the current length of the queues (work items and new
         // items)
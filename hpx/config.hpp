@@ -423,6 +423,12 @@
 #endif
 #endif
 
+// This limits how deep continuations launched with launch::adaptive will be
+// nested while being run inline before a new thread is spawned instead.
+#if !defined(HPX_CONTINUATION_MAX_INLINE_DEPTH)
+#define HPX_CONTINUATION_MAX_INLINE_DEPTH HPX_CONTINUATION_MAX_RECURSION_DEPTH
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // Make sure we have support for more than 64 threads for Xeon Phi
 #if defined(__MIC__) && !defined(HPX_HAVE_MORE_THAN_64_THREADS)
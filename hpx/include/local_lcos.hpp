@@ -15,11 +15,16 @@
 #include <hpx/lcos/local/counting_semaphore.hpp>
 #include <hpx/lcos/local/event.hpp>
 #include <hpx/lcos/local/latch.hpp>
+#include <hpx/lcos/local/mcs_spinlock.hpp>
 #include <hpx/lcos/local/mutex.hpp>
 #include <hpx/lcos/local/no_mutex.hpp>
 #include <hpx/lcos/local/recursive_mutex.hpp>
+#include <hpx/lcos/local/scalable_shared_mutex.hpp>
 #include <hpx/lcos/local/shared_mutex.hpp>
 #include <hpx/lcos/local/sliding_semaphore.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/lcos/local/ticket_spinlock.hpp>
+#include <hpx/lcos/local/tree_barrier.hpp>
 
 #include <hpx/lcos/future.hpp>
 #include <hpx/lcos/local/and_gate.hpp>
@@ -30,9 +30,9 @@
 #include <hpx/util/always_void.hpp>
 #include <hpx/util/annotated_function.hpp>
 #include <hpx/util/deferred_call.hpp>
-#include <hpx/util/internal_allocator.hpp>
 #include <hpx/util/invoke_fused.hpp>
 #include <hpx/util/pack_traversal_async.hpp>
+#include <hpx/util/pooled_allocator.hpp>
 #include <hpx/util/thread_description.hpp>
 #include <hpx/util/tuple.hpp>
 
@@ -236,6 +236,21 @@ namespace hpx { namespace lcos { namespace detail
             }
         }
 
+        void finalize(hpx::detail::adaptive_policy policy, Futures&& futures)
+        {
+            // run the final function invocation inline if possible
+            if (lcos::detail::can_run_inline_continuation())
+            {
+                lcos::detail::handle_continuation_recursion_count cnt;
+                done(std::move(futures));
+            }
+            else
+            {
+                finalize(hpx::launch::async(policy.priority()),
+                    std::move(futures));
+            }
+        }
+
         void finalize(hpx::detail::fork_policy policy, Futures&& futures)
         {
             // schedule the final function invocation with high priority
@@ -257,6 +272,10 @@ namespace hpx { namespace lcos { namespace detail
             {
                 finalize(launch::fork, std::move(futures));
             }
+            else if (policy == launch::adaptive)
+            {
+                finalize(launch::adaptive, std::move(futures));
+            }
             else
             {
                 finalize(launch::async, std::move(futures));
@@ -531,12 +550,12 @@ namespace hpx
     auto dataflow(F && f, Ts &&... ts)
     ->  decltype(
             lcos::detail::dataflow_dispatch<typename std::decay<F>::type>::call(
-                hpx::util::internal_allocator<>{}, std::forward<F>(f),
+                hpx::util::pooled_allocator<>{}, std::forward<F>(f),
                 std::forward<Ts>(ts)...
         ))
     {
         return lcos::detail::dataflow_dispatch<typename std::decay<F>::type>::
-            call(hpx::util::internal_allocator<>{}, std::forward<F>(f),
+            call(hpx::util::pooled_allocator<>{}, std::forward<F>(f),
                 std::forward<Ts>(ts)...);
     }
 
@@ -559,11 +578,11 @@ namespace hpx
     HPX_FORCEINLINE
     auto dataflow(T0 && t0, Ts &&... ts)
     ->  decltype(lcos::detail::dataflow_action_dispatch<Action, T0>::call(
-            hpx::util::internal_allocator<>{}, std::forward<T0>(t0),
+            hpx::util::pooled_allocator<>{}, std::forward<T0>(t0),
             std::forward<Ts>(ts)...))
     {
         return lcos::detail::dataflow_action_dispatch<Action, T0>::call(
-            hpx::util::internal_allocator<>{}, std::forward<T0>(t0),
+            hpx::util::pooled_allocator<>{}, std::forward<T0>(t0),
             std::forward<Ts>(ts)...);
     }
 
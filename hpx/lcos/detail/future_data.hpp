@@ -9,7 +9,7 @@
 #include <hpx/config.hpp>
 #include <hpx/error_code.hpp>
 #include <hpx/lcos/local/detail/condition_variable.hpp>
-#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/lcos/local/detail/shared_state_mutex.hpp>
 #include <hpx/runtime/launch_policy.hpp>
 #include <hpx/runtime/threads/coroutines/detail/get_stack_pointer.hpp>
 #include <hpx/runtime/threads/thread_executor.hpp>
@@ -40,6 +40,7 @@
 #include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <memory>
 #include <mutex>
@@ -72,6 +73,30 @@ namespace detail
     void intrusive_ptr_add_ref(future_data_refcnt_base* p);
     void intrusive_ptr_release(future_data_refcnt_base* p);
 
+    ///////////////////////////////////////////////////////////////////////
+    // Keep track of the nesting depth of continuations run on this thread
+    struct handle_continuation_recursion_count
+    {
+        handle_continuation_recursion_count()
+          : count_(threads::get_continuation_recursion_count())
+        {
+            ++count_;
+        }
+        ~handle_continuation_recursion_count()
+        {
+            --count_;
+        }
+
+        std::size_t& count_;
+    };
+
+    // Return whether a continuation launched with launch::adaptive may be
+    // run inline on the current thread (which has made the predecessor of
+    // the continuation ready). This is the case for HPX threads as long as
+    // the nesting depth of continuations stays below
+    // HPX_CONTINUATION_MAX_INLINE_DEPTH and enough stack space is left.
+    HPX_EXPORT bool can_run_inline_continuation();
+
     ///////////////////////////////////////////////////////////////////////
     struct HPX_EXPORT future_data_refcnt_base
     {
@@ -202,16 +227,18 @@ namespace detail
       : future_data_refcnt_base
     {
         future_data_base()
-          : state_(empty)
+          : state_(empty), on_completed_(nullptr), waiters_(0),
+            first_node_used_(false)
         {}
 
         future_data_base(init_no_addref no_addref)
-          : future_data_refcnt_base(no_addref), state_(empty)
+          : future_data_refcnt_base(no_addref), state_(empty),
+            on_completed_(nullptr), waiters_(0), first_node_used_(false)
         {}
 
         using future_data_refcnt_base::completed_callback_type;
         using future_data_refcnt_base::completed_callback_vector_type;
-        typedef lcos::local::spinlock mutex_type;
+        typedef lcos::local::detail::shared_state_mutex mutex_type;
         typedef util::unused_type result_type;
         typedef future_data_refcnt_base::init_no_addref init_no_addref;
 
@@ -286,6 +313,47 @@ namespace detail
 
         virtual std::exception_ptr get_exception_ptr() const = 0;
 
+    protected:
+        // Wake up all threads suspended in wait() and invoke all registered
+        // continuations. This must be called exactly once, right after the
+        // state has been changed from 'empty' to 'value' or 'exception'.
+        void handle_ready();
+
+        // Release all continuations which have not been invoked yet.
+        void reset_on_completed();
+
+        // Continuations are kept in a lock-free intrusive stack, its head is
+        // replaced by completed_marker() once the future has become ready.
+        // The node of the first continuation is stored inline.
+        struct completed_callback_node
+        {
+            completed_callback_node()
+              : next_(nullptr)
+            {}
+
+            explicit completed_callback_node(completed_callback_type && f)
+              : callback_(std::move(f)), next_(nullptr)
+            {}
+
+            completed_callback_type callback_;
+            completed_callback_node* next_;
+        };
+
+        static completed_callback_node* completed_marker()
+        {
+            return reinterpret_cast<completed_callback_node*>(
+                static_cast<std::uintptr_t>(1));
+        }
+
+        completed_callback_node* make_node(completed_callback_type && f);
+        void release_node(completed_callback_node* node);
+
+        // invoke (and release) a list of continuations
+        bool run_on_completed(completed_callback_node*&& head,
+            std::exception_ptr& ptr);
+
+    public:
+
         virtual std::string const& get_registered_name() const
         {
             HPX_THROW_EXCEPTION(invalid_status,
@@ -302,8 +370,12 @@ namespace detail
     protected:
         mutable mutex_type mtx_;
         std::atomic<state> state_;                  // current state
-        completed_callback_vector_type on_completed_;
+        std::atomic<completed_callback_node*> on_completed_;
+        std::atomic<std::size_t> waiters_;          // number of threads in wait
         local::detail::condition_variable cond_;    // threads waiting in read
+
+        completed_callback_node first_node_;        // inline continuation
+        std::atomic<bool> first_node_used_;
     };
 
     template <typename Result>
@@ -329,7 +401,7 @@ namespace detail
     public:
         typedef typename future_data_result<Result>::type result_type;
         typedef future_data_base<traits::detail::future_data_void> base_type;
-        typedef lcos::local::spinlock mutex_type;
+        typedef lcos::local::detail::shared_state_mutex mutex_type;
         typedef typename base_type::init_no_addref init_no_addref;
         typedef typename base_type::completed_callback_type completed_callback_type;
         typedef typename base_type::completed_callback_vector_type
@@ -424,47 +496,23 @@ namespace detail
             result_type* value_ptr = reinterpret_cast<result_type*>(&storage_);
             construct(value_ptr, std::forward<Ts>(ts)...);
 
-            // At this point the lock needs to be acquired to safely access the
-            // registered continuations
-            std::unique_lock<mutex_type> l(mtx_);
-
             // The value has been set, changing the state to 'value' at this
             // point signals to all other threads that this future is ready.
+            // Note: this has to be sequentially consistent with respect to
+            //       the waiters_ count inspected by handle_ready().
             state expected = empty;
-            if (!state_.compare_exchange_strong(
-                    expected, value, std::memory_order_release))
+            if (!state_.compare_exchange_strong(expected, value))
             {
                 // this future should be 'empty' still (it can't be made ready
                 // more than once).
-                l.unlock();
                 HPX_THROW_EXCEPTION(promise_already_satisfied,
                     "future_data_base::set_value",
                     "data has already been set for this future");
                 return;
             }
 
-            // handle all threads waiting for the future to become ready
-            auto on_completed = std::move(on_completed_);
-            on_completed_.clear();
-
-            // Note: we use notify_one repeatedly instead of notify_all as we
-            //       know: a) that most of the time we have at most one thread
-            //       waiting on the future (most futures are not shared), and
-            //       b) our implementation of condition_variable::notify_one
-            //       relinquishes the lock before resuming the waiting thread
-            //       which avoids suspension of this thread when it tries to
-            //       re-lock the mutex while exiting from condition_variable::wait
-            while (cond_.notify_one(std::move(l), threads::thread_priority_boost))
-            {
-                l = std::unique_lock<mutex_type>(mtx_);
-            }
-
-            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
-            //       it unlocked when returning.
-
-            // invoke the callback (continuation) function
-            if (!on_completed.empty())
-                handle_on_completed(std::move(on_completed));
+            // wake up waiting threads and invoke the continuations
+            handle_ready();
         }
 
         void set_exception(std::exception_ptr data) override
@@ -480,47 +528,23 @@ namespace detail
                 reinterpret_cast<std::exception_ptr*>(&storage_);
             ::new ((void*)exception_ptr) std::exception_ptr(std::move(data));
 
-            // At this point the lock needs to be acquired to safely access the
-            // registered continuations
-            std::unique_lock<mutex_type> l(mtx_);
-
             // The value has been set, changing the state to 'exception' at this
             // point signals to all other threads that this future is ready.
+            // Note: this has to be sequentially consistent with respect to
+            //       the waiters_ count inspected by handle_ready().
             state expected = empty;
-            if (!state_.compare_exchange_strong(
-                    expected, exception, std::memory_order_release))
+            if (!state_.compare_exchange_strong(expected, exception))
             {
                 // this future should be 'empty' still (it can't be made ready
                 // more than once).
-                l.unlock();
                 HPX_THROW_EXCEPTION(promise_already_satisfied,
                     "future_data_base::set_exception",
                     "data has already been set for this future");
                 return;
             }
 
-            // handle all threads waiting for the future to become ready
-            auto on_completed = std::move(on_completed_);
-            on_completed_.clear();
-
-            // Note: we use notify_one repeatedly instead of notify_all as we
-            //       know: a) that most of the time we have at most one thread
-            //       waiting on the future (most futures are not shared), and
-            //       b) our implementation of condition_variable::notify_one
-            //       relinquishes the lock before resuming the waiting thread
-            //       which avoids suspension of this thread when it tries to
-            //       re-lock the mutex while exiting from condition_variable::wait
-            while (cond_.notify_one(std::move(l), threads::thread_priority_boost))
-            {
-                l = std::unique_lock<mutex_type>(mtx_);
-            }
-
-            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
-            //       it unlocked when returning.
-
-            // invoke the callback (continuation) function
-            if (!on_completed.empty())
-                handle_on_completed(std::move(on_completed));
+            // wake up waiting threads and invoke the continuations
+            handle_ready();
         }
 
         // helper functions for setting data (if successful) or the error (if
@@ -584,7 +608,7 @@ namespace detail
             default: break;
             }
 
-            on_completed_.clear();
+            this->reset_on_completed();
         }
 
         std::exception_ptr get_exception_ptr() const override
@@ -600,6 +624,7 @@ namespace detail
 
     private:
         using base_type::cond_;
+        using base_type::waiters_;
         typename future_data_storage<Result>::type storage_;
     };
 
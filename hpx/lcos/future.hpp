@@ -32,9 +32,9 @@
 #include <hpx/util/decay.hpp>
 #include <hpx/util/function.hpp>
 #include <hpx/util/identity.hpp>
-#include <hpx/util/internal_allocator.hpp>
 #include <hpx/util/invoke.hpp>
 #include <hpx/util/lazy_enable_if.hpp>
+#include <hpx/util/pooled_allocator.hpp>
 #include <hpx/util/result_of.hpp>
 #include <hpx/util/serialize_exception.hpp>
 #include <hpx/util/steady_clock.hpp>
@@ -427,7 +427,7 @@ namespace hpx { namespace lcos { namespace detail
 
             typename hpx::traits::detail::shared_state_ptr<result_type>::type p =
                 detail::make_continuation_alloc<continuation_result_type>(
-                    hpx::util::internal_allocator<>{},
+                    hpx::util::pooled_allocator<>{},
                     std::move(fut), std::forward<Policy_>(policy),
                     std::forward<F>(f));
             return hpx::traits::future_access<future<result_type> >::create(
@@ -1525,7 +1525,7 @@ namespace hpx { namespace lcos
     >::type
     make_ready_future(T&& init)
     {
-        return make_ready_future_alloc(hpx::util::internal_allocator<>{},
+        return make_ready_future_alloc(hpx::util::pooled_allocator<>{},
             std::forward<T>(init));
     }
 
@@ -1573,7 +1573,7 @@ namespace hpx { namespace lcos
     >::type
     make_ready_future()
     {
-        return make_ready_future_alloc<T>(hpx::util::internal_allocator<>{});
+        return make_ready_future_alloc<T>(hpx::util::pooled_allocator<>{});
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -1619,7 +1619,7 @@ namespace hpx { namespace lcos
     >::type
     make_ready_future(T1&& t1, Ts&&... ts)
     {
-        return make_ready_future_alloc<T>(hpx::util::internal_allocator<>{},
+        return make_ready_future_alloc<T>(hpx::util::pooled_allocator<>{},
             std::forward<T1>(t1), std::forward<Ts>(ts)...);
     }
 
@@ -1716,7 +1716,7 @@ namespace hpx { namespace lcos
     // extension: create a pre-initialized future object
     HPX_FORCEINLINE future<void> make_ready_future()
     {
-        return make_ready_future_alloc(hpx::util::internal_allocator<>{});
+        return make_ready_future_alloc(hpx::util::pooled_allocator<>{});
     }
 
     // Extension (see wg21.link/P0319)
@@ -9,26 +9,34 @@
 #include <hpx/config.hpp>
 #include <hpx/exception.hpp>
 #include <hpx/lcos/future.hpp>
+#include <hpx/lcos/local/detail/condition_variable.hpp>
+#include <hpx/lcos/local/detail/shared_state_mutex.hpp>
 #include <hpx/lcos/local/no_mutex.hpp>
 #include <hpx/lcos/local/packaged_task.hpp>
+#include <hpx/lcos/local/promise.hpp>
 #include <hpx/lcos/local/receive_buffer.hpp>
-#include <hpx/lcos/local/spinlock.hpp>
 #include <hpx/runtime/launch_policy.hpp>
+#include <hpx/runtime/threads/thread_data_fwd.hpp>
 #include <hpx/util/assert.hpp>
 #include <hpx/util/assert_owns_lock.hpp>
 #include <hpx/util/atomic_count.hpp>
 #include <hpx/util/iterator_facade.hpp>
+#include <hpx/util/optional.hpp>
 #include <hpx/util/register_locks.hpp>
 #include <hpx/util/unlock_guard.hpp>
 #include <hpx/util/unused.hpp>
 
 #include <boost/intrusive_ptr.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdlib>
+#include <deque>
 #include <exception>
 #include <iterator>
+#include <memory>
 #include <mutex>
+#include <type_traits>
 #include <utility>
 
 namespace hpx { namespace lcos { namespace local
@@ -85,10 +93,10 @@ namespace hpx { namespace lcos { namespace local
         }
 
         ///////////////////////////////////////////////////////////////////////
-        template <typename T>
+        template <typename T, typename Mutex = shared_state_mutex>
         class unlimited_channel : public channel_impl_base<T>
         {
-            typedef hpx::lcos::local::spinlock mutex_type;
+            typedef Mutex mutex_type;
 
         public:
             HPX_NON_COPYABLE(unlimited_channel);
@@ -370,10 +378,10 @@ namespace hpx { namespace lcos { namespace local
         };
 
         ///////////////////////////////////////////////////////////////////////
-        template <typename T>
+        template <typename T, typename Mutex = shared_state_mutex>
         class one_element_channel : public channel_impl_base<T>
         {
-            typedef hpx::lcos::local::spinlock mutex_type;
+            typedef Mutex mutex_type;
 
         public:
             HPX_NON_COPYABLE(one_element_channel);
@@ -503,6 +511,822 @@ namespace hpx { namespace lcos { namespace local
             bool closed_;
         };
 
+        ///////////////////////////////////////////////////////////////////////
+        // The parts shared by the channels based on a ring buffer of a fixed
+        // capacity. The derived channel implements storing and receiving
+        // (ranges of) elements without ever suspending:
+        //
+        //      template <typename Iter>
+        //      std::size_t push_n(Iter& first, std::size_t count);
+        //      template <typename F>
+        //      std::size_t pop_n(std::size_t count, F& f);
+        //
+        //      // discard all elements, called on close(true)
+        //      void request_drain();
+        //
+        // Threads which have to wait for free space or for new elements are
+        // suspended on condition variables which are notified only if
+        // somebody is waiting. Asynchronous requests which can't be
+        // satisfied immediately are queued and completed by the thread which
+        // stores (receives) the element they are waiting for.
+        //
+        // These channels don't support generations.
+        template <typename T, typename Derived, typename Mutex>
+        class ring_buffer_channel : public channel_impl_base<T>
+        {
+        protected:
+            typedef Mutex mutex_type;
+
+            struct handle_waiter_count
+            {
+                explicit handle_waiter_count(std::atomic<std::size_t>& count)
+                  : count_(count)
+                {
+                    ++count_;
+                }
+                ~handle_waiter_count()
+                {
+                    --count_;
+                }
+
+                std::atomic<std::size_t>& count_;
+            };
+
+            // the capacity is rounded up to the next power of two
+            static std::size_t get_buffer_size(std::size_t capacity)
+            {
+                std::size_t size = 2;
+                while (size < capacity)
+                    size <<= 1;
+                return size;
+            }
+
+            // An index written by one side of the channel only. It lives on
+            // a cache line of its own, together with the cached copy of the
+            // index of the other side (which is used by spsc channels only).
+            struct index_type
+            {
+                index_type()
+                  : value_(0), cache_(0)
+                {}
+
+                std::atomic<std::size_t> value_;
+                std::size_t cache_;
+                char pad_[64 - sizeof(std::atomic<std::size_t>) -
+                    sizeof(std::size_t)];
+            };
+
+        public:
+            HPX_NON_COPYABLE(ring_buffer_channel);
+
+        public:
+            explicit ring_buffer_channel(std::size_t capacity)
+              : mask_(get_buffer_size(capacity) - 1), closed_(false),
+                push_waiters_(0), pop_waiters_(0)
+            {}
+
+            std::size_t capacity() const
+            {
+                return mask_ + 1;
+            }
+
+            ///////////////////////////////////////////////////////////////////
+            // Store up to count elements without suspending, returns the
+            // number of stored elements.
+            template <typename Iter>
+            std::size_t try_set_n(Iter first, std::size_t count)
+            {
+                if (closed_.load(std::memory_order_acquire))
+                    return 0;
+
+                std::size_t const n = derived().push_n(first, count);
+                notify(pop_waiters_, not_empty_, n);
+                return n;
+            }
+
+            // Store count elements, suspend while the channel is full.
+            // Returns the number of stored elements, this is less than count
+            // only if the channel was closed. Throws invalid_status if it
+            // would have to suspend a thread which is not an HPX thread.
+            template <typename Iter>
+            std::size_t set_n(Iter first, std::size_t count)
+            {
+                if (closed_.load(std::memory_order_acquire))
+                    return 0;
+
+                std::size_t stored = derived().push_n(first, count);
+                notify(pop_waiters_, not_empty_, stored);
+
+                while (stored != count)
+                {
+                    std::size_t n = 0;
+                    {
+                        std::unique_lock<mutex_type> l(mtx_);
+                        handle_waiter_count cnt(push_waiters_);
+
+                        if (closed_.load())
+                            break;
+
+                        n = derived().push_n(first, count - stored);
+                        if (n == 0)
+                        {
+                            // waiting for space requires an HPX thread
+                            if (threads::get_self_ptr() == nullptr)
+                            {
+                                l.unlock();
+                                HPX_THROW_EXCEPTION(hpx::invalid_status,
+                                    "hpx::lcos::local::channel::set_n",
+                                    "the channel is full and the calling "
+                                    "thread is not an HPX thread");
+                            }
+
+                            not_full_.wait(l,
+                                "hpx::lcos::local::channel::set");
+                            continue;
+                        }
+                    }
+
+                    stored += n;
+                    notify(pop_waiters_, not_empty_, n);
+                }
+                return stored;
+            }
+
+            // Receive up to count elements without suspending, f is invoked
+            // for each of the received elements (and must not throw).
+            // Returns the number of received elements.
+            template <typename F>
+            std::size_t try_get_n(std::size_t count, F && f)
+            {
+                std::size_t const n = derived().pop_n(count, f);
+                notify(push_waiters_, not_full_, n);
+                return n;
+            }
+
+            // Receive count elements, suspend while the channel is empty.
+            // Returns the number of received elements, this is less than
+            // count only if the channel was closed. Throws invalid_status if
+            // it would have to suspend a thread which is not an HPX thread.
+            template <typename F>
+            std::size_t get_n(std::size_t count, F && f)
+            {
+                std::size_t received = try_get_n(count, f);
+                while (received != count)
+                {
+                    std::size_t n = 0;
+                    {
+                        std::unique_lock<mutex_type> l(mtx_);
+                        handle_waiter_count cnt(pop_waiters_);
+
+                        n = derived().pop_n(count - received, f);
+                        if (n == 0)
+                        {
+                            if (closed_.load())
+                                break;
+
+                            // waiting for elements requires an HPX thread
+                            if (threads::get_self_ptr() == nullptr)
+                            {
+                                l.unlock();
+                                HPX_THROW_EXCEPTION(hpx::invalid_status,
+                                    "hpx::lcos::local::channel::get_n",
+                                    "the channel is empty and the calling "
+                                    "thread is not an HPX thread");
+                            }
+
+                            not_empty_.wait(l,
+                                "hpx::lcos::local::channel::get");
+                            continue;
+                        }
+                    }
+
+                    received += n;
+                    notify(push_waiters_, not_full_, n);
+                }
+                return received;
+            }
+
+        protected:
+            hpx::future<T> get(std::size_t generation, bool blocking)
+            {
+                if (generation != std::size_t(-1))
+                {
+                    return hpx::make_exceptional_future<T>(
+                        HPX_GET_EXCEPTION(hpx::bad_parameter,
+                            "hpx::lcos::local::channel::get",
+                            "bounded channels don't support generations"));
+                }
+
+                hpx::future<T> f;
+                if (try_get_n(1, set_future(f)) != 0)
+                    return f;
+
+                if (closed_.load())
+                {
+                    // elements stored before the channel was closed are
+                    // still delivered
+                    if (try_get_n(1, set_future(f)) != 0)
+                        return f;
+
+                    return hpx::make_exceptional_future<T>(
+                        HPX_GET_EXCEPTION(hpx::invalid_status,
+                            "hpx::lcos::local::channel::get",
+                            "this channel is empty and was closed"));
+                }
+
+                if (blocking && this->use_count() == 1)
+                {
+                    return hpx::make_exceptional_future<T>(
+                        HPX_GET_EXCEPTION(hpx::invalid_status,
+                            "hpx::lcos::local::channel::get",
+                            "this channel is empty and is not accessible "
+                            "by any other thread causing a deadlock"));
+                }
+
+                if (blocking && threads::get_self_ptr() != nullptr)
+                {
+                    if (get_n(1, set_future(f)) != 0)
+                        return f;
+
+                    return hpx::make_exceptional_future<T>(
+                        HPX_GET_EXCEPTION(hpx::invalid_status,
+                            "hpx::lcos::local::channel::get",
+                            "this channel is empty and was closed"));
+                }
+
+                // the future becomes ready once an element was stored
+                return get_pending();
+            }
+
+            bool try_get(std::size_t generation, hpx::future<T>* f = nullptr)
+            {
+                if (generation != std::size_t(-1))
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "hpx::lcos::local::channel::try_get",
+                        "bounded channels don't support generations");
+                    return false;
+                }
+
+                if (f == nullptr)
+                {
+                    return !closed_.load() ||
+                        head_.value_.load(std::memory_order_acquire) !=
+                            tail_.value_.load(std::memory_order_acquire);
+                }
+
+                if (try_get_n(1, set_future(*f)) != 0)
+                    return true;
+
+                if (closed_.load())
+                    return try_get_n(1, set_future(*f)) != 0;
+
+                *f = get(generation, false);
+                return true;
+            }
+
+            hpx::future<void> set(std::size_t generation, T && t)
+            {
+                if (generation != std::size_t(-1))
+                {
+                    return hpx::make_exceptional_future<void>(
+                        HPX_GET_EXCEPTION(hpx::bad_parameter,
+                            "hpx::lcos::local::channel::set",
+                            "bounded channels don't support generations"));
+                }
+
+                if (closed_.load(std::memory_order_acquire))
+                {
+                    return hpx::make_exceptional_future<void>(
+                        HPX_GET_EXCEPTION(hpx::invalid_status,
+                            "hpx::lcos::local::channel::set",
+                            "attempting to write to a closed channel"));
+                }
+
+                // the value is moved only if it was stored
+                if (try_set_n(std::make_move_iterator(&t), 1) != 0)
+                    return hpx::make_ready_future();
+
+                // the future becomes ready once the value was stored
+                return set_pending(std::move(t));
+            }
+
+            std::size_t close(bool force_delete_entries = false)
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+                if (closed_.load())
+                {
+                    l.unlock();
+                    HPX_THROW_EXCEPTION(hpx::invalid_status,
+                        "hpx::lcos::local::channel::close",
+                        "attempting to close an already closed channel");
+                    return 0;
+                }
+
+                closed_.store(true);
+
+                // wake up all suspended threads, waiting producers will fail,
+                // waiting consumers will drain the remaining elements
+                std::size_t count = not_full_.size(l) + not_empty_.size(l) +
+                    pending_gets_.size() + pending_sets_.size();
+
+                not_full_.notify_all(std::move(l));
+
+                l = std::unique_lock<mutex_type>(mtx_);
+                not_empty_.notify_all(std::move(l));
+
+                // hand the remaining elements to the queued requests unless
+                // they are discarded, all other requests can't be satisfied
+                // anymore
+                if (force_delete_entries)
+                    derived().request_drain();
+                else
+                    serve_pending();
+
+                cancel_pending();
+                return count;
+            }
+
+        private:
+            Derived& derived()
+            {
+                return static_cast<Derived&>(*this);
+            }
+
+            // Wake up waiting threads after n cells have changed their state.
+            // The fence orders the preceding update of the cells with the
+            // check of the waiter count (waiters increment the count before
+            // re-checking the cells).
+            void notify(std::atomic<std::size_t>& waiters,
+                local::detail::condition_variable& cond, std::size_t n)
+            {
+                if (n == 0)
+                    return;
+
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (waiters.load(std::memory_order_relaxed) != 0)
+                {
+                    serve_pending();
+
+                    std::unique_lock<mutex_type> l(mtx_);
+                    if (n == 1)
+                        cond.notify_one(std::move(l));
+                    else
+                        cond.notify_all(std::move(l));
+                }
+            }
+
+            ///////////////////////////////////////////////////////////////////
+            // Queue a request for the next element, the returned future
+            // becomes ready as soon as an element was stored.
+            hpx::future<T> get_pending()
+            {
+                hpx::future<T> f;
+                {
+                    std::unique_lock<mutex_type> l(mtx_);
+                    ++pop_waiters_;
+
+                    // re-check after announcing the waiting consumer
+                    set_future store(f);
+                    if (derived().pop_n(1, store) == 0 && !closed_.load())
+                    {
+                        pending_gets_.emplace_back();
+                        return pending_gets_.back().get_future();
+                    }
+                    --pop_waiters_;
+                }
+
+                if (!f.valid())
+                {
+                    return hpx::make_exceptional_future<T>(
+                        HPX_GET_EXCEPTION(hpx::invalid_status,
+                            "hpx::lcos::local::channel::get",
+                            "this channel is empty and was closed"));
+                }
+
+                notify(push_waiters_, not_full_, 1);
+                return f;
+            }
+
+            // Queue a request to store the given value, the returned future
+            // becomes ready as soon as the value was stored.
+            hpx::future<void> set_pending(T && t)
+            {
+                {
+                    std::unique_lock<mutex_type> l(mtx_);
+                    if (closed_.load())
+                    {
+                        l.unlock();
+                        return hpx::make_exceptional_future<void>(
+                            HPX_GET_EXCEPTION(hpx::invalid_status,
+                                "hpx::lcos::local::channel::set",
+                                "attempting to write to a closed channel"));
+                    }
+
+                    ++push_waiters_;
+
+                    // re-check after announcing the waiting producer
+                    auto first = std::make_move_iterator(&t);
+                    if (derived().push_n(first, 1) == 0)
+                    {
+                        pending_sets_.emplace_back(
+                            std::move(t), lcos::local::promise<void>());
+                        return pending_sets_.back().second.get_future();
+                    }
+                    --push_waiters_;
+                }
+
+                notify(pop_waiters_, not_empty_, 1);
+                return hpx::make_ready_future();
+            }
+
+            // Complete the queued requests for as long as there are elements
+            // (or free cells) available. The promises are fulfilled without
+            // holding the lock.
+            void serve_pending()
+            {
+                bool progress = true;
+                while (progress)
+                {
+                    progress = false;
+
+                    std::unique_lock<mutex_type> l(mtx_);
+                    if (!pending_gets_.empty())
+                    {
+                        util::optional<T> value;
+                        auto const store =
+                            [&value](T && t) { value.emplace(std::move(t)); };
+
+                        if (derived().pop_n(1, store) != 0)
+                        {
+                            lcos::local::promise<T> p(
+                                std::move(pending_gets_.front()));
+                            pending_gets_.pop_front();
+                            --pop_waiters_;
+
+                            not_full_.notify_one(std::move(l));
+
+                            p.set_value(std::move(*value));
+                            progress = true;
+                            continue;
+                        }
+                    }
+
+                    if (!pending_sets_.empty() && !closed_.load())
+                    {
+                        auto first = std::make_move_iterator(
+                            &pending_sets_.front().first);
+
+                        if (derived().push_n(first, 1) != 0)
+                        {
+                            lcos::local::promise<void> p(
+                                std::move(pending_sets_.front().second));
+                            pending_sets_.pop_front();
+                            --push_waiters_;
+
+                            not_empty_.notify_one(std::move(l));
+
+                            p.set_value();
+                            progress = true;
+                        }
+                    }
+                }
+            }
+
+            // Fail all queued requests, this is called after the channel was
+            // closed.
+            void cancel_pending()
+            {
+                std::deque<lcos::local::promise<T> > gets;
+                std::deque<std::pair<T, lcos::local::promise<void> > > sets;
+                {
+                    std::lock_guard<mutex_type> l(mtx_);
+                    HPX_ASSERT(closed_.load());
+
+                    pop_waiters_ -= pending_gets_.size();
+                    push_waiters_ -= pending_sets_.size();
+
+                    std::swap(gets, pending_gets_);
+                    std::swap(sets, pending_sets_);
+                }
+
+                for (lcos::local::promise<T>& p : gets)
+                {
+                    p.set_exception(std::exception_ptr(
+                        HPX_GET_EXCEPTION(hpx::invalid_status,
+                            "hpx::lcos::local::channel::get",
+                            "this channel is empty and was closed")));
+                }
+
+                for (auto& s : sets)
+                {
+                    s.second.set_exception(std::exception_ptr(
+                        HPX_GET_EXCEPTION(hpx::invalid_status,
+                            "hpx::lcos::local::channel::set",
+                            "attempting to write to a closed channel")));
+                }
+            }
+
+            ///////////////////////////////////////////////////////////////////
+            struct set_future
+            {
+                explicit set_future(hpx::future<T>& f)
+                  : f_(f)
+                {}
+
+                void operator()(T && t) const
+                {
+                    f_ = hpx::make_ready_future(std::move(t));
+                }
+
+                hpx::future<T>& f_;
+            };
+
+        protected:
+            std::size_t const mask_;
+
+            // the producer and consumer indices live on separate cache lines
+            char pad0_[64];
+            index_type head_;
+            index_type tail_;
+
+            std::atomic<bool> closed_;
+
+        private:
+            // slow path, only used by suspended (or queued) producers and
+            // consumers
+            mutable mutex_type mtx_;
+            std::atomic<std::size_t> push_waiters_;
+            std::atomic<std::size_t> pop_waiters_;
+            local::detail::condition_variable not_full_;
+            local::detail::condition_variable not_empty_;
+
+            std::deque<lcos::local::promise<T> > pending_gets_;
+            std::deque<std::pair<T, lcos::local::promise<void> > >
+                pending_sets_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // A bounded multi-producer/multi-consumer channel based on a ring
+        // buffer of sequenced cells (see D. Vyukov, "Bounded MPMC queue").
+        // Producers and consumers claim (ranges of) cells using a single CAS
+        // on the head or tail index, the channel does not acquire any lock
+        // as long as it is neither full nor empty.
+        template <typename T, typename Mutex = shared_state_mutex>
+        class bounded_channel
+          : public ring_buffer_channel<T, bounded_channel<T, Mutex>, Mutex>
+        {
+            typedef ring_buffer_channel<T, bounded_channel<T, Mutex>, Mutex>
+                base_type;
+
+            friend base_type;
+
+            struct cell
+            {
+                std::atomic<std::size_t> sequence_;
+                typename std::aligned_storage<
+                    sizeof(T), std::alignment_of<T>::value
+                >::type data_;
+            };
+
+        public:
+            explicit bounded_channel(std::size_t capacity)
+              : base_type(capacity),
+                cells_(new cell[base_type::get_buffer_size(capacity)])
+            {
+                for (std::size_t i = 0; i <= this->mask_; ++i)
+                    cells_[i].sequence_.store(i, std::memory_order_relaxed);
+            }
+
+            ~bounded_channel()
+            {
+                drain();
+            }
+
+        private:
+            // Claim up to count consecutive cells of the given index. The
+            // cell at position pos is available if its sequence number is
+            // pos + offset (0 for producers, 1 for consumers).
+            std::size_t reserve(std::atomic<std::size_t>& index,
+                std::size_t count, std::size_t offset, std::size_t& pos)
+            {
+                std::size_t const mask = this->mask_;
+
+                pos = index.load(std::memory_order_relaxed);
+                while (true)
+                {
+                    std::size_t n = 0;
+                    while (n != count &&
+                        cells_[(pos + n) & mask].sequence_.load(
+                            std::memory_order_acquire) == pos + n + offset)
+                    {
+                        ++n;
+                    }
+
+                    if (n == 0)
+                    {
+                        std::size_t const seq = cells_[pos & mask].sequence_.
+                            load(std::memory_order_acquire);
+                        if (std::ptrdiff_t(seq - (pos + offset)) < 0)
+                            return 0;       // the channel is full (empty)
+
+                        // another thread has claimed this cell
+                        pos = index.load(std::memory_order_relaxed);
+                        continue;
+                    }
+
+                    if (index.compare_exchange_weak(pos, pos + n,
+                            std::memory_order_relaxed))
+                    {
+                        return n;
+                    }
+                }
+            }
+
+            template <typename Iter>
+            std::size_t push_n(Iter& first, std::size_t count)
+            {
+                std::size_t pos = 0;
+                std::size_t const n =
+                    reserve(this->head_.value_, count, 0, pos);
+                for (std::size_t i = 0; i != n; ++i, ++first)
+                {
+                    cell& c = cells_[(pos + i) & this->mask_];
+                    ::new (&c.data_) T(*first);
+                    c.sequence_.store(pos + i + 1, std::memory_order_release);
+                }
+                return n;
+            }
+
+            template <typename F>
+            std::size_t pop_n(std::size_t count, F& f)
+            {
+                std::size_t pos = 0;
+                std::size_t const n =
+                    reserve(this->tail_.value_, count, 1, pos);
+                for (std::size_t i = 0; i != n; ++i)
+                {
+                    cell& c = cells_[(pos + i) & this->mask_];
+                    T* p = reinterpret_cast<T*>(&c.data_);
+                    f(std::move(*p));
+                    p->~T();
+                    c.sequence_.store(pos + i + this->mask_ + 1,
+                        std::memory_order_release);
+                }
+                return n;
+            }
+
+            void drain()
+            {
+                auto const discard = [](T&&) {};
+                while (pop_n(this->mask_ + 1, discard) != 0)
+                    /**/;
+            }
+
+            // any thread may receive elements
+            void request_drain()
+            {
+                drain();
+            }
+
+        private:
+            std::unique_ptr<cell[]> cells_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // A bounded single-producer/single-consumer channel based on a ring
+        // buffer. The producer only writes the head index and the consumer
+        // only writes the tail index, each side keeps a cached copy of the
+        // other index and re-reads it only if the buffer appears to be full
+        // (empty). Storing or receiving elements therefore touches a single
+        // shared atomic as long as the channel is neither full nor empty.
+        //
+        // Note: a future returned from get() or set() has to become ready
+        //       before the same side of the channel is used again. Queued
+        //       requests are completed by the other side, which takes over
+        //       the role of the waiting side in the meantime.
+        template <typename T, typename Mutex = shared_state_mutex>
+        class spsc_channel
+          : public ring_buffer_channel<T, spsc_channel<T, Mutex>, Mutex>
+        {
+            typedef ring_buffer_channel<T, spsc_channel<T, Mutex>, Mutex>
+                base_type;
+
+            friend base_type;
+
+            typedef typename std::aligned_storage<
+                    sizeof(T), std::alignment_of<T>::value
+                >::type storage_type;
+
+        public:
+            explicit spsc_channel(std::size_t capacity)
+              : base_type(capacity),
+                buffer_(new storage_type[base_type::get_buffer_size(capacity)]),
+                drain_requested_(false)
+            {}
+
+            ~spsc_channel()
+            {
+                drain();
+            }
+
+        private:
+            // head_.cache_ is the tail index as last seen by the producer
+            template <typename Iter>
+            std::size_t push_n(Iter& first, std::size_t count)
+            {
+                std::size_t const size = this->mask_ + 1;
+                std::size_t const head =
+                    this->head_.value_.load(std::memory_order_relaxed);
+
+                std::size_t n = size - (head - this->head_.cache_);
+                if (n < count)
+                {
+                    this->head_.cache_ =
+                        this->tail_.value_.load(std::memory_order_acquire);
+                    n = size - (head - this->head_.cache_);
+                }
+                if (n > count)
+                    n = count;
+
+                for (std::size_t i = 0; i != n; ++i, ++first)
+                    ::new (&buffer_[(head + i) & this->mask_]) T(*first);
+
+                if (n != 0)
+                {
+                    this->head_.value_.store(head + n,
+                        std::memory_order_release);
+                }
+                return n;
+            }
+
+            template <typename F>
+            std::size_t pop_n(std::size_t count, F& f)
+            {
+                // the elements are discarded by the consumer if the channel
+                // was closed with force_delete_entries
+                if (HPX_UNLIKELY(
+                        drain_requested_.load(std::memory_order_acquire)))
+                {
+                    drain();
+                    return 0;
+                }
+                return pop_n_impl(count, f);
+            }
+
+            // tail_.cache_ is the head index as last seen by the consumer
+            template <typename F>
+            std::size_t pop_n_impl(std::size_t count, F& f)
+            {
+                std::size_t const tail =
+                    this->tail_.value_.load(std::memory_order_relaxed);
+
+                std::size_t n = this->tail_.cache_ - tail;
+                if (n < count)
+                {
+                    this->tail_.cache_ =
+                        this->head_.value_.load(std::memory_order_acquire);
+                    n = this->tail_.cache_ - tail;
+                }
+                if (n > count)
+                    n = count;
+
+                for (std::size_t i = 0; i != n; ++i)
+                {
+                    T* p = reinterpret_cast<T*>(
+                        &buffer_[(tail + i) & this->mask_]);
+                    f(std::move(*p));
+                    p->~T();
+                }
+
+                if (n != 0)
+                {
+                    this->tail_.value_.store(tail + n,
+                        std::memory_order_release);
+                }
+                return n;
+            }
+
+            void drain()
+            {
+                auto const discard = [](T&&) {};
+                while (pop_n_impl(this->mask_ + 1, discard) != 0)
+                    /**/;
+            }
+
+            // only the consumer may receive elements, the elements are
+            // discarded by its next attempt to receive an element (or by the
+            // destructor)
+            void request_drain()
+            {
+                drain_requested_.store(true, std::memory_order_release);
+            }
+
+        private:
+            std::unique_ptr<storage_type[]> buffer_;
+            std::atomic<bool> drain_requested_;
+        };
+
         ///////////////////////////////////////////////////////////////////////
         template <typename T> class channel_base;
     }
@@ -510,6 +1334,8 @@ namespace hpx { namespace lcos { namespace local
     ///////////////////////////////////////////////////////////////////////////
     template <typename T = void> class channel;
     template <typename T = void> class one_element_channel;
+    template <typename T> class bounded_channel;
+    template <typename T> class spsc_channel;
     template <typename T = void> class receive_channel;
     template <typename T = void> class send_channel;
 
@@ -788,6 +1614,224 @@ namespace hpx { namespace lcos { namespace local
         using base_type::range;
     };
 
+    // channel with a bounded buffer, producers are suspended while the
+    // buffer is full
+    template <typename T>
+    class bounded_channel : protected detail::channel_base<T>
+    {
+        typedef detail::channel_base<T> base_type;
+        typedef detail::bounded_channel<T> impl_type;
+
+    private:
+        friend class channel_iterator<T>;
+        friend class receive_channel<T>;
+        friend class send_channel<T>;
+
+    public:
+        typedef T value_type;
+
+        /// Create a channel which holds at most \a capacity elements (the
+        /// capacity is rounded up to the next power of two).
+        explicit bounded_channel(std::size_t capacity)
+          : base_type(new impl_type(capacity))
+        {}
+
+        using base_type::get;
+        using base_type::set;
+        using base_type::close;
+        using base_type::begin;
+        using base_type::end;
+        using base_type::range;
+
+        std::size_t capacity() const
+        {
+            return get_impl()->capacity();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// Store the given value if the channel is not full and not closed,
+        /// never suspends. The value is left untouched if it was not stored.
+        bool try_set(T const& val)
+        {
+            return get_impl()->try_set_n(&val, 1) != 0;
+        }
+        bool try_set(T && val)
+        {
+            return get_impl()->try_set_n(std::make_move_iterator(&val), 1) != 0;
+        }
+
+        /// Store up to \a count elements from the given range without
+        /// suspending, returns the number of stored elements.
+        template <typename Iter>
+        std::size_t try_set_n(Iter first, std::size_t count)
+        {
+            return get_impl()->try_set_n(first, count);
+        }
+
+        /// Store \a count elements from the given range, suspends the calling
+        /// thread while the channel is full. Throws \a invalid_status if the
+        /// channel is full and the calling thread is not an HPX thread, the
+        /// elements stored until then stay in the channel.
+        template <typename Iter>
+        void set_n(Iter first, std::size_t count)
+        {
+            if (get_impl()->set_n(first, count) != count)
+            {
+                HPX_THROW_EXCEPTION(hpx::invalid_status,
+                    "hpx::lcos::local::bounded_channel::set_n",
+                    "attempting to write to a closed channel");
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// Receive a value if the channel is not empty, never suspends.
+        bool try_get(T& val)
+        {
+            return try_get_n(&val, 1) != 0;
+        }
+
+        /// Receive up to \a count elements without suspending, returns the
+        /// number of received elements.
+        template <typename OutIter>
+        std::size_t try_get_n(OutIter dest, std::size_t count)
+        {
+            return get_impl()->try_get_n(count,
+                [&dest](T && t) { *dest++ = std::move(t); });
+        }
+
+        /// Receive \a count elements, suspends the calling thread while the
+        /// channel is empty. Returns the number of received elements which
+        /// is less than \a count only if the channel was closed. Throws
+        /// \a invalid_status if the channel is empty and the calling thread
+        /// is not an HPX thread, the elements received until then have been
+        /// written to \a dest.
+        template <typename OutIter>
+        std::size_t get_n(OutIter dest, std::size_t count)
+        {
+            return get_impl()->get_n(count,
+                [&dest](T && t) { *dest++ = std::move(t); });
+        }
+
+    private:
+        impl_type* get_impl() const
+        {
+            return static_cast<impl_type*>(this->channel_.get());
+        }
+    };
+
+    // channel with a bounded buffer connecting exactly one producer with
+    // exactly one consumer
+    template <typename T>
+    class spsc_channel : protected detail::channel_base<T>
+    {
+        typedef detail::channel_base<T> base_type;
+        typedef detail::spsc_channel<T> impl_type;
+
+    private:
+        friend class channel_iterator<T>;
+        friend class receive_channel<T>;
+        friend class send_channel<T>;
+
+    public:
+        typedef T value_type;
+
+        /// Create a channel which holds at most \a capacity elements (the
+        /// capacity is rounded up to the next power of two). At most one
+        /// thread may store values into and at most one thread may receive
+        /// values from the channel at any point in time.
+        explicit spsc_channel(std::size_t capacity)
+          : base_type(new impl_type(capacity))
+        {}
+
+        using base_type::get;
+        using base_type::set;
+        using base_type::close;
+        using base_type::begin;
+        using base_type::end;
+        using base_type::range;
+
+        std::size_t capacity() const
+        {
+            return get_impl()->capacity();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The synchronous operations suspend the calling HPX thread directly
+        // instead of waiting for a future.
+        T get(launch::sync_policy, std::size_t generation = std::size_t(-1),
+            error_code& ec = throws) const
+        {
+            if (threads::get_self_ptr() == nullptr)
+                return base_type::get(launch::sync, generation, ec);
+
+            hpx::util::optional<T> result;
+            if (get_impl()->get_n(1,
+                    [&result](T && t) { result.emplace(std::move(t)); }) == 0)
+            {
+                HPX_THROWS_IF(ec, hpx::invalid_status,
+                    "hpx::lcos::local::spsc_channel::get",
+                    "this channel is empty and was closed");
+                return T();
+            }
+
+            if (&ec != &throws)
+                ec = make_success_code();
+
+            return std::move(*result);
+        }
+        T get(launch::sync_policy, error_code& ec,
+            std::size_t generation = std::size_t(-1)) const
+        {
+            return get(launch::sync, generation, ec);
+        }
+
+        void set(T val, std::size_t generation = std::size_t(-1))
+        {
+            set(launch::sync, std::move(val), generation);
+        }
+        void set(launch::sync_policy, T val,
+            std::size_t generation = std::size_t(-1))
+        {
+            if (threads::get_self_ptr() == nullptr)
+            {
+                base_type::set(launch::sync, std::move(val), generation);
+                return;
+            }
+
+            if (get_impl()->set_n(std::make_move_iterator(&val), 1) == 0)
+            {
+                HPX_THROW_EXCEPTION(hpx::invalid_status,
+                    "hpx::lcos::local::spsc_channel::set",
+                    "attempting to write to a closed channel");
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// Store the given value if the channel is not full and not closed,
+        /// never suspends. The value is left untouched if it was not stored.
+        bool try_set(T const& val)
+        {
+            return get_impl()->try_set_n(&val, 1) != 0;
+        }
+        bool try_set(T && val)
+        {
+            return get_impl()->try_set_n(std::make_move_iterator(&val), 1) != 0;
+        }
+
+        /// Receive a value if the channel is not empty, never suspends.
+        bool try_get(T& val)
+        {
+            return get_impl()->try_get_n(1,
+                [&val](T && t) { val = std::move(t); }) != 0;
+        }
+
+    private:
+        impl_type* get_impl() const
+        {
+            return static_cast<impl_type*>(this->channel_.get());
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename T>
     class receive_channel : protected detail::channel_base<T>
@@ -805,6 +1849,12 @@ namespace hpx { namespace lcos { namespace local
         receive_channel(one_element_channel<T> const& c)
           : base_type(c.get_channel_impl())
         {}
+        receive_channel(bounded_channel<T> const& c)
+          : base_type(c.get_channel_impl())
+        {}
+        receive_channel(spsc_channel<T> const& c)
+          : base_type(c.get_channel_impl())
+        {}
 
         using base_type::get;
         using base_type::begin;
@@ -825,6 +1875,12 @@ namespace hpx { namespace lcos { namespace local
         send_channel(one_element_channel<T> const& c)
           : base_type(c.get_channel_impl())
         {}
+        send_channel(bounded_channel<T> const& c)
+          : base_type(c.get_channel_impl())
+        {}
+        send_channel(spsc_channel<T> const& c)
+          : base_type(c.get_channel_impl())
+        {}
 
         using base_type::set;
         using base_type::close;
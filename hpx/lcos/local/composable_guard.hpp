@@ -28,13 +28,23 @@
 //        delete t
 //
 //  def run_task(t):
-//    t.run() // call the task
-//    zero = nullptr
-//    if t.next.compare_exchange_strong(zero,t):
-//      pass
-//    else:
-//      run_task(zero)
+//    count = 0
+//    while True:
+//      t.run() // call the task
+//      zero = nullptr
+//      if t.next.compare_exchange_strong(zero,t):
+//        return
 //      delete t
+//      t = zero
+//      if count == g.max_combined:
+//        apply(run_task, t) // hand the remaining tasks to a new thread
+//        return
+//      count += 1
+//
+//  The thread which acquired the guard executes the tasks queued in the
+//  meantime (flat combining) until either no more tasks are pending or
+//  g.max_combined tasks have been run. This keeps the guarded data in the
+//  cache of a single core and avoids spawning a thread per guarded task.
 //
 // Consider cases. Thread A, B, and C on guard g.
 // Case 1:
@@ -136,7 +146,14 @@ namespace hpx { namespace lcos { namespace local
     public:
         detail::guard_atomic task;
 
-        guard() : task(nullptr) {}
+        // the maximum number of queued tasks a thread runs after the one it
+        // acquired the guard for, before handing the guard to a new thread
+        std::size_t const max_combined;
+
+        guard() : task(nullptr), max_combined(std::size_t(-1)) {}
+        explicit guard(std::size_t max_combined_)
+          : task(nullptr), max_combined(max_combined_)
+        {}
         HPX_API_EXPORT ~guard();
     };
 
@@ -28,9 +28,6 @@ namespace hpx { namespace lcos { namespace local { namespace detail
     public:
         HPX_NON_COPYABLE(condition_variable);
 
-    private:
-        typedef lcos::local::spinlock mutex_type;
-
     private:
         // define data structures needed for intrusive slist container used for
         // the queues
@@ -80,59 +77,73 @@ namespace hpx { namespace lcos { namespace local { namespace detail
         };
 
     public:
+        // The functions taking a lock are instantiated for all of the
+        // spinlocks provided by HPX (spinlock, ticket_spinlock and
+        // mcs_spinlock), see condition_variable.cpp.
         HPX_EXPORT condition_variable();
 
         HPX_EXPORT ~condition_variable();
 
+        template <typename Mutex>
         HPX_EXPORT bool empty(
-            std::unique_lock<mutex_type> const& lock) const;
+            std::unique_lock<Mutex> const& lock) const;
 
+        template <typename Mutex>
         HPX_EXPORT std::size_t size(
-            std::unique_lock<mutex_type> const& lock) const;
+            std::unique_lock<Mutex> const& lock) const;
 
         // Return false if no more threads are waiting (returns true if queue
         // is non-empty).
-        HPX_EXPORT bool notify_one(std::unique_lock<mutex_type> lock,
+        template <typename Mutex>
+        HPX_EXPORT bool notify_one(std::unique_lock<Mutex> lock,
             threads::thread_priority priority, error_code& ec = throws);
 
-        HPX_EXPORT void notify_all(std::unique_lock<mutex_type> lock,
+        template <typename Mutex>
+        HPX_EXPORT void notify_all(std::unique_lock<Mutex> lock,
             threads::thread_priority priority, error_code& ec = throws);
 
-        bool notify_one(std::unique_lock<mutex_type> lock,
+        template <typename Mutex>
+        bool notify_one(std::unique_lock<Mutex> lock,
             error_code& ec = throws)
         {
             return notify_one(std::move(lock),
                 threads::thread_priority_default, ec);
         }
 
-        void notify_all(std::unique_lock<mutex_type> lock,
+        template <typename Mutex>
+        void notify_all(std::unique_lock<Mutex> lock,
             error_code& ec = throws)
         {
             return notify_all(std::move(lock),
                 threads::thread_priority_default, ec);
         }
 
+        template <typename Mutex>
         HPX_EXPORT void abort_all(
-            std::unique_lock<mutex_type> lock);
+            std::unique_lock<Mutex> lock);
 
+        template <typename Mutex>
         HPX_EXPORT threads::thread_state_ex_enum wait(
-            std::unique_lock<mutex_type>& lock,
+            std::unique_lock<Mutex>& lock,
             char const* description, error_code& ec = throws);
 
+        template <typename Mutex>
         threads::thread_state_ex_enum wait(
-            std::unique_lock<mutex_type>& lock,
+            std::unique_lock<Mutex>& lock,
             error_code& ec = throws)
         {
             return wait(lock, "condition_variable::wait", ec);
         }
 
+        template <typename Mutex>
         HPX_EXPORT threads::thread_state_ex_enum wait_until(
-            std::unique_lock<mutex_type>& lock,
+            std::unique_lock<Mutex>& lock,
             util::steady_time_point const& abs_time,
             char const* description, error_code& ec = throws);
 
+        template <typename Mutex>
         threads::thread_state_ex_enum wait_until(
-            std::unique_lock<mutex_type>& lock,
+            std::unique_lock<Mutex>& lock,
             util::steady_time_point const& abs_time,
             error_code& ec = throws)
         {
@@ -140,16 +151,18 @@ namespace hpx { namespace lcos { namespace local { namespace detail
                 "condition_variable::wait_until", ec);
         }
 
+        template <typename Mutex>
         threads::thread_state_ex_enum wait_for(
-            std::unique_lock<mutex_type>& lock,
+            std::unique_lock<Mutex>& lock,
             util::steady_duration const& rel_time,
             char const* description, error_code& ec = throws)
         {
             return wait_until(lock, rel_time.from_now(), description, ec);
         }
 
+        template <typename Mutex>
         threads::thread_state_ex_enum wait_for(
-            std::unique_lock<mutex_type>& lock,
+            std::unique_lock<Mutex>& lock,
             util::steady_duration const& rel_time,
             error_code& ec = throws)
         {
@@ -158,12 +171,10 @@ namespace hpx { namespace lcos { namespace local { namespace detail
         }
 
     private:
-        template <typename Mutex>
-        void abort_all(std::unique_lock<Mutex> lock);
-
         // re-add the remaining items to the original queue
-        HPX_EXPORT void prepend_entries(
-            std::unique_lock<mutex_type>& lock, queue_type& queue);
+        template <typename Mutex>
+        void prepend_entries(
+            std::unique_lock<Mutex>& lock, queue_type& queue);
 
     private:
         queue_type queue_;
@@ -0,0 +1,32 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_LCOS_LOCAL_DETAIL_SHARED_STATE_MUTEX_HPP
+#define HPX_LCOS_LOCAL_DETAIL_SHARED_STATE_MUTEX_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_LCOS_TICKET_SPINLOCK)
+#include <hpx/lcos/local/ticket_spinlock.hpp>
+#elif defined(HPX_HAVE_LCOS_MCS_SPINLOCK)
+#include <hpx/lcos/local/mcs_spinlock.hpp>
+#else
+#include <hpx/lcos/local/spinlock.hpp>
+#endif
+
+namespace hpx { namespace lcos { namespace local { namespace detail
+{
+    // The lock protecting the shared state of futures and the default lock
+    // of the local channels, selected using HPX_WITH_LCOS_SPINLOCK.
+#if defined(HPX_HAVE_LCOS_TICKET_SPINLOCK)
+    typedef lcos::local::ticket_spinlock shared_state_mutex;
+#elif defined(HPX_HAVE_LCOS_MCS_SPINLOCK)
+    typedef lcos::local::mcs_spinlock shared_state_mutex;
+#else
+    typedef lcos::local::spinlock shared_state_mutex;
+#endif
+}}}}
+
+#endif
@@ -0,0 +1,75 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_LCOS_LOCAL_DETAIL_SPINLOCK_STATISTICS_HPP
+#define HPX_LCOS_LOCAL_DETAIL_SPINLOCK_STATISTICS_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_SPINLOCK_COUNTERS)
+#include <hpx/util/high_resolution_clock.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace hpx { namespace lcos { namespace local { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The statistics collected for all spinlocks sharing the same
+    // description.
+    struct spinlock_statistics
+    {
+        spinlock_statistics()
+          : acquisitions_(0), contentions_(0), spin_time_(0)
+        {}
+
+        std::atomic<std::int64_t> acquisitions_;
+        std::atomic<std::int64_t> contentions_;
+        std::atomic<std::int64_t> spin_time_;       // [ns]
+    };
+
+    // Return the statistics for spinlocks with the given description, the
+    // returned object lives until the end of the program.
+    HPX_EXPORT spinlock_statistics* get_spinlock_statistics(char const* desc);
+
+    // Records a single acquisition of a spinlock
+    class spinlock_acquisition
+    {
+    public:
+        explicit spinlock_acquisition(spinlock_statistics* statistics)
+          : statistics_(statistics), start_(0)
+        {}
+
+        ~spinlock_acquisition()
+        {
+            ++statistics_->acquisitions_;
+            if (start_ != 0)
+            {
+                ++statistics_->contentions_;
+                statistics_->spin_time_ += static_cast<std::int64_t>(
+                    util::high_resolution_clock::now() - start_);
+            }
+        }
+
+        // to be called for each unsuccessful attempt to acquire the lock
+        void contended()
+        {
+            if (start_ == 0)
+                start_ = util::high_resolution_clock::now();
+        }
+
+    private:
+        spinlock_statistics* statistics_;
+        std::uint64_t start_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Install the performance counter types exposing the spinlock
+    // statistics.
+    HPX_EXPORT void register_spinlock_counter_types();
+}}}}
+#endif
+
+#endif /*HPX_LCOS_LOCAL_DETAIL_SPINLOCK_STATISTICS_HPP*/
@@ -18,7 +18,7 @@
 #include <hpx/traits/future_access.hpp>
 #include <hpx/util/allocator_deleter.hpp>
 #include <hpx/util/deferred_call.hpp>
-#include <hpx/util/internal_allocator.hpp>
+#include <hpx/util/pooled_allocator.hpp>
 #include <hpx/util/thread_description.hpp>
 
 #include <hpx/parallel/executors/execution.hpp>
@@ -706,13 +706,13 @@ namespace hpx { namespace lcos { namespace local
                 futures_factory>::value>::type>
         explicit futures_factory(F&& f)
           : task_(detail::create_task_object<Result, Cancelable>::call(
-                hpx::util::internal_allocator<>{}, std::forward<F>(f)))
+                hpx::util::pooled_allocator<>{}, std::forward<F>(f)))
           , future_obtained_(false)
         {}
 
         explicit futures_factory(Result (*f)())
           : task_(detail::create_task_object<Result, Cancelable>::call(
-                hpx::util::internal_allocator<>{}, f)),
+                hpx::util::pooled_allocator<>{}, f)),
             future_obtained_(false)
         {}
 
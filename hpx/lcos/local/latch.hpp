@@ -12,6 +12,7 @@
 #include <hpx/lcos/local/spinlock.hpp>
 #include <hpx/util/assert.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <mutex>
 #include <utility>
@@ -32,6 +33,10 @@ namespace hpx { namespace lcos { namespace local
     /// Calls to countdown_and_wait() , count_down() , wait() , and is_ready()
     /// behave as atomic operations.
     ///
+    /// The counter is maintained without holding a lock, the internal mutex is
+    /// acquired only by the thread bringing counter_ to zero and by threads
+    /// which have to block.
+    ///
     /// \note   A \a local::latch is not a LCO in the sense that it has no
     ///         global id and it can't be triggered using the action (parcel)
     ///         mechanism. Use lcos::latch instead if this is required.
@@ -69,7 +74,7 @@ namespace hpx { namespace lcos { namespace local
         ~latch ()
         {
             std::unique_lock<mutex_type> l(mtx_);
-            HPX_ASSERT(counter_ == 0);
+            HPX_ASSERT(counter_.load(std::memory_order_relaxed) == 0);
         }
 
         /// Decrements counter_ by 1 . Blocks at the synchronization point
@@ -84,13 +89,19 @@ namespace hpx { namespace lcos { namespace local
         ///
         void count_down_and_wait()
         {
+            if (try_count_down(1))
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+                if (counter_.load(std::memory_order_acquire) != 0)
+                    cond_.wait(l, "hpx::local::latch::count_down_and_wait");
+                return;
+            }
+
             std::unique_lock<mutex_type> l(mtx_);
-            HPX_ASSERT(counter_ > 0);
+            HPX_ASSERT(counter_.load(std::memory_order_relaxed) == 1);
 
-            if (--counter_ == 0)
-                cond_.notify_all(std::move(l));    // release the threads
-            else
-                cond_.wait(l, "hpx::local::latch::count_down_and_wait");
+            counter_.store(0, std::memory_order_release);
+            cond_.notify_all(std::move(l));    // release the threads
         }
 
         /// Decrements counter_ by n. Does not block.
@@ -106,11 +117,14 @@ namespace hpx { namespace lcos { namespace local
         {
             HPX_ASSERT(n >= 0);
 
+            if (n == 0 || try_count_down(n))
+                return;
+
             std::unique_lock<mutex_type> l(mtx_);
-            HPX_ASSERT(counter_ >= n);
+            HPX_ASSERT(counter_.load(std::memory_order_relaxed) == n);
 
-            if ((counter_ -= n) == 0)
-                cond_.notify_all(std::move(l));    // release the threads
+            counter_.store(0, std::memory_order_release);
+            cond_.notify_all(std::move(l));    // release the threads
         }
 
         /// Returns: counter_ == 0. Does not block.
@@ -119,8 +133,7 @@ namespace hpx { namespace lcos { namespace local
         ///
         bool is_ready() const noexcept
         {
-            std::unique_lock<mutex_type> l(mtx_);
-            return counter_ == 0;
+            return counter_.load(std::memory_order_acquire) == 0;
         }
 
         /// If counter_ is 0, returns immediately. Otherwise, blocks the
@@ -131,8 +144,11 @@ namespace hpx { namespace lcos { namespace local
         ///
         void wait() const
         {
+            if (counter_.load(std::memory_order_acquire) == 0)
+                return;
+
             std::unique_lock<mutex_type> l(mtx_);
-            if (counter_ > 0)
+            if (counter_.load(std::memory_order_acquire) != 0)
                 cond_.wait(l, "hpx::local::latch::wait");
         }
 
@@ -143,7 +159,26 @@ namespace hpx { namespace lcos { namespace local
         }
 
     private:
-        std::ptrdiff_t counter_;
+        // Decrement counter_ by n unless this would bring it to zero. The
+        // final decrement is performed while holding the mutex, this allows
+        // the destructor to wait for blocked threads to be notified.
+        bool try_count_down(std::ptrdiff_t n)
+        {
+            std::ptrdiff_t counter = counter_.load(std::memory_order_relaxed);
+            while (counter > n)
+            {
+                if (counter_.compare_exchange_weak(counter, counter - n,
+                        std::memory_order_acq_rel))
+                {
+                    return true;
+                }
+            }
+            HPX_ASSERT(counter == n);
+            return false;
+        }
+
+    private:
+        std::atomic<std::ptrdiff_t> counter_;
         mutable mutex_type mtx_;
         mutable local::detail::condition_variable cond_;
     };
@@ -0,0 +1,200 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_LCOS_LOCAL_MCS_SPINLOCK_HPP
+#define HPX_LCOS_LOCAL_MCS_SPINLOCK_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/local/detail/spinlock_statistics.hpp>
+#include <hpx/runtime/threads/thread_helpers.hpp>
+#include <hpx/util/detail/yield_k.hpp>
+#include <hpx/util/itt_notify.hpp>
+#include <hpx/util/register_locks.hpp>
+
+#include <atomic>
+#include <cstddef>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace lcos { namespace local
+{
+    // std::mutex-compatible queue lock (MCS lock). Waiting threads form a
+    // queue and each of them spins on a flag of its own, the lock is handed
+    // over directly to the next waiting thread. This is the variant which
+    // does not need a queue node to be passed to unlock() (see M. Scott,
+    // "Shared-Memory Synchronization", K42 MCS lock): the queue node of a
+    // waiting thread lives on its stack and is not referenced anymore once
+    // the thread has acquired the lock.
+    struct mcs_spinlock
+    {
+    public:
+        HPX_NON_COPYABLE(mcs_spinlock);
+
+    private:
+        struct node
+        {
+            // for the lock itself: the last thread in the queue (or the lock
+            // if it is held without waiting threads), for waiting threads:
+            // waiting() until the lock is handed over
+            std::atomic<node*> tail_;
+
+            // the next thread in the queue
+            std::atomic<node*> next_;
+        };
+
+        static node* waiting()
+        {
+            return reinterpret_cast<node*>(std::size_t(1));
+        }
+
+        node q_;
+#if defined(HPX_HAVE_SPINLOCK_COUNTERS)
+        detail::spinlock_statistics* statistics_;
+#endif
+
+    public:
+        mcs_spinlock(char const* const desc = "hpx::lcos::local::mcs_spinlock")
+#if defined(HPX_HAVE_SPINLOCK_COUNTERS)
+          : statistics_(detail::get_spinlock_statistics(desc))
+#endif
+        {
+            q_.tail_.store(nullptr, std::memory_order_relaxed);
+            q_.next_.store(nullptr, std::memory_order_relaxed);
+
+            HPX_ITT_SYNC_CREATE(this, desc, "");
+        }
+
+        ~mcs_spinlock()
+        {
+            HPX_ITT_SYNC_DESTROY(this);
+        }
+
+        void lock()
+        {
+            HPX_ITT_SYNC_PREPARE(this);
+
+#if defined(HPX_HAVE_SPINLOCK_COUNTERS)
+            detail::spinlock_acquisition acquisition(statistics_);
+#endif
+            while (true)
+            {
+                node* prev = q_.tail_.load(std::memory_order_relaxed);
+                if (prev == nullptr)
+                {
+                    // the lock appears to be free
+                    if (q_.tail_.compare_exchange_strong(prev, &q_))
+                        break;
+                    continue;
+                }
+
+#if defined(HPX_HAVE_SPINLOCK_COUNTERS)
+                acquisition.contended();
+#endif
+                // the lock is held, enqueue this thread
+                node n;
+                n.tail_.store(waiting(), std::memory_order_relaxed);
+                n.next_.store(nullptr, std::memory_order_relaxed);
+
+                if (!q_.tail_.compare_exchange_strong(prev, &n))
+                    continue;
+
+                prev->next_.store(&n, std::memory_order_release);
+
+                for (std::size_t k = 0;
+                     n.tail_.load(std::memory_order_acquire) == waiting(); ++k)
+                {
+                    util::detail::yield_k(k,
+                        "hpx::lcos::local::mcs_spinlock::lock",
+                        hpx::threads::pending_boost);
+                }
+
+                // this thread owns the lock now, make the lock refer to the
+                // next waiting thread as n is about to go out of scope
+                node* succ = n.next_.load(std::memory_order_acquire);
+                if (succ == nullptr)
+                {
+                    q_.next_.store(nullptr, std::memory_order_relaxed);
+
+                    node* expected = &n;
+                    if (!q_.tail_.compare_exchange_strong(expected, &q_))
+                    {
+                        // another thread is about to link itself to n
+                        for (std::size_t k = 0;
+                             (succ = n.next_.load(std::memory_order_acquire))
+                                == nullptr;
+                             ++k)
+                        {
+                            util::detail::yield_k(k,
+                                "hpx::lcos::local::mcs_spinlock::lock",
+                                hpx::threads::pending_boost);
+                        }
+                        q_.next_.store(succ, std::memory_order_relaxed);
+                    }
+                }
+                else
+                {
+                    q_.next_.store(succ, std::memory_order_relaxed);
+                }
+                break;
+            }
+
+            HPX_ITT_SYNC_ACQUIRED(this);
+            util::register_lock(this);
+        }
+
+        bool try_lock()
+        {
+            HPX_ITT_SYNC_PREPARE(this);
+
+            node* expected = nullptr;
+            if (q_.tail_.compare_exchange_strong(expected, &q_))
+            {
+#if defined(HPX_HAVE_SPINLOCK_COUNTERS)
+                ++statistics_->acquisitions_;
+#endif
+                HPX_ITT_SYNC_ACQUIRED(this);
+                util::register_lock(this);
+                return true;
+            }
+
+            HPX_ITT_SYNC_CANCEL(this);
+            return false;
+        }
+
+        void unlock()
+        {
+            HPX_ITT_SYNC_RELEASING(this);
+            util::unregister_lock(this);
+
+            node* succ = q_.next_.load(std::memory_order_acquire);
+            if (succ == nullptr)
+            {
+                node* expected = &q_;
+                if (q_.tail_.compare_exchange_strong(expected, nullptr))
+                {
+                    HPX_ITT_SYNC_RELEASED(this);
+                    return;
+                }
+
+                // another thread is about to enqueue itself
+                for (std::size_t k = 0;
+                     (succ = q_.next_.load(std::memory_order_acquire))
+                        == nullptr;
+                     ++k)
+                {
+                    util::detail::yield_k(k,
+                        "hpx::lcos::local::mcs_spinlock::unlock",
+                        hpx::threads::pending_boost);
+                }
+            }
+
+            // hand the lock over to the next waiting thread
+            succ->tail_.store(nullptr, std::memory_order_release);
+
+            HPX_ITT_SYNC_RELEASED(this);
+        }
+    };
+}}}
+
+#endif /*HPX_LCOS_LOCAL_MCS_SPINLOCK_HPP*/
@@ -12,6 +12,8 @@
 #include <hpx/lcos/detail/future_data.hpp>
 #include <hpx/lcos/future.hpp>
 #include <hpx/runtime/launch_policy.hpp>
+#include <hpx/runtime/threads/thread_data_fwd.hpp>
+#include <hpx/runtime/threads/thread_helpers.hpp>
 #include <hpx/throw_exception.hpp>
 #include <hpx/traits/future_access.hpp>
 #include <hpx/traits/future_traits.hpp>
@@ -271,6 +273,23 @@ namespace hpx { namespace lcos { namespace detail
             run(std::move(f), priority, throws);
         }
 
+        // run inline if possible, schedule a new thread otherwise
+        void run_adaptive(
+            typename traits::detail::shared_state_ptr_for<
+                Future
+            >::type && f, threads::thread_priority priority)
+        {
+            if (can_run_inline_continuation())
+            {
+                handle_continuation_recursion_count cnt;
+                run(std::move(f), priority, throws);
+            }
+            else
+            {
+                async(std::move(f), priority, throws);
+            }
+        }
+
     protected:
         threads::thread_result_type
         async_impl(
@@ -332,10 +351,26 @@ namespace hpx { namespace lcos { namespace detail
             hpx::util::thread_description desc(async_impl_ptr,
                 "hpx::parallel::execution::parallel_executor::post");
 
-            parallel::execution::detail::post_policy_dispatch<
-                    hpx::launch::async_policy
-                >::call(desc, hpx::launch::async, async_impl_ptr,
-                    std::move(this_), std::move(f));
+            // If requested, the continuation is run on the worker thread
+            // which made the future ready, its input is most likely still in
+            // that worker's caches.
+            threads::thread_schedule_hint hint =
+                threads::get_self_default_affinity_hint();
+            if (hint.mode == threads::thread_schedule_hint_mode_none)
+            {
+                parallel::execution::detail::post_policy_dispatch<
+                        hpx::launch::async_policy
+                    >::call(desc, hpx::launch::async, async_impl_ptr,
+                        std::move(this_), std::move(f));
+            }
+            else
+            {
+                threads::register_thread_nullary(
+                    util::deferred_call(async_impl_ptr,
+                        std::move(this_), std::move(f)),
+                    desc, threads::pending, false,
+                    hpx::launch::async.priority(), hint);
+            }
 
             if (&ec != &throws)
                 ec = make_success_code();
@@ -460,7 +495,9 @@ namespace hpx { namespace lcos { namespace detail
                     [HPX_CAPTURE_MOVE(this_)](
                         shared_state_ptr && f, launch policy)
                     {
-                        if (hpx::detail::has_async_policy(policy))
+                        if (policy == launch::adaptive)
+                            this_->run_adaptive(std::move(f), policy.priority());
+                        else if (hpx::detail::has_async_policy(policy))
                             this_->async(std::move(f), policy.priority());
                         else
                             this_->run(std::move(f), policy.priority());
@@ -0,0 +1,122 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_LCOS_LOCAL_SCALABLE_SHARED_MUTEX_HPP
+#define HPX_LCOS_LOCAL_SCALABLE_SHARED_MUTEX_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/local/detail/condition_variable.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/runtime/get_worker_thread_num.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace hpx { namespace lcos { namespace local
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // A reader-writer lock optimized for read-mostly data. Readers announce
+    // themselves by incrementing a counter which is private to the worker
+    // thread they are running on, acquiring a shared lock does not touch any
+    // cache line shared with readers running on other worker threads as
+    // long as no writer is active. A writer blocks new readers and waits
+    // for the sum of all reader counters to drop to zero. Pending writers
+    // are preferred over new readers.
+    //
+    // Readers and writers which have to wait are suspended.
+    //
+    // Note: HPX threads may migrate between worker threads while holding a
+    //       shared lock, a reader therefore decrements the counter of the
+    //       worker thread it is running on when unlocking, which is not
+    //       necessarily the one it has incremented. Only the sum of all
+    //       counters is meaningful.
+    class scalable_shared_mutex
+    {
+    public:
+        HPX_NON_COPYABLE(scalable_shared_mutex);
+
+    private:
+        typedef lcos::local::spinlock mutex_type;
+
+        struct reader_slot
+        {
+            reader_slot()
+              : count_(0)
+            {}
+
+            std::atomic<std::int64_t> count_;
+
+            // avoid false sharing between neighboring workers
+            char pad_[64];
+        };
+
+    public:
+        HPX_EXPORT scalable_shared_mutex();
+        HPX_EXPORT ~scalable_shared_mutex();
+
+        ///////////////////////////////////////////////////////////////////////
+        void lock_shared()
+        {
+            if (!try_lock_shared())
+                lock_shared_slow();
+        }
+
+        bool try_lock_shared()
+        {
+            reader_slot& slot = get_slot();
+            ++slot.count_;
+            if (!writer_.load())
+                return true;
+
+            // back off, a writer might have seen our counter already
+            --slot.count_;
+            notify_writer();
+            return false;
+        }
+
+        void unlock_shared()
+        {
+            --get_slot().count_;
+            if (writer_.load())
+                notify_writer();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        HPX_EXPORT void lock();
+        HPX_EXPORT bool try_lock();
+        HPX_EXPORT void unlock();
+
+    private:
+        reader_slot& get_slot()
+        {
+            // threads not managed by HPX share the last slot
+            std::size_t const num_thread = hpx::get_worker_thread_num();
+            if (num_thread == std::size_t(-1))
+                return slots_[num_slots_ - 1];
+            return slots_[num_thread % (num_slots_ - 1)];
+        }
+
+        HPX_EXPORT void lock_shared_slow();
+        HPX_EXPORT void notify_writer();
+        HPX_EXPORT std::int64_t count_readers() const;
+
+    private:
+        std::size_t const num_slots_;
+        std::unique_ptr<reader_slot[]> slots_;
+
+        // set while a writer holds or is acquiring the lock
+        std::atomic<bool> writer_;
+
+        // slow path, only used by writers and suspended readers
+        mutable mutex_type mtx_;
+        detail::condition_variable readers_cond_;
+        detail::condition_variable writers_cond_;
+        detail::condition_variable readers_done_cond_;
+    };
+}}}
+
+#endif /*HPX_LCOS_LOCAL_SCALABLE_SHARED_MUTEX_HPP*/
@@ -14,6 +14,7 @@
 
 #include <hpx/config.hpp>
 
+#include <hpx/lcos/local/detail/spinlock_statistics.hpp>
 #include <hpx/runtime/threads/thread_helpers.hpp>
 #include <hpx/util/detail/yield_k.hpp>
 #include <hpx/util/itt_notify.hpp>
@@ -51,10 +52,16 @@ namespace hpx { namespace lcos { namespace local
 #else
         std::uint64_t v_;
 #endif
+#if defined(HPX_HAVE_SPINLOCK_COUNTERS)
+        detail::spinlock_statistics* statistics_;
+#endif
 
     public:
         spinlock(char const* const desc = "hpx::lcos::local::spinlock")
           : v_(0)
+#if defined(HPX_HAVE_SPINLOCK_COUNTERS)
+          , statistics_(detail::get_spinlock_statistics(desc))
+#endif
         {
             HPX_ITT_SYNC_CREATE(this, desc, "");
         }
@@ -68,8 +75,14 @@ namespace hpx { namespace lcos { namespace local
         {
             HPX_ITT_SYNC_PREPARE(this);
 
+#if defined(HPX_HAVE_SPINLOCK_COUNTERS)
+            detail::spinlock_acquisition acquisition(statistics_);
+#endif
             for (std::size_t k = 0; !acquire_lock(); ++k)
             {
+#if defined(HPX_HAVE_SPINLOCK_COUNTERS)
+                acquisition.contended();
+#endif
                 util::detail::yield_k(k, "hpx::lcos::local::spinlock::lock",
                     hpx::threads::pending_boost);
             }
@@ -85,6 +98,9 @@ namespace hpx { namespace lcos { namespace local
             bool r = acquire_lock(); //-V707
 
             if (r) {
+#if defined(HPX_HAVE_SPINLOCK_COUNTERS)
+                ++statistics_->acquisitions_;
+#endif
                 HPX_ITT_SYNC_ACQUIRED(this);
                 util::register_lock(this);
                 return true;
@@ -7,8 +7,8 @@
 #define HPX_LCOS_LOCAL_SPMD_BLOCK_HPP
 
 #include <hpx/lcos/future.hpp>
-#include <hpx/lcos/local/barrier.hpp>
 #include <hpx/lcos/local/mutex.hpp>
+#include <hpx/lcos/local/tree_barrier.hpp>
 #include <hpx/parallel/execution_policy.hpp>
 #include <hpx/traits/is_execution_policy.hpp>
 #include <hpx/traits/is_iterator.hpp>
@@ -19,6 +19,7 @@
 
 #include <cstddef>
 #include <functional>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -41,7 +42,7 @@ namespace hpx { namespace lcos { namespace local
     struct spmd_block
     {
     private:
-        using barrier_type = hpx::lcos::local::barrier;
+        using barrier_type = hpx::lcos::local::tree_barrier;
         using table_type =
             std::map<std::set<std::size_t>,std::shared_ptr<barrier_type>>;
         using mutex_type = hpx::lcos::local::mutex;
@@ -74,7 +75,7 @@ namespace hpx { namespace lcos { namespace local
 
         void sync_all() const
         {
-           barrier_.get().wait();
+           barrier_.get().wait(image_id_);
         }
 
         void sync_images(std::set<std::size_t> const & images) const
@@ -96,9 +97,11 @@ namespace hpx { namespace lcos { namespace local
                 }
             }
 
-            if( images.find(image_id_) != images.end() )
+            auto image = images.find(image_id_);
+            if( image != images.end() )
             {
-                it->second->wait();
+                it->second->wait(
+                    std::distance(images.begin(), image));
             }
         }
 
@@ -144,7 +147,7 @@ namespace hpx { namespace lcos { namespace local
         struct spmd_block_helper
         {
         private:
-            using barrier_type = hpx::lcos::local::barrier;
+            using barrier_type = hpx::lcos::local::tree_barrier;
             using table_type =
                 std::map<std::set<std::size_t>,std::shared_ptr<barrier_type>>;
             using mutex_type = hpx::lcos::local::mutex;
@@ -188,7 +191,7 @@ namespace hpx { namespace lcos { namespace local
         using executor_type =
             typename hpx::util::decay<ExPolicy>::type::executor_type;
 
-        using barrier_type = hpx::lcos::local::barrier;
+        using barrier_type = hpx::lcos::local::tree_barrier;
         using table_type =
             std::map<std::set<std::size_t>,std::shared_ptr<barrier_type>>;
         using mutex_type = hpx::lcos::local::mutex;
@@ -233,7 +236,7 @@ namespace hpx { namespace lcos { namespace local
         using executor_type =
             typename hpx::util::decay<ExPolicy>::type::executor_type;
 
-        using barrier_type = hpx::lcos::local::barrier;
+        using barrier_type = hpx::lcos::local::tree_barrier;
         using table_type =
             std::map<std::set<std::size_t>,std::shared_ptr<barrier_type>>;
         using mutex_type = hpx::lcos::local::mutex;
@@ -0,0 +1,119 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_LCOS_LOCAL_TICKET_SPINLOCK_HPP
+#define HPX_LCOS_LOCAL_TICKET_SPINLOCK_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/local/detail/spinlock_statistics.hpp>
+#include <hpx/runtime/threads/thread_helpers.hpp>
+#include <hpx/util/detail/yield_k.hpp>
+#include <hpx/util/itt_notify.hpp>
+#include <hpx/util/register_locks.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace lcos { namespace local
+{
+    // std::mutex-compatible ticket lock, the lock is granted in the order of
+    // the calls to lock(). Waiting threads only read the shared state while
+    // spinning.
+    //
+    // Note: a waiting thread which has been suspended delays all threads
+    //       arriving after it.
+    struct ticket_spinlock
+    {
+    public:
+        HPX_NON_COPYABLE(ticket_spinlock);
+
+    private:
+        std::atomic<std::uint32_t> next_ticket_;
+        std::atomic<std::uint32_t> now_serving_;
+#if defined(HPX_HAVE_SPINLOCK_COUNTERS)
+        detail::spinlock_statistics* statistics_;
+#endif
+
+    public:
+        ticket_spinlock(
+                char const* const desc = "hpx::lcos::local::ticket_spinlock")
+          : next_ticket_(0), now_serving_(0)
+#if defined(HPX_HAVE_SPINLOCK_COUNTERS)
+          , statistics_(detail::get_spinlock_statistics(desc))
+#endif
+        {
+            HPX_ITT_SYNC_CREATE(this, desc, "");
+        }
+
+        ~ticket_spinlock()
+        {
+            HPX_ITT_SYNC_DESTROY(this);
+        }
+
+        void lock()
+        {
+            HPX_ITT_SYNC_PREPARE(this);
+
+#if defined(HPX_HAVE_SPINLOCK_COUNTERS)
+            detail::spinlock_acquisition acquisition(statistics_);
+#endif
+            std::uint32_t const ticket =
+                next_ticket_.fetch_add(1, std::memory_order_relaxed);
+
+            for (std::size_t k = 0;
+                 now_serving_.load(std::memory_order_acquire) != ticket; ++k)
+            {
+#if defined(HPX_HAVE_SPINLOCK_COUNTERS)
+                acquisition.contended();
+#endif
+                util::detail::yield_k(k,
+                    "hpx::lcos::local::ticket_spinlock::lock",
+                    hpx::threads::pending_boost);
+            }
+
+            HPX_ITT_SYNC_ACQUIRED(this);
+            util::register_lock(this);
+        }
+
+        bool try_lock()
+        {
+            HPX_ITT_SYNC_PREPARE(this);
+
+            // the lock is free if nobody has drawn a ticket which is not
+            // served yet
+            std::uint32_t ticket = now_serving_.load(std::memory_order_relaxed);
+            if (next_ticket_.compare_exchange_strong(ticket, ticket + 1,
+                    std::memory_order_acquire, std::memory_order_relaxed))
+            {
+#if defined(HPX_HAVE_SPINLOCK_COUNTERS)
+                ++statistics_->acquisitions_;
+#endif
+                HPX_ITT_SYNC_ACQUIRED(this);
+                util::register_lock(this);
+                return true;
+            }
+
+            HPX_ITT_SYNC_CANCEL(this);
+            return false;
+        }
+
+        void unlock()
+        {
+            HPX_ITT_SYNC_RELEASING(this);
+
+            // only the owner modifies now_serving_
+            now_serving_.store(
+                now_serving_.load(std::memory_order_relaxed) + 1,
+                std::memory_order_release);
+
+            HPX_ITT_SYNC_RELEASED(this);
+            util::unregister_lock(this);
+        }
+    };
+}}}
+
+#endif /*HPX_LCOS_LOCAL_TICKET_SPINLOCK_HPP*/
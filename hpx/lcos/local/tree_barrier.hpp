@@ -0,0 +1,112 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_LCOS_LOCAL_TREE_BARRIER_HPP
+#define HPX_LCOS_LOCAL_TREE_BARRIER_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/local/detail/condition_variable.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace lcos { namespace local
+{
+    /// A tree_barrier synchronizes a fixed number of threads, each of which
+    /// identifies itself by a unique rank in [0, number_of_threads).
+    ///
+    /// The participants are combined in a tree: a thread arrives at the leaf
+    /// its rank belongs to, only the last thread arriving at a node proceeds
+    /// to the parent node. The thread completing the root releases the nodes
+    /// it has completed on its way up, all threads released from a node in
+    /// turn release the nodes they have completed themselves. Arrival and
+    /// wakeup therefore never touch a cache line shared by more than a
+    /// handful of threads.
+    ///
+    /// By default the fan-in of the tree levels mirrors the machine topology
+    /// (processing units per core, cores per NUMA domain, NUMA domains per
+    /// socket, and sockets), which works best if neighboring ranks run on
+    /// neighboring processing units (for instance if the rank is the worker
+    /// thread number).
+    ///
+    /// \note   It is the caller's responsibility to ensure that no thread is
+    ///         still executing wait() when the barrier is destroyed.
+    class HPX_EXPORT tree_barrier
+    {
+    public:
+        HPX_NON_COPYABLE(tree_barrier);
+
+    private:
+        typedef lcos::local::spinlock mutex_type;
+
+        HPX_STATIC_CONSTEXPR std::size_t npos = std::size_t(-1);
+
+        struct node
+        {
+            node()
+              : arrived_(0), generation_(0), expected_(0), parent_(npos)
+            {}
+
+            std::atomic<std::size_t> arrived_;
+            std::atomic<std::size_t> generation_;
+            std::size_t expected_;
+            std::size_t parent_;
+
+            // slow path, only used by suspended threads
+            mutex_type mtx_;
+            detail::condition_variable cond_;
+
+            // avoid false sharing between neighboring nodes
+            char pad_[64];
+        };
+
+    public:
+        /// Create a barrier for \a number_of_threads threads, the fan-in of
+        /// the tree levels is derived from the machine topology.
+        explicit tree_barrier(std::size_t number_of_threads);
+
+        /// Create a barrier for \a number_of_threads threads, combining
+        /// \a fan_in nodes (or threads) on each tree level. A \a fan_in
+        /// smaller than two selects the default fan-in.
+        tree_barrier(std::size_t number_of_threads, std::size_t fan_in);
+
+        ~tree_barrier();
+
+        /// The function \a wait will block the calling thread until all
+        /// \a threads (as given by the constructor parameter
+        /// \a number_of_threads) have entered this function. Each thread has
+        /// to pass a different \a rank.
+        void wait(std::size_t rank);
+
+        /// Return the number of threads synchronized by this barrier.
+        std::size_t size() const
+        {
+            return number_of_threads_;
+        }
+
+    private:
+        void init(std::vector<std::size_t> const& fan_ins);
+
+        void wait_for_release(node& n, std::size_t generation);
+        void release(node& n);
+
+    private:
+        std::size_t const number_of_threads_;
+        std::size_t leaf_fan_in_;
+
+        std::size_t num_nodes_;
+        std::unique_ptr<node[]> nodes_;
+    };
+}}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif /*HPX_LCOS_LOCAL_TREE_BARRIER_HPP*/
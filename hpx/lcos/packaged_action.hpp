@@ -20,7 +20,7 @@
 #include <hpx/traits/extract_action.hpp>
 #include <hpx/util/assert.hpp>
 #include <hpx/util/bind_front.hpp>
-#include <hpx/util/internal_allocator.hpp>
+#include <hpx/util/pooled_allocator.hpp>
 #include <hpx/util/protect.hpp>
 
 #include <boost/asio/error.hpp>
@@ -236,7 +236,7 @@ namespace lcos {
         // use this instance its member function \a apply needs to be directly
         // called.
         packaged_action()
-          : base_type(std::allocator_arg, hpx::util::internal_allocator<>{})
+          : base_type(std::allocator_arg, hpx::util::pooled_allocator<>{})
         {
         }
 
@@ -369,7 +369,7 @@ namespace lcos {
         /// called.
         packaged_action()
           : packaged_action<Action, Result, false>(
-              std::allocator_arg, hpx::util::internal_allocator<>{})
+              std::allocator_arg, hpx::util::pooled_allocator<>{})
         {
         }
 
@@ -123,6 +123,7 @@ namespace hpx
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <functional>
 #include <iterator>
@@ -214,73 +215,63 @@ namespace hpx { namespace lcos
             typedef typename base_type::init_no_addref init_no_addref;
 
             wait_all_frame(Tuple const& t)
-              : t_(t)
+              : t_(t), outstanding_(1)
             {}
 
             wait_all_frame(init_no_addref no_addref, Tuple const& t)
-              : base_type(no_addref), t_(t)
+              : base_type(no_addref), t_(t), outstanding_(1)
             {}
 
         protected:
-            // End of the tuple is reached
-            template <std::size_t I>
-            HPX_FORCEINLINE
-            void do_await(std::true_type)
+            // Invoked once for each future which was not ready when it was
+            // visited and once after all futures have been visited. The last
+            // invocation makes this frame ready.
+            void on_future_ready()
             {
-                this->set_value(util::unused);     // simply make ourself ready
+                if (--outstanding_ == 0)
+                    this->set_value(util::unused);  // simply make ourself ready
             }
 
-            // Current element is a range (vector or array) of futures
-            template <std::size_t I, typename Iter>
-            void await_range(Iter next, Iter end)
+            template <typename SharedState>
+            HPX_FORCEINLINE
+            void await_future(SharedState const& next_future_data)
             {
-                typedef typename std::iterator_traits<Iter>::value_type
-                    future_type;
-                typedef typename detail::future_or_shared_state_result<
-                        future_type
-                    >::type future_result_type;
+                if (next_future_data.get() == nullptr ||
+                    next_future_data->is_ready())
+                {
+                    return;
+                }
 
-                void (wait_all_frame::*f)(Iter, Iter) =
-                    &wait_all_frame::await_range<I>;
+                next_future_data->execute_deferred();
 
-                for (/**/; next != end; ++next)
+                // execute_deferred might have made the future ready
+                if (!next_future_data->is_ready())
                 {
-                    typename traits::detail::shared_state_ptr<
-                        future_result_type
-                    >::type next_future_data =
-                        traits::detail::get_shared_state(*next);
-
-                    if (next_future_data.get() != nullptr &&
-                        !next_future_data->is_ready())
-                    {
-                        next_future_data->execute_deferred();
-
-                        // execute_deferred might have made the future ready
-                        if (!next_future_data->is_ready())
-                        {
-                            // Attach a continuation to this future which will
-                            // re-evaluate it and continue to the next element
-                            // in the sequence (if any).
-                            next_future_data->set_on_completed(
-                                util::deferred_call(f, this,
-                                    std::move(next), std::move(end)));
-                            return;
-                        }
-                    }
+                    // Count this future before attaching the continuation,
+                    // which might be invoked right away. The continuation
+                    // fits into the small object buffer of the callback.
+                    ++outstanding_;
+                    next_future_data->set_on_completed(
+                        [this]() { this->on_future_ready(); });
                 }
+            }
 
-                // All elements of the sequence are ready now, proceed to the
-                // next argument.
-                do_await<I + 1>(is_end<I + 1>());
+            // End of the tuple is reached
+            template <std::size_t I>
+            HPX_FORCEINLINE
+            void do_await(std::true_type)
+            {
             }
 
+            // Current element is a range (vector or array) of futures
             template <std::size_t I>
             HPX_FORCEINLINE
             void await_next(std::false_type, std::true_type)
             {
-                await_range<I>(
-                    util::begin(util::unwrap_ref(util::get<I>(t_))),
-                    util::end(util::unwrap_ref(util::get<I>(t_))));
+                for (auto const& f : util::unwrap_ref(util::get<I>(t_)))
+                    await_future(traits::detail::get_shared_state(f));
+
+                do_await<I + 1>(is_end<I + 1>());
             }
 
             // Current element is a simple future
@@ -288,38 +279,8 @@ namespace hpx { namespace lcos
             HPX_FORCEINLINE
             void await_next(std::true_type, std::false_type)
             {
-                typedef typename util::decay_unwrap<
-                    typename util::tuple_element<I, Tuple>::type
-                >::type future_type;
-
-                typedef typename detail::future_or_shared_state_result<
-                        future_type
-                    >::type future_result_type;
-
-                typename traits::detail::shared_state_ptr<
-                        future_result_type
-                    >::type next_future_data =
-                        traits::detail::get_shared_state(util::get<I>(t_));
-
-                if (next_future_data.get() != nullptr &&
-                    !next_future_data->is_ready())
-                {
-                    next_future_data->execute_deferred();
-
-                    // execute_deferred might have made the future ready
-                    if (!next_future_data->is_ready())
-                    {
-                        // Attach a continuation to this future which will
-                        // re-evaluate it and continue to the next argument
-                        // (if any).
-                        void (wait_all_frame::*f)(std::true_type, std::false_type) =
-                            &wait_all_frame::await_next<I>;
-
-                        next_future_data->set_on_completed(util::deferred_call(
-                            f, this, std::true_type(), std::false_type()));
-                        return;
-                    }
-                }
+                await_future(traits::detail::get_shared_state(
+                    util::get<I>(t_)));
 
                 do_await<I + 1>(is_end<I + 1>());
             }
@@ -343,9 +304,13 @@ namespace hpx { namespace lcos
             }
 
         public:
+            // Visit all futures at once, attaching a continuation to each
+            // of the futures which are not ready yet. This frame becomes
+            // ready once all of those continuations have been invoked.
             void wait_all()
             {
                 do_await<0>(is_end<0>());
+                on_future_ready();
 
                 // If there are still futures which are not ready, suspend and
                 // wait.
@@ -355,6 +320,7 @@ namespace hpx { namespace lcos
 
         private:
             Tuple const& t_;
+            std::atomic<std::size_t> outstanding_;
         };
     }
 
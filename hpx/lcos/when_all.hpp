@@ -144,12 +144,17 @@ namespace hpx
 #include <hpx/traits/future_access.hpp>
 #include <hpx/traits/is_future.hpp>
 #include <hpx/traits/is_future_range.hpp>
-#include <hpx/util/internal_allocator.hpp>
+#include <hpx/util/allocator_deleter.hpp>
 #include <hpx/util/pack_traversal_async.hpp>
+#include <hpx/util/pooled_allocator.hpp>
 #include <hpx/util/tuple.hpp>
 
+#include <boost/intrusive_ptr.hpp>
+
+#include <atomic>
 #include <cstddef>
 #include <iterator>
+#include <memory>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -225,6 +230,145 @@ namespace hpx { namespace lcos
             }
         };
 
+        ///////////////////////////////////////////////////////////////////////
+        // A range of futures is joined by attaching a continuation to all of
+        // the futures which are not ready yet at once, the last continuation
+        // to run makes the result ready.
+        template <typename Container>
+        class when_all_range_frame : public future_data<Container>
+        {
+        public:
+            typedef hpx::lcos::future<Container> type;
+            typedef hpx::lcos::detail::future_data<Container> base_type;
+
+            when_all_range_frame(typename base_type::init_no_addref no_addref,
+                    Container&& values)
+              : base_type(no_addref), values_(std::move(values)),
+                outstanding_(1)
+            {
+            }
+
+            void await()
+            {
+                // keep this frame alive until all continuations have run
+                intrusive_ptr_add_ref(this);
+
+                for (auto const& f : values_)
+                {
+                    auto const& next_future_data =
+                        traits::detail::get_shared_state(f);
+
+                    if (next_future_data.get() == nullptr ||
+                        next_future_data->is_ready())
+                    {
+                        continue;
+                    }
+
+                    next_future_data->execute_deferred();
+
+                    // execute_deferred might have made the future ready
+                    if (!next_future_data->is_ready())
+                    {
+                        // Count this future before attaching the continuation,
+                        // which might be invoked right away.
+                        ++outstanding_;
+                        next_future_data->set_on_completed(
+                            [this]() { this->on_future_ready(); });
+                    }
+                }
+
+                on_future_ready();
+            }
+
+        private:
+            void on_future_ready()
+            {
+                if (--outstanding_ == 0)
+                {
+                    this->set_value(std::move(values_));
+                    intrusive_ptr_release(this);
+                }
+            }
+
+        private:
+            Container values_;
+            std::atomic<std::size_t> outstanding_;
+        };
+
+        template <typename Allocator, typename Container>
+        class when_all_range_frame_allocator
+          : public when_all_range_frame<Container>
+        {
+            typedef when_all_range_frame<Container> base_type;
+
+            typedef typename
+                    std::allocator_traits<Allocator>::template
+                        rebind_alloc<when_all_range_frame_allocator>
+                other_allocator;
+
+        public:
+            typedef typename base_type::init_no_addref init_no_addref;
+
+            when_all_range_frame_allocator(init_no_addref no_addref,
+                    other_allocator const& alloc, Container&& values)
+              : base_type(no_addref, std::move(values))
+              , alloc_(alloc)
+            {}
+
+        private:
+            void destroy() override
+            {
+                typedef std::allocator_traits<other_allocator> traits;
+
+                other_allocator alloc(alloc_);
+                traits::destroy(alloc, this);
+                traits::deallocate(alloc, this, 1);
+            }
+
+            other_allocator alloc_;
+        };
+
+        template <typename T>
+        typename std::enable_if<
+            traits::is_future_range<
+                typename traits::acquire_future<T>::type
+            >::value,
+            lcos::future<typename traits::acquire_future<T>::type>
+        >::type
+        when_all_impl(T&& values)
+        {
+            typedef typename traits::acquire_future<T>::type result_type;
+            typedef detail::when_all_range_frame_allocator<
+                    util::pooled_allocator<>, result_type
+                > frame_type;
+
+            typedef typename std::allocator_traits<
+                    util::pooled_allocator<>
+                >::template rebind_alloc<frame_type> other_allocator;
+            typedef std::allocator_traits<other_allocator> alloc_traits;
+            typedef std::unique_ptr<frame_type,
+                    util::allocator_deleter<other_allocator>
+                > unique_ptr;
+
+            traits::acquire_future_disp func;
+            result_type futures = func(std::forward<T>(values));
+
+            // the frames are allocated from the per-worker pools
+            other_allocator alloc;
+            unique_ptr p(alloc_traits::allocate(alloc, 1),
+                util::allocator_deleter<other_allocator>{alloc});
+            alloc_traits::construct(alloc, p.get(),
+                typename frame_type::init_no_addref{}, alloc,
+                std::move(futures));
+
+            boost::intrusive_ptr<frame_type> frame(p.release(), false);
+            frame->await();
+
+            using traits::future_access;
+            return future_access<typename frame_type::type>::create(
+                std::move(frame));
+        }
+
         template <typename... T>
         typename detail::async_when_all_frame<
             util::tuple<
@@ -242,7 +386,7 @@ namespace hpx { namespace lcos
             typename frame_type::base_type::init_no_addref no_addref;
 
             auto frame = util::traverse_pack_async_allocator(
-                util::internal_allocator<>{},
+                util::pooled_allocator<>{},
                 util::async_traverse_in_place_tag<frame_type>{}, no_addref,
                 func(std::forward<T>(args))...);
 
@@ -11,6 +11,7 @@
 #include <hpx/config.hpp>
 #include <hpx/async_launch_policy_dispatch.hpp>
 #include <hpx/lcos/future.hpp>
+#include <hpx/lcos/local/futures_factory.hpp>
 #include <hpx/lcos/when_all_fwd.hpp>
 #include <hpx/parallel/algorithms/detail/predicates.hpp>
 #include <hpx/parallel/executors/post_policy_dispatch.hpp>
@@ -19,14 +20,20 @@
 #include <hpx/runtime/launch_policy.hpp>
 #include <hpx/runtime/serialization/serialize.hpp>
 #include <hpx/runtime/threads/thread_helpers.hpp>
+#include <hpx/runtime/threads/thread_init_data.hpp>
 #include <hpx/traits/future_traits.hpp>
 #include <hpx/traits/is_executor.hpp>
 #include <hpx/util/assert.hpp>
 #include <hpx/util/bind.hpp>
+#include <hpx/util/deferred_call.hpp>
 #include <hpx/util/range.hpp>
+#include <hpx/util/steady_clock.hpp>
+#include <hpx/util/thread_description.hpp>
 
 #include <algorithm>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <type_traits>
 #include <utility>
@@ -82,15 +89,38 @@ namespace hpx { namespace parallel { namespace execution
         HPX_CONSTEXPR explicit parallel_policy_executor(
                 Policy l = detail::get_default_policy<Policy>::call(),
                 std::size_t spread = 4, std::size_t tasks = std::size_t(-1))
-          : l_(l), num_spread_(spread), num_tasks_(tasks)
+          : l_(l), num_spread_(spread), num_tasks_(tasks), deadline_(0)
         {}
 
+        /// Create a new parallel executor which attaches the given absolute
+        /// deadline to all work it creates. The deadline is taken into
+        /// account by the deadline scheduler only (see
+        /// \a hpx::resource::deadline), all other schedulers ignore it.
+        parallel_policy_executor with_deadline(
+            hpx::util::steady_time_point const& abs_time) const
+        {
+            parallel_policy_executor exec(*this);
+            exec.deadline_ = std::uint64_t(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    abs_time.value().time_since_epoch()).count());
+            return exec;
+        }
+
+        /// Create a new parallel executor which attaches a deadline to all
+        /// work it creates, the deadline is given relative to now.
+        parallel_policy_executor with_deadline(
+            hpx::util::steady_duration const& rel_time) const
+        {
+            return with_deadline(rel_time.from_now());
+        }
+
         /// \cond NOINTERNAL
         bool operator==(parallel_policy_executor const& rhs) const noexcept
         {
             return l_ == rhs.l_ &&
                 num_spread_ == rhs.num_spread_ &&
-                num_tasks_ == rhs.num_tasks_;
+                num_tasks_ == rhs.num_tasks_ &&
+                deadline_ == rhs.deadline_;
         }
 
         bool operator!=(parallel_policy_executor const& rhs) const noexcept
@@ -113,6 +143,12 @@ namespace hpx { namespace parallel { namespace execution
         >
         async_execute(F && f, Ts &&... ts) const
         {
+            if (deadline_ != 0)
+            {
+                return async_execute_deadline(
+                    std::forward<F>(f), std::forward<Ts>(ts)...);
+            }
+
             return hpx::detail::async_launch_policy_dispatch<Policy>::call(
                 l_, std::forward<F>(f), std::forward<Ts>(ts)...);
         }
@@ -124,6 +160,14 @@ namespace hpx { namespace parallel { namespace execution
             hpx::util::thread_description desc(f,
                 "hpx::parallel::execution::parallel_executor::post");
 
+            if (deadline_ != 0)
+            {
+                register_deadline_thread(desc,
+                    hpx::util::deferred_call(
+                        std::forward<F>(f), std::forward<Ts>(ts)...));
+                return;
+            }
+
             detail::post_policy_dispatch<Policy>::call(
                 desc, l_, std::forward<F>(f), std::forward<Ts>(ts)...);
         }
@@ -161,6 +205,48 @@ namespace hpx { namespace parallel { namespace execution
 
     protected:
         /// \cond NOINTERNAL
+
+        // Work carrying a deadline is always run on a new HPX-thread, the
+        // launch policy contributes its priority only.
+        template <typename F, typename ... Ts>
+        hpx::future<
+            typename hpx::util::detail::invoke_deferred_result<F, Ts...>::type
+        >
+        async_execute_deadline(F && f, Ts &&... ts) const
+        {
+            typedef typename hpx::util::detail::invoke_deferred_result<
+                    F, Ts...
+                >::type result_type;
+
+            hpx::util::thread_description desc(f,
+                "hpx::parallel::execution::parallel_executor::async_execute");
+
+            lcos::local::futures_factory<result_type()> task(
+                hpx::util::deferred_call(
+                    std::forward<F>(f), std::forward<Ts>(ts)...));
+            hpx::future<result_type> result = task.get_future();
+
+            register_deadline_thread(desc, std::move(task));
+            return result;
+        }
+
+        template <typename F>
+        void register_deadline_thread(
+            hpx::util::thread_description const& desc, F && f) const
+        {
+            threads::thread_function_type func(
+                hpx::applier::detail::thread_function_nullary<
+                    typename std::decay<F>::type
+                >{std::forward<F>(f)});
+
+            threads::thread_init_data data(std::move(func), desc, 0,
+                l_.priority(), threads::thread_schedule_hint(),
+                threads::get_stack_size(threads::thread_stacksize_default));
+            data.deadline = deadline_;
+
+            threads::register_thread_plain(data);
+        }
+
         template <typename Result, typename F, typename Iter, typename ... Ts>
         hpx::future<void> spawn(std::vector<hpx::future<Result> >& results,
             std::size_t base, std::size_t size, std::size_t num_tasks,
@@ -219,7 +305,7 @@ namespace hpx { namespace parallel { namespace execution
         template <typename Archive>
         void serialize(Archive & ar, const unsigned int version)
         {
-            ar & l_ & num_spread_ & num_tasks_;
+            ar & l_ & num_spread_ & num_tasks_ & deadline_;
         }
         /// \endcond
 
@@ -228,6 +314,7 @@ namespace hpx { namespace parallel { namespace execution
         Policy l_;
         std::size_t num_spread_;
         std::size_t num_tasks_;
+        std::uint64_t deadline_;
         /// \endcond
     };
 
@@ -79,17 +79,29 @@ namespace hpx { namespace plugins { namespace parcel
         void update_num_messages();
         void update_interval();
 
+        // adaptive coalescing
+        void update_window();
+        void update_send_overhead(std::int64_t flushed_at);
+
     private:
         mutable mutex_type mtx_;
         parcelset::parcelport* pp_;
         std::size_t num_coalesced_parcels_;
         std::size_t interval_;
-        detail::message_buffer buffer_;
+        std::shared_ptr<detail::destination_buffer> buffer_;
         util::pool_timer timer_;
         bool stopped_;
         bool allow_background_flush_;
         std::string action_name_;
 
+        // In adaptive mode the coalescing window is derived from the latency
+        // budget (interval_) and the measured time it takes to send a
+        // message once flushed. Parcels of all actions sent to the same
+        // destination are coalesced into the same messages.
+        bool adaptive_;
+        std::int64_t window_;               // [ns]
+        std::int64_t send_overhead_;        // [ns]
+
         // performance counter data
         std::int64_t num_parcels_;
         std::int64_t reset_num_parcels_;
@@ -7,6 +7,8 @@
 #define HPX_RUNTIME_PARCELSET_POLICIES_COALESCING_MESSAGE_BUFFER_MAR_07_2013_1250PM
 
 #include <hpx/config.hpp>
+#include <hpx/config/lambda_capture.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
 #include <hpx/runtime/parcelset/locality.hpp>
 #include <hpx/runtime/parcelset/parcel.hpp>
 #include <hpx/runtime/parcelset/parcelport.hpp>
@@ -15,6 +17,7 @@
 #include <hpx/util/deferred_call.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <utility>
 #include <vector>
 
@@ -149,12 +152,53 @@ namespace hpx { namespace plugins { namespace parcel { namespace detail
 
         std::size_t capacity() const { return max_messages_; }
 
+        // additionally invoke the given function once the first of the
+        // buffered parcels has been sent
+        template <typename F>
+        void on_first_sent(F && f)
+        {
+            HPX_ASSERT(!handlers_.empty());
+            parcelset::write_handler_type h = std::move(handlers_.front());
+            handlers_.front() = [HPX_CAPTURE_FORWARD(f), HPX_CAPTURE_MOVE(h)](
+                    boost::system::error_code const& ec,
+                    parcelset::parcel const& p) mutable
+                {
+                    f(ec, p);
+                    h(ec, p);
+                };
+        }
+
     private:
         parcelset::locality dest_;
         std::vector<parcelset::parcel> messages_;
         std::vector<parcelset::write_handler_type> handlers_;
         std::size_t max_messages_;
     };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The buffer holding the parcels for one destination, shared by the
+    // message handlers of all actions if parcels are coalesced across actions.
+    struct destination_buffer
+    {
+        explicit destination_buffer(std::size_t max_messages)
+          : buffer_(max_messages),
+            opened_at_(0),
+            last_parcel_time_(0),
+            time_between_parcels_(-1)
+        {}
+
+        // acquired only if the buffer is shared between message handlers
+        lcos::local::spinlock mtx_;
+        message_buffer buffer_;
+
+        // time the first of the buffered parcels was appended
+        std::int64_t opened_at_;
+
+        // moving average of the time between parcels sent to this
+        // destination, -1 if not known yet
+        std::int64_t last_parcel_time_;
+        std::int64_t time_between_parcels_;
+    };
 }}}}
 
 #endif
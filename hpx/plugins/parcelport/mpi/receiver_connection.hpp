@@ -12,6 +12,7 @@
 
 #include <hpx/plugins/parcelport/mpi/header.hpp>
 #include <hpx/runtime/parcelset/decode_parcels.hpp>
+#include <hpx/runtime/parcelset/detail/receive_buffer_pool.hpp>
 #include <hpx/runtime/parcelset/parcel_buffer.hpp>
 #include <hpx/util/assert.hpp>
 
@@ -63,7 +64,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace mpi
             data.time_ = timer_.elapsed_nanoseconds();
             data.bytes_ = static_cast<std::size_t>(header_.numbytes());
 
-            buffer_.data_.resize(static_cast<std::size_t>(header_.size()));
+            buffer_.data_ = parcelset::detail::receive_buffer_pool::instance().
+                get(static_cast<std::size_t>(header_.size()));
             buffer_.num_chunks_ = header_.num_chunks();
         }
 
@@ -206,7 +208,12 @@ namespace hpx { namespace parcelset { namespace policies { namespace mpi
                 request_ptr_ = &request_;
             }
 
-            decode_parcels(pp_, std::move(buffer_), num_thread);
+            // the main buffer is given back to be reused for the next
+            // message received by any connection
+            decode_parcels_in_place(pp_, buffer_, num_thread);
+            parcelset::detail::receive_buffer_pool::instance().release(
+                std::move(buffer_.data_));
+            buffer_.clear();
 
             state_ = sent_release_tag;
 
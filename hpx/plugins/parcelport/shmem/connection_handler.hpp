@@ -0,0 +1,157 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_CONNECTION_HANDLER_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_CONNECTION_HANDLER_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/plugins/parcelport/shmem/inbox.hpp>
+#include <hpx/plugins/parcelport/shmem/locality.hpp>
+#include <hpx/plugins/parcelport/shmem/receiver.hpp>
+#include <hpx/plugins/parcelport/shmem/sender.hpp>
+#include <hpx/plugins/parcelport/shmem/sender_connection.hpp>
+#include <hpx/runtime/parcelset/locality.hpp>
+#include <hpx/runtime/parcelset/parcelport_impl.hpp>
+#include <hpx/util_fwd.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace parcelset
+{
+    namespace policies { namespace shmem
+    {
+        class HPX_EXPORT connection_handler;
+    }}
+
+    template <>
+    struct connection_handler_traits<policies::shmem::connection_handler>
+    {
+        typedef policies::shmem::sender_connection connection_type;
+        typedef std::false_type send_early_parcel;
+        typedef std::true_type  do_background_work;
+        typedef std::false_type send_immediate_parcels;
+
+        static const char * type()
+        {
+            return "shmem";
+        }
+
+        static const char * pool_name()
+        {
+            return "parcel-pool-shmem";
+        }
+
+        static const char * pool_name_postfix()
+        {
+            return "-shmem";
+        }
+    };
+
+    namespace policies { namespace shmem
+    {
+        // The shared memory parcelport connects localities running on the
+        // same host. Every locality owns an inbox segment holding one ring
+        // buffer per incoming connection. Large zero-copy chunks bypass the
+        // rings and are handed over in segments of their own.
+        //
+        // This parcelport can't be used for bootstrapping, it takes over from
+        // the bootstrap parcelport once alternative parcelports are enabled.
+        class HPX_EXPORT connection_handler
+          : public parcelport_impl<connection_handler>
+        {
+            typedef parcelport_impl<connection_handler> base_type;
+
+        public:
+            static std::vector<std::string> runtime_configuration()
+            {
+                std::vector<std::string> lines;
+
+                return lines;
+            }
+
+            connection_handler(util::runtime_configuration const& ini,
+                util::function_nonser<void(std::size_t, char const*)> const&
+                    on_start_thread,
+                util::function_nonser<void(std::size_t, char const*)> const&
+                    on_stop_thread);
+
+            ~connection_handler();
+
+            /// Start the handling of connections.
+            bool do_run();
+
+            /// Stop the handling of connectons.
+            void do_stop();
+
+            /// Return the name of this locality
+            std::string get_locality_name() const;
+
+            /// Only localities on the same host are reachable.
+            bool can_connect(parcelset::locality const& l,
+                bool use_alternative_parcelport) override;
+
+            std::shared_ptr<sender_connection> create_connection(
+                parcelset::locality const& l, error_code& ec);
+
+            parcelset::locality agas_locality(
+                util::runtime_configuration const& ini) const;
+
+            parcelset::locality create_locality() const;
+
+            bool background_work(std::size_t num_thread);
+
+        private:
+            typedef lcos::local::spinlock mutex_type;
+
+            // a mapped inbox, or the time until which another attempt to map
+            // it is not made
+            struct inbox_entry
+            {
+                std::shared_ptr<inbox> inbox_;
+                std::chrono::steady_clock::time_point retry_;
+            };
+
+            std::shared_ptr<inbox> get_inbox(locality const& l);
+
+            void io_service_work();
+
+            std::size_t num_slots_;
+            std::size_t ring_size_;
+            std::uint64_t zero_copy_threshold_;
+
+            std::atomic<bool> running_;
+
+            // the inbox of this locality
+            inbox inbox_;
+
+            sender sender_;
+            receiver<connection_handler> receiver_;
+
+            // inboxes of the other localities on this host, indexed by pid
+            mutex_type inboxes_mtx_;
+            std::map<std::int32_t, inbox_entry> inboxes_;
+        };
+    }}
+}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
+
+#endif
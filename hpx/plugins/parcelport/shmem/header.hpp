@@ -0,0 +1,61 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_HEADER_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_HEADER_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    // Every message written to a ring starts with this header, it is
+    // followed by the transmission chunks, the serialized data and the
+    // zero-copy chunks. Zero-copy chunks of at least zero_copy_threshold_
+    // bytes are not written to the ring, their place is taken by the id of
+    // the shared memory segment they have been handed over in.
+    struct header
+    {
+        header()
+          : size_(0), data_size_(0),
+            num_zero_copy_chunks_(0), num_non_zero_copy_chunks_(0),
+            zero_copy_threshold_(0)
+        {}
+
+        template <typename Buffer>
+        header(Buffer const& buffer, std::uint64_t zero_copy_threshold)
+          : size_(buffer.size_),
+            data_size_(buffer.data_size_),
+            num_zero_copy_chunks_(buffer.num_chunks_.first),
+            num_non_zero_copy_chunks_(buffer.num_chunks_.second),
+            zero_copy_threshold_(zero_copy_threshold)
+        {}
+
+        std::size_t num_chunks() const
+        {
+            return num_zero_copy_chunks_ == 0 ? 0 :
+                std::size_t(num_zero_copy_chunks_) + num_non_zero_copy_chunks_;
+        }
+
+        bool is_handed_over(std::uint64_t chunk_size) const
+        {
+            return chunk_size >= zero_copy_threshold_;
+        }
+
+        std::uint64_t size_;
+        std::uint64_t data_size_;
+        std::uint32_t num_zero_copy_chunks_;
+        std::uint32_t num_non_zero_copy_chunks_;
+        std::uint64_t zero_copy_threshold_;
+    };
+}}}}
+
+#endif
+
+#endif
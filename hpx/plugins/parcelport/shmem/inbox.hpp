@@ -0,0 +1,378 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_INBOX_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_INBOX_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/plugins/parcelport/shmem/segment.hpp>
+#include <hpx/util/assert.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string>
+
+#include <linux/futex.h>
+#include <signal.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    namespace detail
+    {
+        // The futex word lives in shared memory, waiters and wakers may be
+        // in different processes, so the non-private operations are used.
+        inline void futex_wait(std::atomic<std::uint32_t>& word,
+            std::uint32_t expected, std::chrono::nanoseconds timeout)
+        {
+            struct timespec ts;
+            ts.tv_sec = static_cast<time_t>(timeout.count() / 1000000000);
+            ts.tv_nsec = static_cast<long>(timeout.count() % 1000000000);
+
+            ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word),
+                FUTEX_WAIT, expected, &ts, nullptr, 0);
+        }
+
+        inline void futex_wake(std::atomic<std::uint32_t>& word)
+        {
+            ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word),
+                FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        struct inbox_header
+        {
+            std::atomic<std::uint32_t> magic_;
+            std::uint32_t num_slots_;
+            std::uint64_t ring_size_;
+            char pad0_[64];
+
+            // bumped by the senders whenever data has been published, this
+            // is the futex word idle receiver threads sleep on
+            std::atomic<std::uint32_t> doorbell_;
+
+            // number of receiver threads about to sleep on the doorbell
+            std::atomic<std::uint32_t> sleepers_;
+            char pad1_[64];
+        };
+
+        // Every slot is a single producer, single consumer byte ring owned by
+        // one sending connection. The head and tail count the bytes written
+        // and consumed over the lifetime of the connection.
+        struct slot_header
+        {
+            std::atomic<std::uint32_t> state_;
+            std::atomic<std::int32_t> sender_pid_;
+            char pad0_[64];
+
+            std::atomic<std::uint64_t> head_;
+            char pad1_[64];
+
+            std::atomic<std::uint64_t> tail_;
+            char pad2_[64];
+        };
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The inbox of a locality is a shared memory segment holding a fixed
+    // number of ring buffers, one for each connection other localities on the
+    // same host have established to it.
+    class inbox
+    {
+        typedef detail::inbox_header header_type;
+        typedef detail::slot_header slot_type;
+
+        HPX_STATIC_CONSTEXPR std::uint32_t magic = 0x6870786d;   // 'hpxm'
+
+    public:
+        HPX_STATIC_CONSTEXPR std::size_t npos = std::size_t(-1);
+
+        enum slot_state
+        {
+            slot_free = 0,
+            slot_connected = 1,
+            slot_closing = 2
+        };
+
+        inbox()
+          : header_(nullptr), slots_(nullptr), rings_(nullptr),
+            num_slots_(0), ring_size_(0)
+        {}
+
+        static std::string name(std::int32_t pid)
+        {
+            return "/hpx.shmem." + std::to_string(pid);
+        }
+
+        // name of the segment a large chunk is handed over in
+        static std::string chunk_name(std::int32_t pid, std::uint64_t id)
+        {
+            return name(pid) + "." + std::to_string(id);
+        }
+
+        // Create the inbox of this process.
+        void create(std::int32_t pid, std::size_t num_slots,
+            std::size_t ring_size)
+        {
+            segment_.create(name(pid), segment_size(num_slots, ring_size));
+
+            header_ = new (segment_.data()) header_type();
+            header_->num_slots_ = static_cast<std::uint32_t>(num_slots);
+            header_->ring_size_ = ring_size;
+            header_->doorbell_.store(0, std::memory_order_relaxed);
+            header_->sleepers_.store(0, std::memory_order_relaxed);
+
+            init(num_slots, ring_size);
+            for (std::size_t i = 0; i != num_slots; ++i)
+            {
+                slot_type* s = new (&slots_[i]) slot_type();
+                s->state_.store(slot_free, std::memory_order_relaxed);
+                s->sender_pid_.store(-1, std::memory_order_relaxed);
+                s->head_.store(0, std::memory_order_relaxed);
+                s->tail_.store(0, std::memory_order_relaxed);
+            }
+
+            header_->magic_.store(magic, std::memory_order_release);
+        }
+
+        // Map the inbox of another process, returns false if it does not
+        // exist (yet).
+        bool open(std::int32_t pid)
+        {
+            if (!segment_.open(name(pid)))
+                return false;
+
+            header_ = static_cast<header_type*>(segment_.data());
+            if (segment_.size() < sizeof(header_type) ||
+                header_->magic_.load(std::memory_order_acquire) != magic ||
+                segment_.size() < segment_size(
+                    header_->num_slots_, header_->ring_size_))
+            {
+                segment_.close();
+                header_ = nullptr;
+                return false;
+            }
+
+            init(header_->num_slots_, header_->ring_size_);
+            return true;
+        }
+
+        // Remove the name of the inbox, no further connections can be made.
+        void unlink()
+        {
+            segment_.unlink();
+        }
+
+        std::size_t num_slots() const
+        {
+            return num_slots_;
+        }
+
+        std::uint32_t state(std::size_t slot) const
+        {
+            return slots_[slot].state_.load(std::memory_order_acquire);
+        }
+
+        std::int32_t sender_pid(std::size_t slot) const
+        {
+            return slots_[slot].sender_pid_.load(std::memory_order_acquire);
+        }
+
+        // Return false if the given process has terminated.
+        static bool process_alive(std::int32_t pid)
+        {
+            return pid <= 0 || ::kill(pid, 0) == 0 || errno != ESRCH;
+        }
+
+        // Return false if the process owning the slot has terminated. A
+        // slot which has just been claimed counts as alive.
+        bool sender_alive(std::size_t slot) const
+        {
+            return process_alive(sender_pid(slot));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // sender side
+
+        // claim a free slot, returns npos if all slots are in use
+        std::size_t connect(std::int32_t pid)
+        {
+            for (std::size_t i = 0; i != num_slots_; ++i)
+            {
+                std::uint32_t expected = slot_free;
+                if (slots_[i].state_.load(std::memory_order_relaxed) ==
+                        slot_free &&
+                    slots_[i].state_.compare_exchange_strong(expected,
+                        slot_connected, std::memory_order_acq_rel))
+                {
+                    HPX_ASSERT(slots_[i].head_.load() == 0);
+                    slots_[i].sender_pid_.store(pid, std::memory_order_release);
+                    return i;
+                }
+            }
+            return npos;
+        }
+
+        // the receiver hands the slot out again once it has been drained
+        void disconnect(std::size_t slot)
+        {
+            slots_[slot].state_.store(slot_closing, std::memory_order_release);
+            notify();
+        }
+
+        // copy as much of the given data into the ring as fits, returns the
+        // number of bytes written
+        std::size_t write(std::size_t slot, void const* data, std::size_t size)
+        {
+            slot_type& s = slots_[slot];
+            std::uint64_t const head = s.head_.load(std::memory_order_relaxed);
+            std::uint64_t const tail = s.tail_.load(std::memory_order_acquire);
+
+            std::size_t const count = (std::min)(size,
+                ring_size_ - static_cast<std::size_t>(head - tail));
+            if (count == 0)
+                return 0;
+
+            std::size_t const pos = static_cast<std::size_t>(head % ring_size_);
+            std::size_t const first = (std::min)(count, ring_size_ - pos);
+
+            char* ring = rings_ + slot * ring_size_;
+            std::memcpy(ring + pos, data, first);
+            std::memcpy(ring, static_cast<char const*>(data) + first,
+                count - first);
+
+            s.head_.store(head + count, std::memory_order_release);
+            return count;
+        }
+
+        // wake up the receiver if it is about to sleep
+        void notify()
+        {
+            header_->doorbell_.fetch_add(1, std::memory_order_release);
+
+            // pairs with the fence in prepare_wait
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (header_->sleepers_.load(std::memory_order_relaxed) != 0)
+                detail::futex_wake(header_->doorbell_);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // receiver side
+
+        // copy up to the given number of bytes out of the ring, returns the
+        // number of bytes read
+        std::size_t read(std::size_t slot, void* data, std::size_t size)
+        {
+            slot_type& s = slots_[slot];
+            std::uint64_t const tail = s.tail_.load(std::memory_order_relaxed);
+            std::uint64_t const head = s.head_.load(std::memory_order_acquire);
+
+            std::size_t const count =
+                (std::min)(size, static_cast<std::size_t>(head - tail));
+            if (count == 0)
+                return 0;
+
+            std::size_t const pos = static_cast<std::size_t>(tail % ring_size_);
+            std::size_t const first = (std::min)(count, ring_size_ - pos);
+
+            char const* ring = rings_ + slot * ring_size_;
+            std::memcpy(data, ring + pos, first);
+            std::memcpy(static_cast<char*>(data) + first, ring, count - first);
+
+            s.tail_.store(tail + count, std::memory_order_release);
+            return count;
+        }
+
+        // make a closed and drained slot available again
+        bool try_release(std::size_t slot)
+        {
+            slot_type& s = slots_[slot];
+            if (s.state_.load(std::memory_order_acquire) != slot_closing ||
+                s.head_.load(std::memory_order_acquire) !=
+                    s.tail_.load(std::memory_order_relaxed))
+            {
+                return false;
+            }
+
+            reclaim(slot);
+            return true;
+        }
+
+        // Make a slot available again regardless of its state, this is used
+        // for slots whose sender has terminated without disconnecting.
+        void reclaim(std::size_t slot)
+        {
+            slot_type& s = slots_[slot];
+            s.sender_pid_.store(-1, std::memory_order_relaxed);
+            s.head_.store(0, std::memory_order_relaxed);
+            s.tail_.store(0, std::memory_order_relaxed);
+            s.state_.store(slot_free, std::memory_order_release);
+        }
+
+        // Announce that the calling thread is about to sleep. The caller has
+        // to check all slots for new data before calling wait.
+        std::uint32_t prepare_wait()
+        {
+            std::uint32_t const doorbell =
+                header_->doorbell_.load(std::memory_order_acquire);
+            header_->sleepers_.fetch_add(1, std::memory_order_relaxed);
+
+            // pairs with the fence in notify
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            return doorbell;
+        }
+
+        void wait(std::uint32_t doorbell, std::chrono::nanoseconds timeout)
+        {
+            detail::futex_wait(header_->doorbell_, doorbell, timeout);
+        }
+
+        void finish_wait()
+        {
+            header_->sleepers_.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+    private:
+        static std::size_t segment_size(std::size_t num_slots,
+            std::size_t ring_size)
+        {
+            return sizeof(header_type) + num_slots * sizeof(slot_type) +
+                num_slots * ring_size;
+        }
+
+        void init(std::size_t num_slots, std::size_t ring_size)
+        {
+            char* base = static_cast<char*>(segment_.data());
+            slots_ = reinterpret_cast<slot_type*>(base + sizeof(header_type));
+            rings_ = base + sizeof(header_type) + num_slots * sizeof(slot_type);
+            num_slots_ = num_slots;
+            ring_size_ = ring_size;
+        }
+
+        segment segment_;
+        header_type* header_;
+        slot_type* slots_;
+        char* rings_;
+
+        std::size_t num_slots_;
+        std::size_t ring_size_;
+    };
+}}}}
+
+#endif
+
+#endif
@@ -0,0 +1,100 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_LOCALITY_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_LOCALITY_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/runtime/parcelset/locality.hpp>
+#include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/runtime/serialization/string.hpp>
+
+#include <boost/io/ios_state.hpp>
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace hpx { namespace parcelset
+{
+    namespace policies { namespace shmem
+    {
+        // A shared memory endpoint is identified by the host it runs on and
+        // the id of the process owning the inbox segment.
+        class locality
+        {
+        public:
+            locality()
+              : pid_(-1)
+            {}
+
+            locality(std::string const& host, std::int32_t pid)
+              : host_(host), pid_(pid)
+            {}
+
+            std::string const& host() const
+            {
+                return host_;
+            }
+
+            std::int32_t pid() const
+            {
+                return pid_;
+            }
+
+            static const char *type()
+            {
+                return "shmem";
+            }
+
+            explicit operator bool() const noexcept
+            {
+                return pid_ != -1;
+            }
+
+            void save(serialization::output_archive & ar) const
+            {
+                ar << host_;
+                ar << pid_;
+            }
+
+            void load(serialization::input_archive & ar)
+            {
+                ar >> host_;
+                ar >> pid_;
+            }
+
+        private:
+            friend bool operator==(locality const & lhs, locality const & rhs)
+            {
+                return lhs.pid_ == rhs.pid_ && lhs.host_ == rhs.host_;
+            }
+
+            friend bool operator<(locality const & lhs, locality const & rhs)
+            {
+                return lhs.host_ < rhs.host_ ||
+                    (lhs.host_ == rhs.host_ && lhs.pid_ < rhs.pid_);
+            }
+
+            friend std::ostream & operator<<(std::ostream & os, locality const & loc)
+            {
+                boost::io::ios_flags_saver ifs(os);
+                os << loc.host_ << ":" << loc.pid_;
+
+                return os;
+            }
+
+            std::string host_;
+            std::int32_t pid_;
+        };
+    }}
+}}
+
+#endif
+
+#endif
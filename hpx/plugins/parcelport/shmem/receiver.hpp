@@ -0,0 +1,388 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_RECEIVER_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_RECEIVER_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/performance_counters/parcels/data_point.hpp>
+#include <hpx/plugins/parcelport/shmem/header.hpp>
+#include <hpx/plugins/parcelport/shmem/inbox.hpp>
+#include <hpx/plugins/parcelport/shmem/segment.hpp>
+#include <hpx/runtime/parcelset/decode_parcels.hpp>
+#include <hpx/runtime/parcelset/detail/receive_buffer_pool.hpp>
+#include <hpx/runtime/parcelset/parcel_buffer.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/high_resolution_timer.hpp>
+#include <hpx/util/logging.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    // Storage of a received zero-copy chunk: either the chunk has been read
+    // from the ring, or the segment it was handed over in is mapped directly.
+    class receive_chunk
+    {
+    public:
+        receive_chunk() = default;
+
+        receive_chunk(receive_chunk &&) = default;
+        receive_chunk& operator=(receive_chunk &&) = default;
+
+        void resize(std::size_t size)
+        {
+            data_.resize(size);
+        }
+
+        bool map(std::string const& name)
+        {
+            if (!segment_.open(name))
+                return false;
+
+            // the mapping stays valid until this chunk is destroyed
+            segment_.unlink();
+            return true;
+        }
+
+        char* data()
+        {
+            return segment_.data() != nullptr ?
+                static_cast<char*>(segment_.data()) : data_.data();
+        }
+
+        std::size_t size() const
+        {
+            return segment_.data() != nullptr ? segment_.size() : data_.size();
+        }
+
+    private:
+        std::vector<char> data_;
+        segment segment_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Parcelport>
+    class receiver
+    {
+        typedef hpx::lcos::local::spinlock mutex_type;
+
+        typedef parcel_buffer<std::vector<char>, receive_chunk> buffer_type;
+
+        enum connection_state
+        {
+            initialized
+          , rcvd_header
+          , rcvd_transmission_chunks
+          , rcvd_data
+          , rcvd_chunks
+        };
+
+        // receive state of one slot of the inbox
+        struct connection
+        {
+            connection()
+              : state_(initialized), offset_(0), chunks_idx_(0), segment_id_(0)
+              , dropped_(false)
+            {}
+
+            mutex_type mtx_;
+            connection_state state_;
+
+            header header_;
+            buffer_type buffer_;
+
+            std::size_t offset_;
+            std::size_t chunks_idx_;
+            std::uint64_t segment_id_;
+
+            // the current message can't be delivered, it is still read
+            // completely to find the start of the next one
+            bool dropped_;
+        };
+
+        // number of background work rounds between checks for slots whose
+        // sender has terminated without disconnecting
+        HPX_STATIC_CONSTEXPR std::size_t reclaim_interval = 4096;
+
+    public:
+        receiver(Parcelport & pp, inbox & in)
+          : pp_(pp)
+          , inbox_(in)
+          , rounds_(0)
+        {}
+
+        void run()
+        {
+            connections_.reset(new connection[inbox_.num_slots()]);
+        }
+
+        bool background_work(std::size_t num_thread = -1)
+        {
+            bool has_work = false;
+            for (std::size_t i = 0; i != inbox_.num_slots(); ++i)
+            {
+                if (inbox_.state(i) != inbox::slot_free)
+                    has_work = receive(i, num_thread) || has_work;
+            }
+
+            if (++rounds_ % reclaim_interval == 0)
+                reclaim_slots(num_thread);
+
+            return has_work;
+        }
+
+    private:
+        bool receive(std::size_t slot, std::size_t num_thread)
+        {
+            connection& c = connections_[slot];
+
+            bool has_work = false;
+            while (true)
+            {
+                buffer_type buffer;
+                {
+                    std::unique_lock<mutex_type> l(c.mtx_, std::try_to_lock);
+                    if (!l)
+                        return has_work;
+
+                    if (!receive_message(c, slot, has_work))
+                    {
+                        // the sender might have disconnected after its last
+                        // message
+                        if (c.state_ == initialized)
+                            inbox_.try_release(slot);
+                        return has_work;
+                    }
+
+                    if (c.dropped_)
+                    {
+                        reset(c);
+                        continue;
+                    }
+
+                    buffer = std::move(c.buffer_);
+                    c.buffer_ = buffer_type();
+                    c.state_ = initialized;
+                }
+
+                // other threads may receive the next message of this slot
+                // while this one is being decoded, the main buffer is given
+                // back to be reused for the next message of any slot
+                decode_parcels_in_place(pp_, buffer, num_thread);
+                parcelset::detail::receive_buffer_pool::instance().release(
+                    std::move(buffer.data_));
+            }
+        }
+
+        // Hand out the slots of senders which have terminated without
+        // disconnecting. The messages they have completed are still
+        // delivered, a partially received message is dropped.
+        void reclaim_slots(std::size_t num_thread)
+        {
+            for (std::size_t i = 0; i != inbox_.num_slots(); ++i)
+            {
+                if (inbox_.state(i) == inbox::slot_free ||
+                    inbox_.sender_alive(i))
+                {
+                    continue;
+                }
+
+                receive(i, num_thread);
+
+                connection& c = connections_[i];
+                std::unique_lock<mutex_type> l(c.mtx_, std::try_to_lock);
+                if (!l || inbox_.state(i) == inbox::slot_free)
+                    continue;
+
+                reset(c);
+                inbox_.reclaim(i);
+            }
+        }
+
+        // Drop the message currently being received, its buffer is given
+        // back to be reused for the next message.
+        void reset(connection& c)
+        {
+            parcelset::detail::receive_buffer_pool::instance().release(
+                std::move(c.buffer_.data_));
+            c.buffer_ = buffer_type();
+            c.state_ = initialized;
+            c.offset_ = 0;
+            c.chunks_idx_ = 0;
+            c.dropped_ = false;
+        }
+
+        // Read as much of the next message as is available, returns true
+        // once the message has been received completely.
+        bool receive_message(connection& c, std::size_t slot, bool& has_work)
+        {
+            switch (c.state_)
+            {
+            case initialized:
+                if (!read(c, slot, &c.header_, sizeof(header), has_work))
+                    return false;
+                init_buffer(c);
+                c.state_ = rcvd_header;
+                HPX_FALLTHROUGH;
+
+            case rcvd_header:
+                {
+                    std::vector<
+                        buffer_type::transmission_chunk_type
+                    >& chunks = c.buffer_.transmission_chunks_;
+                    if (!chunks.empty() &&
+                        !read(c, slot, chunks.data(), chunks.size() *
+                            sizeof(buffer_type::transmission_chunk_type),
+                            has_work))
+                    {
+                        return false;
+                    }
+                }
+                init_chunks(c);
+                c.state_ = rcvd_transmission_chunks;
+                HPX_FALLTHROUGH;
+
+            case rcvd_transmission_chunks:
+                if (!read(c, slot, c.buffer_.data_.data(),
+                        c.buffer_.data_.size(), has_work))
+                {
+                    return false;
+                }
+                c.state_ = rcvd_data;
+                HPX_FALLTHROUGH;
+
+            case rcvd_data:
+                while (c.chunks_idx_ != c.buffer_.chunks_.size())
+                {
+                    std::uint64_t const size =
+                        c.buffer_.transmission_chunks_[c.chunks_idx_].second;
+                    receive_chunk& chunk = c.buffer_.chunks_[c.chunks_idx_];
+
+                    if (c.header_.is_handed_over(size))
+                    {
+                        if (!read(c, slot, &c.segment_id_,
+                                sizeof(std::uint64_t), has_work))
+                        {
+                            return false;
+                        }
+
+                        std::string const name = inbox::chunk_name(
+                            inbox_.sender_pid(slot), c.segment_id_);
+                        if (c.dropped_)
+                        {
+                            segment::remove(name);
+                        }
+                        else if (!chunk.map(name))
+                        {
+                            // the sender has given up on this message, the
+                            // rest of it is skipped
+                            LPT_(error)
+                                << "shmem::receiver::receive_message: "
+                                   "unable to map the shared memory segment "
+                                   "holding a received chunk: " << name
+                                << ", dropping the message";
+                            c.dropped_ = true;
+                        }
+                        HPX_ASSERT(c.dropped_ || chunk.size() == size);
+                    }
+                    else if (!read(c, slot, chunk.data(),
+                        static_cast<std::size_t>(size), has_work))
+                    {
+                        return false;
+                    }
+                    ++c.chunks_idx_;
+                }
+                c.state_ = rcvd_chunks;
+                HPX_FALLTHROUGH;
+
+            case rcvd_chunks:
+                {
+                    performance_counters::parcels::data_point& data =
+                        c.buffer_.data_point_;
+                    data.time_ = timer_.elapsed_nanoseconds() - data.time_;
+                }
+                return true;
+
+            default:
+                HPX_ASSERT(false);
+            }
+            return false;
+        }
+
+        bool read(connection& c, std::size_t slot, void* data,
+            std::size_t size, bool& has_work)
+        {
+            std::size_t const count = inbox_.read(slot,
+                static_cast<char*>(data) + c.offset_, size - c.offset_);
+
+            has_work = has_work || count != 0;
+            c.offset_ += count;
+            if (c.offset_ != size)
+                return false;
+
+            c.offset_ = 0;
+            return true;
+        }
+
+        void init_buffer(connection& c)
+        {
+            buffer_type& buffer = c.buffer_;
+
+            performance_counters::parcels::data_point& data =
+                buffer.data_point_;
+            data.time_ = timer_.elapsed_nanoseconds();
+            data.bytes_ = static_cast<std::size_t>(c.header_.size_);
+
+            buffer.size_ = c.header_.size_;
+            buffer.data_size_ = c.header_.data_size_;
+            buffer.num_chunks_ = buffer_type::count_chunks_type(
+                c.header_.num_zero_copy_chunks_,
+                c.header_.num_non_zero_copy_chunks_);
+
+            buffer.transmission_chunks_.resize(c.header_.num_chunks());
+            buffer.data_ = parcelset::detail::receive_buffer_pool::instance().
+                get(static_cast<std::size_t>(c.header_.size_));
+        }
+
+        // allocate the zero-copy chunks which are streamed through the ring
+        void init_chunks(connection& c)
+        {
+            buffer_type& buffer = c.buffer_;
+
+            buffer.chunks_.resize(c.header_.num_zero_copy_chunks_);
+            for (std::size_t i = 0; i != buffer.chunks_.size(); ++i)
+            {
+                std::uint64_t const size = buffer.transmission_chunks_[i].second;
+                if (!c.header_.is_handed_over(size))
+                    buffer.chunks_[i].resize(static_cast<std::size_t>(size));
+            }
+            c.chunks_idx_ = 0;
+        }
+
+        Parcelport & pp_;
+        inbox & inbox_;
+
+        std::unique_ptr<connection[]> connections_;
+        std::atomic<std::size_t> rounds_;
+
+        util::high_resolution_timer timer_;
+    };
+}}}}
+
+#endif
+
+#endif
@@ -0,0 +1,187 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_SEGMENT_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_SEGMENT_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/throw_exception.hpp>
+#include <hpx/util/assert.hpp>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    // RAII wrapper for a named POSIX shared memory segment mapped into the
+    // address space of this process.
+    class segment
+    {
+    public:
+        segment()
+          : data_(nullptr), size_(0)
+        {}
+
+        segment(segment && rhs) noexcept
+          : name_(std::move(rhs.name_)), data_(rhs.data_), size_(rhs.size_)
+        {
+            rhs.data_ = nullptr;
+            rhs.size_ = 0;
+        }
+
+        segment& operator=(segment && rhs) noexcept
+        {
+            if (this != &rhs)
+            {
+                close();
+                name_ = std::move(rhs.name_);
+                data_ = rhs.data_;
+                size_ = rhs.size_;
+                rhs.data_ = nullptr;
+                rhs.size_ = 0;
+            }
+            return *this;
+        }
+
+        ~segment()
+        {
+            close();
+        }
+
+        // Create a new segment of the given size. A stale segment of the same
+        // name (left behind by a process which has crashed) is replaced.
+        void create(std::string const& name, std::size_t size)
+        {
+            HPX_ASSERT(data_ == nullptr && size != 0);
+
+            int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+            if (fd == -1 && errno == EEXIST)
+            {
+                ::shm_unlink(name.c_str());
+                fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+            }
+            if (fd == -1)
+            {
+                HPX_THROW_EXCEPTION(network_error,
+                    "shmem::segment::create",
+                    "shm_open failed for " + name + ": " + std::strerror(errno));
+            }
+
+            if (::ftruncate(fd, static_cast<off_t>(size)) == -1)
+            {
+                int const error = errno;
+                ::close(fd);
+                ::shm_unlink(name.c_str());
+                HPX_THROW_EXCEPTION(network_error,
+                    "shmem::segment::create",
+                    "ftruncate failed for " + name + ": " + std::strerror(error));
+            }
+
+            name_ = name;
+            map(fd, size);
+        }
+
+        // Map an existing segment, returns false if no segment of the given
+        // name exists (or it can't be mapped).
+        bool open(std::string const& name)
+        {
+            HPX_ASSERT(data_ == nullptr);
+
+            int fd = ::shm_open(name.c_str(), O_RDWR, 0600);
+            if (fd == -1)
+                return false;
+
+            struct stat st;
+            if (::fstat(fd, &st) == -1 || st.st_size == 0)
+            {
+                ::close(fd);
+                return false;
+            }
+
+            name_ = name;
+            map(fd, static_cast<std::size_t>(st.st_size));
+            return true;
+        }
+
+        // Remove the segment of the given name, if any.
+        static void remove(std::string const& name)
+        {
+            ::shm_unlink(name.c_str());
+        }
+
+        // Remove the name of the segment, existing mappings stay valid.
+        void unlink()
+        {
+            if (!name_.empty())
+            {
+                ::shm_unlink(name_.c_str());
+                name_.clear();
+            }
+        }
+
+        void close()
+        {
+            if (data_ != nullptr)
+            {
+                ::munmap(data_, size_);
+                data_ = nullptr;
+                size_ = 0;
+            }
+        }
+
+        void* data() const
+        {
+            return data_;
+        }
+
+        std::size_t size() const
+        {
+            return size_;
+        }
+
+        std::string const& name() const
+        {
+            return name_;
+        }
+
+    private:
+        void map(int fd, std::size_t size)
+        {
+            void* data = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                MAP_SHARED, fd, 0);
+            int const error = errno;
+            ::close(fd);
+
+            if (data == MAP_FAILED)
+            {
+                HPX_THROW_EXCEPTION(network_error,
+                    "shmem::segment::map",
+                    "mmap failed for " + name_ + ": " + std::strerror(error));
+            }
+
+            data_ = data;
+            size_ = size;
+        }
+
+        std::string name_;
+        void* data_;
+        std::size_t size_;
+    };
+}}}}
+
+#endif
+
+#endif
@@ -0,0 +1,142 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_SENDER_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_SENDER_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/error_code.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/plugins/parcelport/shmem/sender_connection.hpp>
+#include <hpx/util/unique_function.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    // The sender keeps track of all connections which could not write their
+    // message completely as the ring of the destination was full.
+    struct sender
+    {
+        typedef
+            sender_connection
+            connection_type;
+        typedef std::shared_ptr<connection_type> connection_ptr;
+        typedef std::deque<connection_ptr> connection_list;
+
+        typedef hpx::lcos::local::spinlock mutex_type;
+
+        sender()
+          : next_segment_id_(0)
+        {
+        }
+
+        void add(connection_ptr const & ptr)
+        {
+            std::unique_lock<mutex_type> l(connections_mtx_);
+            connections_.push_back(ptr);
+        }
+
+        std::uint64_t next_segment_id()
+        {
+            return ++next_segment_id_;
+        }
+
+        bool has_pending()
+        {
+            std::unique_lock<mutex_type> l(connections_mtx_);
+            return !connections_.empty();
+        }
+
+        // Resume sending the current message of the given connection,
+        // returns whether any data has been written.
+        bool send_messages(
+            connection_ptr connection
+        )
+        {
+            std::uint64_t const bytes_written = connection->bytes_written();
+
+            // Check if sending has been completed....
+            if (connection->send())
+            {
+                error_code ec;
+                util::unique_function_nonser<
+                    void(
+                        error_code const&
+                      , parcelset::locality const&
+                      , connection_ptr
+                    )
+                > postprocess_handler;
+                std::swap(postprocess_handler, connection->postprocess_handler_);
+                postprocess_handler(
+                    ec, connection->destination(), connection);
+                return true;
+            }
+
+            bool const progress = connection->bytes_written() != bytes_written;
+            if (!progress && !connection->receiver_alive())
+            {
+                // nobody will ever drain the ring of this connection
+                connection->abort(error_code(network_error,
+                    "the destination of the shmem connection has terminated",
+                    lightweight));
+                return true;
+            }
+
+            {
+                std::unique_lock<mutex_type> l(connections_mtx_);
+                connections_.push_back(std::move(connection));
+            }
+            return progress;
+        }
+
+        // Fail the messages of all connections still waiting for space in
+        // the rings of their destinations with the given error.
+        void abort_pending(error_code const& ec)
+        {
+            connection_list connections;
+            {
+                std::unique_lock<mutex_type> l(connections_mtx_);
+                std::swap(connections, connections_);
+            }
+            for (connection_ptr& connection : connections)
+                connection->abort(ec);
+        }
+
+        bool background_work()
+        {
+            connection_ptr connection;
+            {
+                std::unique_lock<mutex_type> l(connections_mtx_, std::try_to_lock);
+                if(l && !connections_.empty())
+                {
+                    connection = std::move(connections_.front());
+                    connections_.pop_front();
+                }
+            }
+            if(connection)
+                return send_messages(std::move(connection));
+            return false;
+        }
+
+    private:
+        mutex_type connections_mtx_;
+        connection_list connections_;
+
+        std::atomic<std::uint64_t> next_segment_id_;
+    };
+}}}}
+
+#endif
+
+#endif
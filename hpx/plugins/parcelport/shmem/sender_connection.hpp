@@ -0,0 +1,350 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_SENDER_CONNECTION_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_SENDER_CONNECTION_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/performance_counters/parcels/gatherer.hpp>
+#include <hpx/plugins/parcelport/shmem/header.hpp>
+#include <hpx/plugins/parcelport/shmem/inbox.hpp>
+#include <hpx/plugins/parcelport/shmem/locality.hpp>
+#include <hpx/plugins/parcelport/shmem/segment.hpp>
+#include <hpx/runtime/parcelset/parcelport.hpp>
+#include <hpx/runtime/parcelset/parcelport_connection.hpp>
+#include <hpx/runtime/parcelset_fwd.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+#include <hpx/util/unique_function.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    struct sender;
+    class sender_connection;
+
+    std::uint64_t next_segment_id(sender *);
+    void add_connection(sender *, std::shared_ptr<sender_connection> const&);
+
+    // A sender_connection owns one slot in the inbox of the destination and
+    // streams messages into its ring. The send operation is resumed from the
+    // background work whenever the ring is full.
+    class sender_connection
+      : public parcelset::parcelport_connection<
+            sender_connection
+          , std::vector<char>
+        >
+    {
+    private:
+        typedef sender sender_type;
+
+        typedef std::vector<char> data_type;
+
+        enum connection_state
+        {
+            initialized
+          , sent_header
+          , sent_transmission_chunks
+          , sent_data
+          , sent_chunks
+        };
+
+    public:
+        sender_connection(
+            sender_type * s
+          , std::shared_ptr<inbox> const& there_inbox
+          , std::size_t slot
+          , std::int32_t pid
+          , std::uint64_t zero_copy_threshold
+          , parcelset::locality const& there
+          , parcelset::parcelport* pp
+        )
+          : state_(initialized)
+          , sender_(s)
+          , inbox_(there_inbox)
+          , slot_(slot)
+          , pid_(pid)
+          , zero_copy_threshold_(zero_copy_threshold)
+          , offset_(0)
+          , chunks_idx_(0)
+          , segments_idx_(0)
+          , bytes_written_(0)
+          , pp_(pp)
+          , there_(there)
+        {
+        }
+
+        ~sender_connection()
+        {
+            inbox_->disconnect(slot_);
+        }
+
+        parcelset::locality const& destination() const
+        {
+            return there_;
+        }
+
+        // the number of bytes written into the ring so far
+        std::uint64_t bytes_written() const
+        {
+            return bytes_written_;
+        }
+
+        void verify_(parcelset::locality const & parcel_locality_id) const
+        {
+        }
+
+        template <typename Handler, typename ParcelPostprocess>
+        void async_write(Handler && handler, ParcelPostprocess && parcel_postprocess)
+        {
+            HPX_ASSERT(!handler_);
+            HPX_ASSERT(!postprocess_handler_);
+            HPX_ASSERT(!buffer_.data_.empty());
+            HPX_ASSERT(buffer_.data_.size() == buffer_.size_);
+
+            buffer_.data_point_.time_ = util::high_resolution_clock::now();
+            header_ = header(buffer_, zero_copy_threshold_);
+            hand_over_chunks();
+
+            offset_ = 0;
+            chunks_idx_ = 0;
+            segments_idx_ = 0;
+            state_ = initialized;
+
+            handler_ = std::forward<Handler>(handler);
+
+            if(!send())
+            {
+                postprocess_handler_
+                    = std::forward<ParcelPostprocess>(parcel_postprocess);
+                add_connection(sender_, shared_from_this());
+            }
+            else
+            {
+                HPX_ASSERT(!handler_);
+                error_code ec;
+                parcel_postprocess(ec, there_, shared_from_this());
+            }
+        }
+
+        // Write as much of the message as fits into the ring, returns true
+        // once the message has been written completely.
+        bool send()
+        {
+            std::uint64_t const bytes_written = bytes_written_;
+            bool const completed = send_message();
+
+            // let the receiver know, if anything was published
+            if (bytes_written != bytes_written_)
+                inbox_->notify();
+
+            if (completed)
+                done();
+
+            return completed;
+        }
+
+        // Return false if the process of the destination has terminated,
+        // its ring will never be drained anymore.
+        bool receiver_alive() const
+        {
+            return inbox::process_alive(there_.get<locality>().pid());
+        }
+
+        // Give up on the message currently being written, the handlers are
+        // invoked with the given error. The segments handed over for the
+        // message are removed as well, a receiver which has not mapped them
+        // yet drops the message.
+        void abort(error_code const& ec)
+        {
+            for (std::uint64_t id : segment_ids_)
+                segment::remove(inbox::chunk_name(pid_, id));
+
+            handler_(ec);
+            handler_.reset();
+            buffer_.clear();
+            segment_ids_.clear();
+            state_ = initialized;
+
+            util::unique_function_nonser<
+                void(
+                    error_code const&
+                  , parcelset::locality const&
+                  , std::shared_ptr<sender_connection>
+                )
+            > postprocess_handler;
+            std::swap(postprocess_handler, postprocess_handler_);
+            if (postprocess_handler)
+                postprocess_handler(ec, there_, shared_from_this());
+        }
+
+    private:
+        // Large chunks are copied once into a segment of their own, the
+        // receiver maps that segment instead of reading the data from the
+        // ring. The receiver removes the segment after decoding.
+        void hand_over_chunks()
+        {
+            segment_ids_.clear();
+            for (serialization::serialization_chunk& c : buffer_.chunks_)
+            {
+                if (c.type_ == serialization::chunk_type_pointer &&
+                    header_.is_handed_over(c.size_))
+                {
+                    std::uint64_t id = next_segment_id(sender_);
+
+                    segment s;
+                    s.create(inbox::chunk_name(pid_, id), c.size_);
+                    std::memcpy(s.data(), c.data_.cpos_, c.size_);
+
+                    segment_ids_.push_back(id);
+                }
+            }
+        }
+
+        bool send_message()
+        {
+            switch(state_)
+            {
+            case initialized:
+                if (!write(&header_, sizeof(header_)))
+                    return false;
+                state_ = sent_header;
+                HPX_FALLTHROUGH;
+
+            case sent_header:
+                {
+                    std::vector<
+                        parcel_buffer_type::transmission_chunk_type
+                    >& chunks = buffer_.transmission_chunks_;
+                    if (!chunks.empty() &&
+                        !write(chunks.data(), chunks.size() *
+                            sizeof(parcel_buffer_type::transmission_chunk_type)))
+                    {
+                        return false;
+                    }
+                }
+                state_ = sent_transmission_chunks;
+                HPX_FALLTHROUGH;
+
+            case sent_transmission_chunks:
+                if (!write(buffer_.data_.data(), buffer_.data_.size()))
+                    return false;
+                state_ = sent_data;
+                HPX_FALLTHROUGH;
+
+            case sent_data:
+                while (chunks_idx_ != buffer_.chunks_.size())
+                {
+                    serialization::serialization_chunk& c =
+                        buffer_.chunks_[chunks_idx_];
+                    if (c.type_ == serialization::chunk_type_pointer)
+                    {
+                        if (header_.is_handed_over(c.size_))
+                        {
+                            HPX_ASSERT(segments_idx_ < segment_ids_.size());
+                            if (!write(&segment_ids_[segments_idx_],
+                                    sizeof(std::uint64_t)))
+                            {
+                                return false;
+                            }
+                            ++segments_idx_;
+                        }
+                        else if (!write(c.data_.cpos_, c.size_))
+                        {
+                            return false;
+                        }
+                    }
+                    ++chunks_idx_;
+                }
+                state_ = sent_chunks;
+                HPX_FALLTHROUGH;
+
+            case sent_chunks:
+                return true;
+
+            default:
+                HPX_ASSERT(false);
+            }
+            return false;
+        }
+
+        bool write(void const* data, std::size_t size)
+        {
+            std::size_t const written = inbox_->write(slot_,
+                static_cast<char const*>(data) + offset_, size - offset_);
+
+            bytes_written_ += written;
+            offset_ += written;
+            if (offset_ != size)
+                return false;
+
+            offset_ = 0;
+            return true;
+        }
+
+        void done()
+        {
+            error_code ec;
+            handler_(ec);
+            handler_.reset();
+            buffer_.data_point_.time_ =
+                util::high_resolution_clock::now() - buffer_.data_point_.time_;
+            pp_->add_sent_data(buffer_.data_point_);
+            buffer_.clear();
+            segment_ids_.clear();
+
+            state_ = initialized;
+        }
+
+    public:
+        util::unique_function_nonser<
+            void(
+                error_code const&
+              , parcelset::locality const&
+              , std::shared_ptr<sender_connection>
+            )
+        > postprocess_handler_;
+
+    private:
+        connection_state state_;
+        sender_type * sender_;
+
+        std::shared_ptr<inbox> inbox_;
+        std::size_t slot_;
+        std::int32_t pid_;
+        std::uint64_t zero_copy_threshold_;
+
+        util::unique_function_nonser<
+            void(
+                error_code const&
+            )
+        > handler_;
+
+        header header_;
+        std::vector<std::uint64_t> segment_ids_;
+
+        std::size_t offset_;
+        std::size_t chunks_idx_;
+        std::size_t segments_idx_;
+        std::uint64_t bytes_written_;
+
+        parcelset::parcelport* pp_;
+
+        parcelset::locality there_;
+    };
+}}}}
+
+#endif
+
+#endif
@@ -15,6 +15,7 @@
 #if defined(HPX_HAVE_PARCELPORT_TCP)
 #include <hpx/config/asio.hpp>
 
+#include <hpx/plugins/parcelport/tcp/io_uring.hpp>
 #include <hpx/plugins/parcelport/tcp/locality.hpp>
 #include <hpx/runtime/parcelset/locality.hpp>
 #include <hpx/runtime/parcelset/parcelport_impl.hpp>
@@ -24,6 +25,7 @@
 #include <boost/asio/ip/tcp.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <set>
 #include <string>
@@ -36,6 +38,7 @@ namespace hpx { namespace parcelset
 {
     namespace policies { namespace tcp
     {
+        class io_uring_service;
         class receiver;
         class sender;
         class HPX_EXPORT connection_handler;
@@ -110,7 +113,16 @@ namespace hpx { namespace parcelset
 
             parcelset::locality create_locality() const;
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            bool has_io_statistics() const override;
+            std::int64_t get_io_statistics(
+                io_statistics_type t, bool reset) override;
+#endif
+
         private:
+            boost::asio::io_service& get_io_service();
+            io_uring_service* get_io_uring() const;
+
             void handle_accept(boost::system::error_code const & e,
                 std::shared_ptr<receiver> receiver_conn);
             void handle_read_completion(boost::system::error_code const& e,
@@ -129,6 +141,16 @@ namespace hpx { namespace parcelset
             typedef std::set<boost::weak_ptr<sender> > write_connections_set;
             write_connections_set write_connections_;
 #endif
+
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            /// Reads and writes are performed through io_uring if enabled
+            /// (hpx.parcel.tcp.io_uring) and supported by the kernel.
+            bool enable_io_uring_;
+            std::size_t io_uring_entries_;
+            std::size_t io_uring_buffers_;
+            std::size_t io_uring_buffer_size_;
+            std::unique_ptr<io_uring_service> uring_;
+#endif
         };
     }}
 }}
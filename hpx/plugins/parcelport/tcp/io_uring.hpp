@@ -0,0 +1,191 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_TCP_IO_URING_HPP
+#define HPX_PARCELSET_POLICIES_TCP_IO_URING_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_TCP) && \
+    defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/util/unique_function.hpp>
+
+#include <boost/system/error_code.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <unordered_set>
+#include <vector>
+
+#include <sys/uio.h>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace parcelset { namespace policies { namespace tcp
+{
+    /// The io_uring_service performs the reads and writes of the TCP
+    /// parcelport through a Linux io_uring instance.
+    ///
+    /// Operations can be started from any thread, they are collected and
+    /// handed to the kernel in batches by a single thread executing run(),
+    /// which also invokes the completion handlers. A system call is needed
+    /// only if new operations have been queued or if the thread executing
+    /// run() has nothing to do and waits for completions. Threads starting
+    /// operations wake the waiting thread through an eventfd, but only if it
+    /// is actually waiting.
+    ///
+    /// A number of buffers can be registered with the kernel; reads and
+    /// writes from and to those buffers avoid mapping the user memory for
+    /// every operation.
+    class HPX_EXPORT io_uring_service
+    {
+    public:
+        HPX_NON_COPYABLE(io_uring_service);
+
+        typedef util::unique_function_nonser<
+            void(boost::system::error_code const&, std::size_t)
+        > handler_type;
+
+        // a buffer registered with the kernel
+        struct buffer
+        {
+            buffer()
+              : data_(nullptr), size_(0), index_(-1)
+            {}
+
+            char* data_;
+            std::size_t size_;
+            int index_;
+        };
+
+    private:
+        typedef lcos::local::spinlock mutex_type;
+
+        struct operation;
+
+    public:
+        io_uring_service();
+        ~io_uring_service();
+
+        /// Create the io_uring instance, returns false if io_uring is not
+        /// available (or lacks required features) on this system.
+        bool open(std::size_t entries, std::size_t num_buffers,
+            std::size_t buffer_size);
+
+        /// Acquire one of the registered buffers, returns false if none is
+        /// available.
+        bool acquire_buffer(buffer& b);
+        void release_buffer(buffer& b);
+
+        std::size_t buffer_size() const
+        {
+            return buffer_size_;
+        }
+
+        /// Write all of the given buffers.
+        void async_write(int fd, std::vector<iovec>&& buffers,
+            handler_type&& handler);
+
+        /// Fill all of the given buffers.
+        void async_read(int fd, std::vector<iovec>&& buffers,
+            handler_type&& handler);
+
+        /// Write the first \a size bytes of the given registered buffer.
+        void async_write_fixed(int fd, buffer const& b, std::size_t size,
+            handler_type&& handler);
+
+        /// Read at least one byte into the given (registered) buffer,
+        /// starting at \a offset.
+        void async_read_some(int fd, buffer const& b, std::size_t offset,
+            handler_type&& handler);
+
+        /// Submit operations and dispatch completions until stop() is
+        /// called. Operations which have not completed by then complete
+        /// with operation_aborted, as do operations started afterwards.
+        void run();
+        void stop();
+
+        /// The number of system calls issued (submissions, waiting for
+        /// completions and wake ups).
+        std::int64_t get_syscall_count(bool reset);
+
+        /// The number of completed operations.
+        std::int64_t get_operation_count(bool reset);
+
+    private:
+        void close();
+
+        void register_buffers(std::size_t num_buffers, std::size_t buffer_size);
+
+        void enqueue(operation* op);
+        unsigned fill_submission_queue(bool& exhausted);
+        void prepare(io_uring_sqe& sqe, operation* op);
+        bool has_completions() const;
+        void reap_completions();
+        void complete(operation* op, int result);
+        void abort(operation* op);
+        bool cancel_active();
+        void abort_operations(bool cancel);
+
+        int ring_fd_;
+        int event_fd_;
+
+        // the mapped submission and completion rings
+        void* ring_;
+        std::size_t ring_size_;
+        io_uring_sqe* sqes_;
+        std::size_t sqes_size_;
+
+        std::atomic<unsigned>* sq_head_;
+        std::atomic<unsigned>* sq_tail_;
+        unsigned* sq_array_;
+        unsigned sq_mask_;
+        unsigned sq_entries_;
+
+        std::atomic<unsigned>* cq_head_;
+        std::atomic<unsigned>* cq_tail_;
+        io_uring_cqe* cqes_;
+        unsigned cq_mask_;
+        unsigned cq_entries_;
+
+        // operations waiting to be submitted, whether the thread executing
+        // run() is waiting for completions, and whether it has exited
+        mutex_type mtx_;
+        std::deque<operation*> pending_;
+        bool sleeping_;
+        bool aborted_;
+
+        // operations submitted to the kernel, only accessed by run()
+        std::unordered_set<operation*> active_;
+        bool wakeup_armed_;
+        std::uint64_t wakeup_value_;
+        iovec wakeup_buffer_;
+
+        std::atomic<bool> stopped_;
+
+        // registered buffers
+        mutex_type buffers_mtx_;
+        char* buffers_;
+        std::size_t num_buffers_;
+        std::size_t buffer_size_;
+        std::vector<int> free_buffers_;
+
+        std::atomic<std::int64_t> syscalls_;
+        std::atomic<std::int64_t> operations_;
+    };
+}}}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
+
+#endif
@@ -19,7 +19,9 @@
 #include <hpx/config/asio.hpp>
 #include <hpx/performance_counters/parcels/data_point.hpp>
 #include <hpx/performance_counters/parcels/gatherer.hpp>
+#include <hpx/plugins/parcelport/tcp/io_uring.hpp>
 #include <hpx/runtime/parcelset/decode_parcels.hpp>
+#include <hpx/runtime/parcelset/detail/receive_buffer_pool.hpp>
 #include <hpx/runtime/parcelset/parcelport_connection.hpp>
 #include <hpx/util/assert.hpp>
 #include <hpx/util/bind.hpp>
@@ -33,25 +35,33 @@
 #include <boost/asio/read.hpp>
 #include <boost/asio/write.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <mutex>
 #include <sstream>
 #include <utility>
 #include <vector>
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+#include <sys/uio.h>
+#endif
+
 namespace hpx { namespace parcelset { namespace policies { namespace tcp
 {
     class connection_handler;
+    class io_uring_service;
 
     class receiver
       : public parcelport_connection<receiver, std::vector<char>, std::vector<char> >
     {
         typedef hpx::lcos::local::spinlock mutex_type;
+
     public:
         receiver(boost::asio::io_service& io_service, std::uint64_t max_inbound_size,
-            connection_handler& parcelport)
+            connection_handler& parcelport, io_uring_service* uring = nullptr)
           : socket_(io_service)
           , max_inbound_size_(max_inbound_size)
           , ack_(0)
@@ -59,6 +69,11 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
           , timer_()
           , mtx_()
           , operation_in_flight_(0)
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+          , uring_(uring)
+          , staged_begin_(0)
+          , staged_end_(0)
+#endif
         {}
 
         ~receiver()
@@ -112,6 +127,17 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                         std::size_t, Handler)
                     = &receiver::handle_read_header<Handler>;
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+                if (uring_ != nullptr)
+                {
+                    lk.unlock();
+                    async_read_uring(buffers, true,
+                        util::bind(f, shared_from_this(),
+                            util::placeholders::_1, util::placeholders::_2,
+                            util::protect(handler)));
+                    return;
+                }
+#endif
                 boost::asio::async_read(socket_, buffers,
                     util::bind(f, shared_from_this(),
                         boost::asio::placeholders::error,
@@ -196,7 +222,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                             sizeof(transmission_chunk_type)));
 
                     // add main buffer holding data which was serialized normally
-                    buffer_.data_.resize(static_cast<std::size_t>(inbound_size));
+                    buffer_.data_ = parcelset::detail::receive_buffer_pool::
+                        instance().get(static_cast<std::size_t>(inbound_size));
                     buffers.push_back(boost::asio::buffer(buffer_.data_));
 
                     // Start an asynchronous call to receive the data.
@@ -204,7 +231,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                 }
                 else {
                     // add main buffer holding data which was serialized normally
-                    buffer_.data_.resize(static_cast<std::size_t>(inbound_size));
+                    buffer_.data_ = parcelset::detail::receive_buffer_pool::
+                        instance().get(static_cast<std::size_t>(inbound_size));
                     buffers.push_back(boost::asio::buffer(buffer_.data_));
 
                     // Start an asynchronous call to receive the data.
@@ -225,6 +253,17 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                     boost::asio::detail::socket_option::boolean<
                         IPPROTO_TCP, TCP_QUICKACK> quickack(true);
                     socket_.set_option(quickack);
+#endif
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+                    if (uring_ != nullptr)
+                    {
+                        lk.unlock();
+                        async_read_uring(buffers, false,
+                            util::bind(f, shared_from_this(),
+                                util::placeholders::_1,
+                                util::protect(handler)));
+                        return;
+                    }
 #endif
                     boost::asio::async_read(socket_, buffers,
                         util::bind(f, shared_from_this(),
@@ -284,6 +323,17 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                     boost::asio::detail::socket_option::boolean<
                         IPPROTO_TCP, TCP_QUICKACK> quickack(true);
                     socket_.set_option(quickack);
+#endif
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+                    if (uring_ != nullptr)
+                    {
+                        lk.unlock();
+                        async_read_uring(buffers, false,
+                            util::bind(f, shared_from_this(),
+                                util::placeholders::_1,
+                                util::protect(handler)));
+                        return;
+                    }
 #endif
                     boost::asio::async_read(socket_, buffers,
                         util::bind(f, shared_from_this(),
@@ -315,9 +365,14 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                         Handler)
                     = &receiver::handle_write_ack<Handler>;
 
-                // decode the received parcels.
-                decode_parcels(parcelport_, std::move(buffer_), -1);
-                buffer_ = parcel_buffer_type();
+                // decode the received parcels, the buffer is given back to
+                // be reused for the next message received by any connection,
+                // only the zero-copy chunks are handed over to the decoded
+                // objects
+                decode_parcels_in_place(parcelport_, buffer_, -1);
+                parcelset::detail::receive_buffer_pool::instance().release(
+                    std::move(buffer_.data_));
+                buffer_.clear();
 
                 ack_ = true;
                 {
@@ -330,6 +385,22 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                             boost::asio::error::not_connected));
                         return;
                     }
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+                    if (uring_ != nullptr)
+                    {
+                        int fd = socket_.native_handle();
+                        lk.unlock();
+
+                        iovec ack;
+                        ack.iov_base = &ack_;
+                        ack.iov_len = sizeof(ack_);
+                        uring_->async_write(fd, std::vector<iovec>(1, ack),
+                            util::bind(f, shared_from_this(),
+                                util::placeholders::_1,
+                                util::protect(handler)));
+                        return;
+                    }
+#endif
                     boost::asio::async_write(socket_,
                         boost::asio::buffer(&ack_, sizeof(ack_)),
                         util::bind(f, shared_from_this(),
@@ -355,6 +426,132 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
             }
         }
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        // Reads issued while waiting for the header of a message go through
+        // a staging buffer and pick up as much of the following data as is
+        // available. Small messages are this way received with a single read
+        // operation. Everything not read ahead is read directly into the
+        // parcel buffer.
+        void async_read_uring(
+            std::vector<boost::asio::mutable_buffer> const& buffers,
+            bool read_ahead, io_uring_service::handler_type&& handler)
+        {
+            HPX_ASSERT(!pending_handler_);
+
+            pending_buffers_.clear();
+            pending_buffers_.reserve(buffers.size());
+            for (boost::asio::mutable_buffer const& b : buffers)
+            {
+                iovec v;
+                v.iov_base = boost::asio::buffer_cast<void*>(b);
+                v.iov_len = boost::asio::buffer_size(b);
+                pending_buffers_.push_back(v);
+            }
+            pending_handler_ = std::move(handler);
+
+            if (read_ahead && staging_.data_ == nullptr)
+            {
+                // The read ahead waits for the next message, which might not
+                // arrive for a long time. It goes to memory owned by this
+                // connection, the registered buffers are left to the senders
+                // which hold them only while writing a message.
+                staging_storage_.resize(uring_->buffer_size() != 0 ?
+                    uring_->buffer_size() : std::size_t(16384));
+                staging_.data_ = staging_storage_.data();
+                staging_.size_ = staging_storage_.size();
+            }
+
+            continue_read_uring(read_ahead);
+        }
+
+        void continue_read_uring(bool read_ahead)
+        {
+            consume_staged();
+            if (pending_buffers_.empty())
+            {
+                io_uring_service::handler_type handler;
+                std::swap(handler, pending_handler_);
+                handler(boost::system::error_code(), 0);
+                return;
+            }
+
+            int fd = -1;
+            {
+                std::unique_lock<mutex_type> lk(mtx_);
+                if (!socket_.is_open())
+                {
+                    lk.unlock();
+
+                    io_uring_service::handler_type handler;
+                    std::swap(handler, pending_handler_);
+                    handler(boost::asio::error::make_error_code(
+                        boost::asio::error::not_connected), 0);
+                    return;
+                }
+                fd = socket_.native_handle();
+            }
+
+            if (read_ahead)
+            {
+                // the staging buffer has been drained completely
+                HPX_ASSERT(staged_begin_ == staged_end_);
+                staged_begin_ = staged_end_ = 0;
+
+                using util::placeholders::_1;
+                using util::placeholders::_2;
+                uring_->async_read_some(fd, staging_, 0,
+                    util::bind(&receiver::handle_read_ahead,
+                        shared_from_this(), _1, _2));
+            }
+            else
+            {
+                io_uring_service::handler_type handler;
+                std::swap(handler, pending_handler_);
+                uring_->async_read(fd, std::move(pending_buffers_),
+                    std::move(handler));
+            }
+        }
+
+        void handle_read_ahead(boost::system::error_code const& e,
+            std::size_t bytes_transferred)
+        {
+            if (e)
+            {
+                io_uring_service::handler_type handler;
+                std::swap(handler, pending_handler_);
+                handler(e, 0);
+                return;
+            }
+
+            staged_end_ = bytes_transferred;
+            continue_read_uring(true);
+        }
+
+        // copy the data read ahead into the pending buffers, remove those
+        // buffers which are filled completely
+        void consume_staged()
+        {
+            for (iovec& v : pending_buffers_)
+            {
+                if (staged_begin_ == staged_end_)
+                    break;
+
+                std::size_t size = (std::min)(v.iov_len,
+                    staged_end_ - staged_begin_);
+                std::memcpy(v.iov_base, staging_.data_ + staged_begin_, size);
+
+                staged_begin_ += size;
+                v.iov_base = static_cast<char*>(v.iov_base) + size;
+                v.iov_len -= size;
+            }
+
+            pending_buffers_.erase(
+                std::remove_if(pending_buffers_.begin(), pending_buffers_.end(),
+                    [](iovec const& v) { return v.iov_len == 0; }),
+                pending_buffers_.end());
+        }
+#endif
+
 
         /// Socket for the parcelport_connection.
         boost::asio::ip::tcp::socket socket_;
@@ -371,6 +568,20 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
         mutex_type mtx_;
         hpx::util::atomic_count operation_in_flight_;
+
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        io_uring_service* uring_;
+
+        // data read ahead of the current message
+        io_uring_service::buffer staging_;
+        std::vector<char> staging_storage_;
+        std::size_t staged_begin_;
+        std::size_t staged_end_;
+
+        // the read operation in progress
+        std::vector<iovec> pending_buffers_;
+        io_uring_service::handler_type pending_handler_;
+#endif
     };
 }}}}
 
@@ -16,6 +16,7 @@
 #include <hpx/config/asio.hpp>
 #include <hpx/performance_counters/parcels/data_point.hpp>
 #include <hpx/performance_counters/parcels/gatherer.hpp>
+#include <hpx/plugins/parcelport/tcp/io_uring.hpp>
 #include <hpx/plugins/parcelport/tcp/locality.hpp>
 #include <hpx/runtime/parcelset/locality.hpp>
 #include <hpx/runtime/parcelset/parcelport.hpp>
@@ -41,8 +42,14 @@
 #include <utility>
 #include <vector>
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+#include <sys/uio.h>
+#endif
+
 namespace hpx { namespace parcelset { namespace policies { namespace tcp
 {
+    class io_uring_service;
+
     class sender
       : public parcelset::parcelport_connection<sender, std::vector<char> >
     {
@@ -51,14 +58,19 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
     public:
         /// Construct a sending parcelport_connection with the given io_service.
+        /// All data is sent through the given io_uring instance, if any.
         sender(boost::asio::io_service& io_service,
                 parcelset::locality const& locality_id,
-                parcelset::parcelport* pp)
+                parcelset::parcelport* pp,
+                io_uring_service* uring = nullptr)
           : socket_(io_service)
           , ack_(0)
           , there_(locality_id)
           , timer_()
           , pp_(pp)
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+          , uring_(uring)
+#endif
         {
         }
 
@@ -165,11 +177,54 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
             using util::placeholders::_1;
             using util::placeholders::_2;
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            if (uring_ != nullptr)
+            {
+                async_write_uring(buffers,
+                    util::bind(f, shared_from_this(), _1, _2));
+                return;
+            }
+#endif
             boost::asio::async_write(socket_, buffers,
                 util::bind(f, shared_from_this(), _1, _2));
         }
 
     private:
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        // Messages fitting into one of the buffers registered with the kernel
+        // are copied into it and written with a single fixed-buffer write,
+        // all others are written directly from the parcel buffer.
+        void async_write_uring(
+            std::vector<boost::asio::const_buffer> const& buffers,
+            io_uring_service::handler_type&& handler)
+        {
+            int fd = socket_.native_handle();
+
+            std::size_t size = boost::asio::buffer_size(buffers);
+            if (size <= uring_->buffer_size() &&
+                uring_->acquire_buffer(fixed_buffer_))
+            {
+                boost::asio::buffer_copy(
+                    boost::asio::buffer(fixed_buffer_.data_, size), buffers);
+                uring_->async_write_fixed(fd, fixed_buffer_, size,
+                    std::move(handler));
+                return;
+            }
+
+            std::vector<iovec> iov;
+            iov.reserve(buffers.size());
+            for (boost::asio::const_buffer const& b : buffers)
+            {
+                iovec v;
+                v.iov_base = const_cast<void*>(
+                    boost::asio::buffer_cast<void const*>(b));
+                v.iov_len = boost::asio::buffer_size(b);
+                iov.push_back(v);
+            }
+            uring_->async_write(fd, std::move(iov), std::move(handler));
+        }
+#endif
+
         static void reset_handler(postprocess_handler_type handler)
         {
             handler.reset();
@@ -180,6 +235,10 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         {
 #if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
             state_ = state_handle_write;
+#endif
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            if (fixed_buffer_.data_ != nullptr)
+                uring_->release_buffer(fixed_buffer_);
 #endif
             // just call initial handler
             handler_(e);
@@ -230,6 +289,18 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                 = &sender::handle_read_ack;
 
             using util::placeholders::_1;
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            if (uring_ != nullptr)
+            {
+                iovec ack;
+                ack.iov_base = &ack_;
+                ack.iov_len = sizeof(ack_);
+                uring_->async_read(socket_.native_handle(),
+                    std::vector<iovec>(1, ack),
+                    util::bind(f, shared_from_this(), _1));
+                return;
+            }
+#endif
             boost::asio::async_read(socket_,
                 boost::asio::buffer(&ack_, sizeof(ack_)),
                 util::bind(f, shared_from_this(), _1));
@@ -267,6 +338,11 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         util::high_resolution_timer timer_;
         parcelset::parcelport* pp_;
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        io_uring_service* uring_;
+        io_uring_service::buffer fixed_buffer_;
+#endif
+
         postprocess_handler_type handler_;
         util::unique_function_nonser<
             void(
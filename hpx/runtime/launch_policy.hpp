@@ -28,11 +28,13 @@ namespace hpx
             sync = 0x08,
             fork = 0x10,  // same as async, but forces continuation stealing
             apply = 0x20,
+            adaptive = 0x40,  // run continuations inline if possible, async
+                              // otherwise
 
             sync_policies = 0x0a,       // sync | deferred
-            async_policies = 0x15,      // async | task | fork
-            all = 0x3f                  // async | deferred | task | sync |
-                                        // fork | apply
+            async_policies = 0x55,      // async | task | fork | adaptive
+            all = 0x7f                  // async | deferred | task | sync |
+                                        // fork | apply | adaptive
         };
 
         struct policy_holder_base
@@ -174,6 +176,21 @@ namespace hpx
             }
         };
 
+        struct adaptive_policy : policy_holder<adaptive_policy>
+        {
+            HPX_CONSTEXPR explicit adaptive_policy(
+                    threads::thread_priority priority =
+                        threads::thread_priority_default) noexcept
+              : policy_holder<adaptive_policy>(launch_policy::adaptive, priority)
+            {}
+
+            HPX_CONSTEXPR adaptive_policy operator()(
+                threads::thread_priority priority) const noexcept
+            {
+                return adaptive_policy(priority);
+            }
+        };
+
         struct sync_policy : policy_holder<sync_policy>
         {
             HPX_CONSTEXPR sync_policy() noexcept
@@ -360,6 +377,12 @@ namespace hpx
           : detail::policy_holder<>{detail::launch_policy::fork}
         {}
 
+        /// Create a launch policy representing adaptive execution of
+        /// continuations
+        HPX_CONSTEXPR launch(detail::adaptive_policy) noexcept
+          : detail::policy_holder<>{detail::launch_policy::adaptive}
+        {}
+
         /// Create a launch policy representing synchronous execution
         HPX_CONSTEXPR launch(detail::sync_policy) noexcept
           : detail::policy_holder<>{detail::launch_policy::sync}
@@ -385,6 +408,7 @@ namespace hpx
         /// \cond NOINTERNAL
         using async_policy = detail::async_policy;
         using fork_policy = detail::fork_policy;
+        using adaptive_policy = detail::adaptive_policy;
         using sync_policy = detail::sync_policy;
         using deferred_policy = detail::deferred_policy;
         using apply_policy = detail::apply_policy;
@@ -400,6 +424,14 @@ namespace hpx
         /// new thread is executed in a preferred way
         HPX_EXPORT static const detail::fork_policy fork;
 
+        /// Predefined launch policy representing adaptive execution of
+        /// continuations. A continuation is run inline on the thread which
+        /// made its predecessor ready if the nesting depth of inline
+        /// continuations (see HPX_CONTINUATION_MAX_INLINE_DEPTH) and the
+        /// available stack space permit, otherwise it is run on a new thread.
+        /// For all other purposes this is equivalent to \a launch::async.
+        HPX_EXPORT static const detail::adaptive_policy adaptive;
+
         /// Predefined launch policy representing synchronous execution
         HPX_EXPORT static const detail::sync_policy sync;
 
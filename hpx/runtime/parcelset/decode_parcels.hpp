@@ -27,6 +27,7 @@
 #include <cstdint>
 #include <exception>
 #include <functional>
+#include <memory>
 #include <sstream>
 #include <utility>
 #include <vector>
@@ -101,14 +102,30 @@ namespace hpx { namespace parcelset
         return chunks;
     }
 
+    namespace detail
+    {
+        // The chunks are moved into a separate object, the pointers created
+        // by decode_chunks stay valid.
+        template <typename Buffer>
+        std::shared_ptr<void> take_chunks(Buffer & buffer)
+        {
+            typedef decltype(buffer.chunks_) chunks_type;
+            return std::make_shared<chunks_type>(std::move(buffer.chunks_));
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
+    // The buffer is left with the caller, its data is not referenced anymore
+    // after this returns. The memory of the zero-copy chunks may be used in
+    // place by the decoded objects if chunks_owner keeps it alive.
     template <typename Parcelport, typename Buffer>
-    void decode_message_with_chunks(
+    void decode_message_in_place(
         Parcelport & pp
-      , Buffer buffer
+      , Buffer & buffer
       , std::size_t parcel_count
       , std::vector<serialization::serialization_chunk> &chunks
-      , std::size_t num_thread = -1
+      , std::size_t num_thread
+      , std::shared_ptr<void> chunks_owner
     )
     {
         std::size_t inbound_data_size = static_cast<std::size_t>(
@@ -127,7 +144,7 @@ namespace hpx { namespace parcelset
                     std::vector<parcel> deferred_parcels;
                     // De-serialize the parcel data
                     serialization::input_archive archive(buffer.data_,
-                        inbound_data_size, &chunks);
+                        inbound_data_size, &chunks, std::move(chunks_owner));
 
                     if(parcel_count == 0)
                     {
@@ -269,6 +286,19 @@ namespace hpx { namespace parcelset
         }
     }
 
+    template <typename Parcelport, typename Buffer>
+    void decode_message_with_chunks(
+        Parcelport & pp
+      , Buffer buffer
+      , std::size_t parcel_count
+      , std::vector<serialization::serialization_chunk> &chunks
+      , std::size_t num_thread = -1
+    )
+    {
+        decode_message_in_place(pp, buffer, parcel_count, chunks,
+            num_thread, std::shared_ptr<void>());
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Parcelport, typename Buffer>
     void decode_message(
@@ -280,8 +310,14 @@ namespace hpx { namespace parcelset
     {
         std::vector<serialization::serialization_chunk>
             chunks(decode_chunks(buffer));
-        decode_message_with_chunks(pp, std::move(buffer),
-            parcel_count, chunks, num_thread);
+
+        // the buffer is owned here, the zero-copy chunks can be handed over
+        std::shared_ptr<void> chunks_owner;
+        if (!chunks.empty())
+            chunks_owner = detail::take_chunks(buffer);
+
+        decode_message_in_place(pp, buffer, parcel_count, chunks,
+            num_thread, std::move(chunks_owner));
     }
 
     template <typename Parcelport, typename Buffer>
@@ -322,6 +358,24 @@ namespace hpx { namespace parcelset
         }
     }
 
+    /// Decode the parcels received into a buffer which stays with the
+    /// caller. The zero-copy chunks are taken out of the buffer, everything
+    /// else is left in place and can be reused for the next message.
+    template <typename Parcelport, typename Buffer>
+    void decode_parcels_in_place(Parcelport & parcelport, Buffer & buffer,
+        std::size_t num_thread)
+    {
+        std::vector<serialization::serialization_chunk>
+            chunks(decode_chunks(buffer));
+
+        std::shared_ptr<void> chunks_owner;
+        if (!chunks.empty())
+            chunks_owner = detail::take_chunks(buffer);
+
+        decode_message_in_place(parcelport, buffer, 0, chunks,
+            num_thread, std::move(chunks_owner));
+    }
+
 }}
 
 #endif
@@ -0,0 +1,197 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_DETAIL_PARCEL_QUEUES_HPP
+#define HPX_PARCELSET_DETAIL_PARCEL_QUEUES_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/runtime/parcelset/locality.hpp>
+#include <hpx/runtime/parcelset/parcel.hpp>
+#include <hpx/util/function.hpp>
+
+#include <boost/system/error_code.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace parcelset { namespace detail
+{
+    typedef util::function_nonser<
+        void(boost::system::error_code const&, parcel const&)
+    > parcel_write_handler_type;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The parcels waiting to be sent to one destination. Any number of
+    // threads may enqueue parcels concurrently without ever waiting for each
+    // other. Consumers are serialized by a lock, they either take all of the
+    // parcels queued at once or the oldest one.
+    class HPX_EXPORT destination_queue
+    {
+    public:
+        HPX_NON_COPYABLE(destination_queue);
+
+    private:
+        typedef lcos::local::spinlock mutex_type;
+
+        struct node;
+
+    public:
+        explicit destination_queue(locality const& dest);
+        ~destination_queue();
+
+        locality const& destination() const
+        {
+            return dest_;
+        }
+
+        bool empty() const
+        {
+            return head_.load() == nullptr && taken_.load() == nullptr;
+        }
+
+        // The number of parcels queued, this might be larger than the actual
+        // number while parcels are being enqueued.
+        std::int64_t size() const
+        {
+            return size_.load(std::memory_order_relaxed);
+        }
+
+        void enqueue(parcel&& p, parcel_write_handler_type&& f);
+        void enqueue(std::vector<parcel>&& parcels,
+            std::vector<parcel_write_handler_type>&& handlers);
+
+        // Append all queued parcels in the order they were enqueued, returns
+        // false if there was nothing to dequeue.
+        bool dequeue(std::vector<parcel>& parcels,
+            std::vector<parcel_write_handler_type>& handlers);
+
+        // Dequeue the parcel which was enqueued first, returns false if there
+        // was nothing to dequeue.
+        bool dequeue(parcel& p, parcel_write_handler_type& f);
+
+    private:
+        friend class parcel_queues;
+
+        static node* create_node(parcel&& p, parcel_write_handler_type&& f);
+        static void destroy_node(node* n);
+
+        void push(node* first, node* last, std::size_t count);
+        static node* reverse(node* n, std::size_t& count);
+
+        // the most recently enqueued parcel
+        std::atomic<node*> head_;
+        std::atomic<std::int64_t> size_;
+
+        // serializes the consumers, protects taken_
+        mutex_type mtx_;
+
+        // the parcels taken off the stack by dequeuing a single parcel, in
+        // the order they were enqueued in, those are older than any parcel
+        // on the stack
+        std::atomic<node*> taken_;
+
+        // set while this queue is linked into the ready list
+        std::atomic<bool> ready_;
+        destination_queue* next_ready_;
+
+        locality const dest_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The destination queues of a parcelport. Looking up the queue of a
+    // destination does not acquire any lock: the map is replaced as a whole
+    // whenever a new destination is added, readers only announce themselves
+    // in a counter which is private to the worker thread they are running
+    // on. Replaced maps are released as soon as no readers are active
+    // anymore, either while adding a destination or while looking one up.
+    //
+    // Destinations for which no connection was available are kept in a
+    // separate list, this way the background work only visits those.
+    class HPX_EXPORT parcel_queues
+    {
+    public:
+        HPX_NON_COPYABLE(parcel_queues);
+
+    private:
+        typedef lcos::local::spinlock mutex_type;
+        typedef std::map<locality, destination_queue*> map_type;
+
+        struct reader_slot
+        {
+            reader_slot()
+              : count_(0)
+            {}
+
+            std::atomic<std::int64_t> count_;
+
+            // avoid false sharing between neighboring workers
+            char pad_[64];
+        };
+
+    public:
+        parcel_queues();
+        ~parcel_queues();
+
+        // Return the queue for the given destination, nullptr if nothing was
+        // ever sent there.
+        destination_queue* find(locality const& dest) const;
+
+        // Return the queue for the given destination, create it if needed.
+        destination_queue& get(locality const& dest);
+
+        // Remember the queue to be visited by take_ready.
+        void set_ready(destination_queue& q);
+
+        bool has_ready() const
+        {
+            return ready_.load(std::memory_order_relaxed) != nullptr;
+        }
+
+        // Take all queues marked as ready since the last call.
+        void take_ready(std::vector<destination_queue*>& destinations);
+
+        // Dequeue the oldest parcel of any of the destinations.
+        bool dequeue_any(locality& dest, parcel& p,
+            parcel_write_handler_type& f);
+
+        // The overall number of parcels queued.
+        std::int64_t size() const;
+
+    private:
+        reader_slot& get_slot() const;
+        std::int64_t count_readers() const;
+
+        // release the replaced maps if nobody can access them anymore
+        void release_retired() const;
+        void release_retired_locked() const;
+
+        std::size_t const num_slots_;
+        std::unique_ptr<reader_slot[]> slots_;
+
+        std::atomic<map_type const*> map_;
+
+        // serializes adding destinations, protects the members below
+        mutable mutex_type mtx_;
+        mutable std::vector<std::unique_ptr<map_type const> > retired_;
+        std::vector<std::unique_ptr<destination_queue> > queues_;
+
+        // set while retired_ is not empty
+        mutable std::atomic<bool> has_retired_;
+
+        // the list of queues marked as ready
+        std::atomic<destination_queue*> ready_;
+    };
+}}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
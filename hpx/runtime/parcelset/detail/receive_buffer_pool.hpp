@@ -0,0 +1,63 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_DETAIL_RECEIVE_BUFFER_POOL_HPP
+#define HPX_PARCELSET_DETAIL_RECEIVE_BUFFER_POOL_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+
+#include <cstddef>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace parcelset { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The buffers the main data of incoming messages is received into. They
+    // are shared between all connections of all parcelports, this way the
+    // memory kept around does not grow with the number of connections.
+    // Buffers larger than max_buffer_size are not retained, neither are
+    // buffers exceeding max_retained_size overall.
+    class HPX_EXPORT receive_buffer_pool
+    {
+    public:
+        HPX_NON_COPYABLE(receive_buffer_pool);
+
+    private:
+        typedef lcos::local::spinlock mutex_type;
+
+    public:
+        static HPX_CONSTEXPR_OR_CONST std::size_t max_buffer_size =
+            1024 * 1024;
+        static HPX_CONSTEXPR_OR_CONST std::size_t max_retained_size =
+            16 * 1024 * 1024;
+
+        receive_buffer_pool();
+
+        static receive_buffer_pool& instance();
+
+        // Return a buffer of the given size, its contents are unspecified.
+        std::vector<char> get(std::size_t size);
+
+        // Give back a buffer which is not referenced anymore.
+        void release(std::vector<char>&& buffer);
+
+        // The overall capacity of the buffers currently retained.
+        std::size_t retained_size() const;
+
+    private:
+        struct tag {};
+
+        mutable mutex_type mtx_;
+        std::vector<std::vector<char> > buffers_;
+        std::size_t retained_size_;
+    };
+}}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
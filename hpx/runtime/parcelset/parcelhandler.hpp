@@ -392,6 +392,9 @@ namespace hpx { namespace parcelset
         std::int64_t get_connection_cache_statistics(std::string const& pp_type,
             parcelport::connection_cache_statistics_type stat_type, bool) const;
 
+        std::int64_t get_io_statistics(std::string const& pp_type,
+            parcelport::io_statistics_type stat_type, bool) const;
+
         void list_parcelports(std::ostringstream& strm) const;
         void list_parcelport(std::ostringstream& strm,
             std::string const& ppname, int priority, bool bootstrap) const;
@@ -429,6 +432,7 @@ namespace hpx { namespace parcelset
 
         void register_counter_types(std::string const& pp_type);
         void register_connection_cache_counter_types(std::string const& pp_type);
+        void register_io_counter_types(std::string const& pp_type);
 
     private:
         int get_priority(std::string const& name) const
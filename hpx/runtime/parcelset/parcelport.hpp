@@ -15,6 +15,7 @@
 #include <hpx/performance_counters/parcels/data_point.hpp>
 #include <hpx/performance_counters/parcels/gatherer.hpp>
 #include <hpx/runtime/applier_fwd.hpp>
+#include <hpx/runtime/parcelset/detail/parcel_queues.hpp>
 #include <hpx/runtime/parcelset/detail/per_action_data_counter.hpp>
 #include <hpx/runtime/parcelset/locality.hpp>
 #include <hpx/runtime/parcelset/parcel.hpp>
@@ -62,9 +63,7 @@ namespace hpx { namespace parcelset
         friend struct agas::big_boot_barrier;
 
     public:
-        typedef util::function_nonser<
-            void(boost::system::error_code const&, parcel const&)
-        > write_handler_type;
+        typedef detail::parcel_write_handler_type write_handler_type;
 
         typedef util::function_nonser<
             void(parcelport& pp, std::shared_ptr<std::vector<char> >,
@@ -178,6 +177,25 @@ namespace hpx { namespace parcelset
         virtual std::int64_t get_connection_cache_statistics(
             connection_cache_statistics_type, bool reset) = 0;
 
+        /// Return the given I/O statistic
+        enum io_statistics_type
+        {
+            io_syscalls = 0,
+            io_operations = 1
+        };
+
+        // parcelports driving their own I/O report the number of system
+        // calls and I/O operations they issued
+        virtual bool has_io_statistics() const
+        {
+            return false;
+        }
+
+        virtual std::int64_t get_io_statistics(io_statistics_type, bool /*reset*/)
+        {
+            return 0;
+        }
+
         /// Return the name of this locality
         virtual std::string get_locality_name() const = 0;
 
@@ -331,17 +349,8 @@ namespace hpx { namespace parcelset
 
         hpx::applier::applier *applier_;
 
-        /// The cache for pending parcels
-        typedef util::tuple<
-            std::vector<parcel>
-          , std::vector<write_handler_type>
-        > map_second_type;
-        typedef std::map<locality, map_second_type> pending_parcels_map;
-        pending_parcels_map pending_parcels_;
-
-        typedef std::set<locality> pending_parcels_destinations;
-        pending_parcels_destinations parcel_destinations_;
-        std::atomic<std::uint32_t> num_parcel_destinations_;
+        /// The queues of pending parcels, one for each destination
+        detail::parcel_queues pending_parcels_;
 
         /// The local locality
         locality here_;
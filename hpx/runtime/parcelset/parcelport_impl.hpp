@@ -617,164 +617,51 @@ namespace hpx { namespace parcelset
         void enqueue_parcel(locality const& locality_id,
             parcel&& p, write_handler_type&& f)
         {
-            typedef pending_parcels_map::mapped_type mapped_type;
-
-            std::unique_lock<lcos::local::spinlock> l(mtx_);
-            // We ignore the lock here. It might happen that while enqueuing,
-            // we need to acquire a lock. This should not cause any problems
-            // (famous last words)
-            util::ignore_while_checking<
-                std::unique_lock<lcos::local::spinlock>
-            > il(&l);
-
-            mapped_type& e = pending_parcels_[locality_id];
-            util::get<0>(e).push_back(std::move(p));
-            util::get<1>(e).push_back(std::move(f));
-
-            parcel_destinations_.insert(locality_id);
-            ++num_parcel_destinations_;
+            pending_parcels_.get(locality_id).enqueue(
+                std::move(p), std::move(f));
         }
 
         void enqueue_parcels(locality const& locality_id,
             std::vector<parcel>&& parcels,
             std::vector<write_handler_type>&& handlers)
         {
-            typedef pending_parcels_map::mapped_type mapped_type;
-
-            std::unique_lock<lcos::local::spinlock> l(mtx_);
-            // We ignore the lock here. It might happen that while enqueuing,
-            // we need to acquire a lock. This should not cause any problems
-            // (famous last words)
-            util::ignore_while_checking<
-                std::unique_lock<lcos::local::spinlock>
-            > il(&l);
-
             HPX_ASSERT(parcels.size() == handlers.size());
 
-            mapped_type& e = pending_parcels_[locality_id];
-            if (util::get<0>(e).empty())
-            {
-                HPX_ASSERT(util::get<1>(e).empty());
-                std::swap(util::get<0>(e), parcels);
-                std::swap(util::get<1>(e), handlers);
-            }
-            else
-            {
-                HPX_ASSERT(util::get<0>(e).size() == util::get<1>(e).size());
-                std::size_t new_size = util::get<0>(e).size() + parcels.size();
-                util::get<0>(e).reserve(new_size);
-
-                std::move(parcels.begin(), parcels.end(),
-                    std::back_inserter(util::get<0>(e)));
-                util::get<1>(e).reserve(new_size);
-                std::move(handlers.begin(), handlers.end(),
-                    std::back_inserter(util::get<1>(e)));
-            }
-
-            parcel_destinations_.insert(locality_id);
-            ++num_parcel_destinations_;
+            pending_parcels_.get(locality_id).enqueue(
+                std::move(parcels), std::move(handlers));
         }
 
         bool dequeue_parcels(locality const& locality_id,
             std::vector<parcel>& parcels,
             std::vector<write_handler_type>& handlers)
         {
-            typedef pending_parcels_map::iterator iterator;
-
-            {
-                std::unique_lock<lcos::local::spinlock> l(mtx_, std::try_to_lock);
-
-                if (!l) return false;
-
-                iterator it = pending_parcels_.find(locality_id);
-
-                // do nothing if parcels have already been picked up by
-                // another thread
-                if (it != pending_parcels_.end() && !util::get<0>(it->second).empty())
-                {
-                    HPX_ASSERT(it->first == locality_id);
-                    HPX_ASSERT(handlers.size() == 0);
-                    HPX_ASSERT(handlers.size() == parcels.size());
-                    std::swap(parcels, util::get<0>(it->second));
-                    HPX_ASSERT(util::get<0>(it->second).size() == 0);
-                    std::swap(handlers, util::get<1>(it->second));
-                    HPX_ASSERT(handlers.size() == parcels.size());
-
-                    HPX_ASSERT(!handlers.empty());
-                }
-                else
-                {
-                    HPX_ASSERT(util::get<1>(it->second).empty());
-                    return false;
-                }
-
-                parcel_destinations_.erase(locality_id);
+            HPX_ASSERT(parcels.empty() && handlers.empty());
 
-                HPX_ASSERT(0 != num_parcel_destinations_.load());
-                --num_parcel_destinations_;
-
-                return true;
-            }
+            // do nothing if parcels have already been picked up by another
+            // thread
+            detail::destination_queue* q = pending_parcels_.find(locality_id);
+            return q != nullptr && q->dequeue(parcels, handlers);
         }
 
     protected:
         bool dequeue_parcel(locality& dest, parcel& p, write_handler_type& handler)
         {
-            {
-                std::unique_lock<lcos::local::spinlock> l(mtx_, std::try_to_lock);
-
-                if (!l) return false;
-
-                for (auto &pending: pending_parcels_)
-                {
-                    auto &parcels = util::get<0>(pending.second);
-                    if (!parcels.empty())
-                    {
-                        auto& handlers = util::get<1>(pending.second);
-                        dest = pending.first;
-                        p = std::move(parcels.back());
-                        parcels.pop_back();
-                        handler = std::move(handlers.back());
-                        handlers.pop_back();
-
-                        if (parcels.empty())
-                        {
-                            pending_parcels_.erase(dest);
-                        }
-                        return true;
-                    }
-                }
-            }
-            return false;
+            return pending_parcels_.dequeue_any(dest, p, handler);
         }
 
         bool trigger_pending_work()
         {
-            if (0 == num_parcel_destinations_.load(std::memory_order_relaxed))
+            if (!pending_parcels_.has_ready())
                 return true;
 
-            std::vector<locality> destinations;
-
-            {
-                std::unique_lock<lcos::local::spinlock> l(mtx_, std::try_to_lock);
-                if(l.owns_lock())
-                {
-                    if (parcel_destinations_.empty())
-                        return true;
-
-                    destinations.reserve(parcel_destinations_.size());
-                    for (locality const& loc : parcel_destinations_)
-                    {
-                        destinations.push_back(loc);
-                    }
-                }
-            }
+            std::vector<detail::destination_queue*> destinations;
+            pending_parcels_.take_ready(destinations);
 
             // Create new HPX threads which send the parcels that are still
             // pending.
-            for (locality const& loc : destinations)
+            for (detail::destination_queue* q : destinations)
             {
-                get_connection_and_send_parcels(loc);
+                get_connection_and_send_parcels(q->destination());
             }
 
             return true;
@@ -807,7 +694,11 @@ namespace hpx { namespace parcelset
                 // We can safely return if no connection is available
                 // at this point. As soon as a connection becomes
                 // available it checks for pending parcels and sends
-                // those out.
+                // those out. The background work retries as well.
+                detail::destination_queue* q =
+                    pending_parcels_.find(locality_id);
+                if (q != nullptr && !q->empty())
+                    pending_parcels_.set_ready(*q);
                 return;
             }
 
@@ -861,11 +752,10 @@ namespace hpx { namespace parcelset
                 connection_cache_.clear(locality_id, sender_connection);
             }
             {
-                std::lock_guard<lcos::local::spinlock> l(mtx_);
-
 //                HPX_ASSERT(locality_id == sender_connection->destination());
-                pending_parcels_map::iterator it = pending_parcels_.find(locality_id);
-                if (it == pending_parcels_.end() || util::get<0>(it->second).empty())
+                detail::destination_queue* q =
+                    pending_parcels_.find(locality_id);
+                if (q == nullptr || q->empty())
                     return;
             }
 
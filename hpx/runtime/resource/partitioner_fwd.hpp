@@ -76,6 +76,8 @@ namespace hpx
             abp_priority_fifo = 5,
             abp_priority_lifo = 6,
             shared_priority = 7,
+            deadline = 8,
+            local_priority_chase_lev = 9,
         };
     }
 }
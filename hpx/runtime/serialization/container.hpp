@@ -15,6 +15,7 @@
 #include <hpx/util/assert.hpp>
 
 #include <cstddef>
+#include <memory>
 
 namespace hpx { namespace serialization
 {
@@ -46,6 +47,14 @@ namespace hpx { namespace serialization
         virtual void set_filter(binary_filter* filter) = 0;
         virtual void load_binary(void * address, std::size_t count) = 0;
         virtual void load_binary_chunk(void * address, std::size_t count) = 0;
+
+        // Return the memory of the next chunk if it can be used in place,
+        // \a owner keeps it alive.
+        virtual void* adopt_binary_chunk(std::size_t /*count*/,
+            std::size_t /*alignment*/, std::shared_ptr<void>& /*owner*/)
+        {
+            return nullptr;
+        }
     };
 }}
 
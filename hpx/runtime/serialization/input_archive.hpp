@@ -43,9 +43,11 @@ namespace hpx { namespace serialization
         template <typename Container>
         input_archive(Container & buffer,
                 std::size_t inbound_data_size = 0,
-                const std::vector<serialization_chunk>* chunks = nullptr)
+                const std::vector<serialization_chunk>* chunks = nullptr,
+                std::shared_ptr<void> chunks_owner = std::shared_ptr<void>())
           : base_type(0U)
-          , buffer_(new input_container<Container>(buffer, chunks, inbound_data_size))
+          , buffer_(new input_container<Container>(buffer, chunks,
+                inbound_data_size, std::move(chunks_owner)))
         {
             // endianness needs to be saves separately as it is needed to
             // properly interpret the flags
@@ -135,6 +137,8 @@ namespace hpx { namespace serialization
         friend struct basic_archive<input_archive>;
         template <class T>
         friend class array;
+        template <typename T, typename Allocator>
+        friend class serialize_buffer;
 
         template <typename T>
         void load_bitwise(T & t, std::false_type)
@@ -258,6 +262,21 @@ namespace hpx { namespace serialization
             size_ += count;
         }
 
+        // Use the received data of the next chunk in place instead of
+        // copying it, returns nullptr if that is not possible.
+        void* adopt_binary_chunk(std::size_t count, std::size_t alignment,
+            std::shared_ptr<void>& owner)
+        {
+            if (0 == count || disable_data_chunking())
+                return nullptr;
+
+            void* data = buffer_->adopt_binary_chunk(count, alignment, owner);
+            if (data != nullptr)
+                size_ += count;
+
+            return data;
+        }
+
         // make functions visible through adl
         friend void register_pointer(input_archive& ar,
                 std::uint64_t pos, detail::ptr_helper_ptr helper)
@@ -19,6 +19,7 @@
 #include <cstdint>
 #include <cstring> // for memcpy
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace hpx { namespace serialization
@@ -59,11 +60,12 @@ namespace hpx { namespace serialization
 
         input_container(Container const& cont,
                 std::vector<serialization_chunk> const* chunks,
-                std::size_t inbound_data_size)
+                std::size_t inbound_data_size,
+                std::shared_ptr<void> chunks_owner = std::shared_ptr<void>())
           : cont_(cont), current_(0), filter_(),
             decompressed_size_(inbound_data_size),
             chunks_(nullptr), current_chunk_(std::size_t(-1)),
-            current_chunk_size_(0)
+            current_chunk_size_(0), chunks_owner_(std::move(chunks_owner))
         {
             if (chunks && chunks->size() != 0)
             {
@@ -163,6 +165,36 @@ namespace hpx { namespace serialization
             }
         }
 
+        // The data of a pointer chunk can be handed out only if the memory
+        // it points to is owned by this archive (see chunks_owner_).
+        void* adopt_binary_chunk(std::size_t count, std::size_t alignment,
+            std::shared_ptr<void>& owner) // override
+        {
+            if (!chunks_owner_ || chunks_ == nullptr ||
+                count < HPX_ZERO_COPY_SERIALIZATION_THRESHOLD ||
+                filter_)
+            {
+                return nullptr;
+            }
+
+            HPX_ASSERT(current_chunk_ != std::size_t(-1));
+
+            // let load_binary_chunk report mismatches
+            if (get_chunk_type(current_chunk_) != chunk_type_pointer ||
+                get_chunk_size(current_chunk_) != count)
+            {
+                return nullptr;
+            }
+
+            void* data = get_chunk_data(current_chunk_).pos_;
+            if (reinterpret_cast<std::uintptr_t>(data) % alignment != 0)
+                return nullptr;
+
+            owner = chunks_owner_;
+            ++current_chunk_;
+            return data;
+        }
+
         Container const& cont_;
         std::size_t current_;
         std::unique_ptr<binary_filter> filter_;
@@ -171,6 +203,9 @@ namespace hpx { namespace serialization
         std::vector<serialization_chunk> const* chunks_;
         std::size_t current_chunk_;
         std::size_t current_chunk_size_;
+
+        // keeps the memory of the pointer chunks alive, if set
+        std::shared_ptr<void> chunks_owner_;
     };
 }}
 
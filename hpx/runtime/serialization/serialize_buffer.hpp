@@ -11,6 +11,7 @@
 #include <hpx/runtime/serialization/array.hpp>
 #include <hpx/runtime/serialization/serialize.hpp>
 #include <hpx/throw_exception.hpp>
+#include <hpx/traits/is_bitwise_serializable.hpp>
 #include <hpx/traits/supports_streaming_with_any.hpp>
 #include <hpx/util/bind_back.hpp>
 
@@ -18,7 +19,9 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <memory>
 #include <type_traits>
+#include <utility>
 
 namespace hpx { namespace serialization
 {
@@ -31,6 +34,8 @@ namespace hpx { namespace serialization
 
         static void no_deleter(T*) {}
 
+        static void release_owner(T*, std::shared_ptr<void> const&) {}
+
         template <typename Deallocator>
         static void deleter(T* p, Deallocator dealloc, std::size_t size)
         {
@@ -252,6 +257,9 @@ namespace hpx { namespace serialization
         {
             ar >> size_ >> alloc_; //-V128
 
+            if (size_ != 0 && load_in_place(ar, can_load_in_place()))
+                return;
+
             data_.reset(alloc_.allocate(size_),
                 util::bind_back(&serialize_buffer::deleter<allocator_type>,
                     alloc_, size_));
@@ -262,6 +270,42 @@ namespace hpx { namespace serialization
             }
         }
 
+        // Received data is used in place if the archive can hand over the
+        // memory it was received into. Memory not allocated by alloc_ can't
+        // be released by it, so this is done for the default allocator only.
+        typedef std::integral_constant<bool,
+                std::is_same<allocator_type, std::allocator<T> >::value &&
+                hpx::traits::is_bitwise_serializable<T>::value
+            > can_load_in_place;
+
+        bool load_in_place(input_archive& ar, std::true_type)
+        {
+#ifdef BOOST_BIG_ENDIAN
+            bool archive_endianess_differs = ar.endian_little();
+#else
+            bool archive_endianess_differs = ar.endian_big();
+#endif
+            if (ar.disable_array_optimization() || archive_endianess_differs)
+                return false;
+
+            std::shared_ptr<void> owner;
+            void* data = ar.adopt_binary_chunk(size_ * sizeof(T),
+                alignof(T), owner);
+            if (data == nullptr)
+                return false;
+
+            data_.reset(static_cast<T*>(data),
+                util::bind_back(&serialize_buffer::release_owner,
+                    std::move(owner)));
+            return true;
+        }
+
+        template <typename Archive>
+        bool load_in_place(Archive&, std::false_type)
+        {
+            return false;
+        }
+
         HPX_SERIALIZATION_SPLIT_MEMBER()
 
         // this is needed for util::any
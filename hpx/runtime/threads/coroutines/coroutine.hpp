@@ -121,7 +121,12 @@ namespace hpx { namespace threads { namespace coroutines
 
             impl_.bind_args(&arg);
 
-            impl_.invoke();
+            // stackless coroutines are executed directly on the stack of
+            // the calling (worker) thread
+            if (HPX_UNLIKELY(impl_.is_stackless()))
+                impl_.invoke_stackless();
+            else
+                impl_.invoke();
 
             return impl_.result();
         }
@@ -131,9 +136,16 @@ namespace hpx { namespace threads { namespace coroutines
             return impl_.is_ready();
         }
 
+        bool is_stackless() const
+        {
+            return impl_.is_stackless();
+        }
+
         std::ptrdiff_t get_available_stack_space()
         {
 #if defined(HPX_HAVE_THREADS_GET_STACK_POINTER)
+            if (impl_.is_stackless())
+                return (std::numeric_limits<std::ptrdiff_t>::max)();
             return impl_.get_available_stack_space();
 #else
             return (std::numeric_limits<std::ptrdiff_t>::max)();
@@ -18,6 +18,7 @@
 #include <hpx/runtime/threads/coroutines/detail/get_stack_pointer.hpp>
 #include <hpx/runtime/threads/coroutines/detail/posix_utility.hpp>
 #include <hpx/runtime/threads/coroutines/detail/swap_context.hpp>
+#include <hpx/runtime/threads/thread_enums.hpp>
 #include <hpx/util/assert.hpp>
 #include <hpx/util/format.hpp>
 #include <hpx/util/get_and_reset_value.hpp>
@@ -181,6 +182,9 @@ namespace hpx { namespace threads { namespace coroutines
             /**
              * Create a context that on restore invokes Functor on
              *  a new stack. The stack size can be optionally specified.
+             *  No stack is allocated if the stack size is
+             *  thread_stacksize_nostack, such a context can't be switched
+             *  to, its function has to be invoked directly.
              */
             template<typename Functor>
             x86_linux_context_impl(Functor& cb, std::ptrdiff_t stack_size = -1)
@@ -189,6 +193,13 @@ namespace hpx { namespace threads { namespace coroutines
                   : stack_size),
                 m_stack(nullptr)
             {
+                if (m_stack_size ==
+                    static_cast<std::ptrdiff_t>(thread_stacksize_nostack))
+                {
+                    m_sp = nullptr;
+                    return;
+                }
+
                 if (0 != (m_stack_size % EXEC_PAGESIZE))
                 {
                     throw std::runtime_error(
@@ -73,6 +73,8 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
           , m_result(unknown, invalid_thread_id)
           , m_arg(nullptr)
           , m_fun(std::move(f))
+          , m_stackless(stack_size ==
+                static_cast<std::ptrdiff_t>(thread_stacksize_nostack))
         {}
 
 #if defined(HPX_DEBUG)
@@ -81,6 +83,15 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
 
         HPX_EXPORT void operator()() noexcept;
 
+        // Run the bound function to completion on the stack of the caller,
+        // this is used for stackless coroutines only.
+        HPX_EXPORT void invoke_stackless();
+
+        bool is_stackless() const
+        {
+            return m_stackless;
+        }
+
     public:
         void bind_result(result_type res)
         {
@@ -129,6 +140,7 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
         arg_type* m_arg;
 
         functor_type m_fun;
+        bool const m_stackless;
     };
 }}}}
 
@@ -34,6 +34,7 @@
 #include <hpx/runtime/threads/coroutines/detail/coroutine_impl.hpp>
 #include <hpx/runtime/threads/thread_enums.hpp>
 #include <hpx/runtime/threads/thread_id_type.hpp>
+#include <hpx/throw_exception.hpp>
 #include <hpx/util/assert.hpp>
 #include <hpx/util/function.hpp>
 #if defined(HPX_HAVE_APEX)
@@ -94,6 +95,16 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
         {
             HPX_ASSERT(m_pimpl);
 
+            // stackless coroutines can't be suspended, this_thread::suspend
+            // handles those before getting here
+            if (HPX_UNLIKELY(m_pimpl->is_stackless()))
+            {
+                HPX_THROW_EXCEPTION(invalid_status,
+                    "coroutine_self::yield_impl",
+                    "a stackless HPX-thread (created with "
+                    "thread_stacksize_nostack) can't be suspended");
+            }
+
             this->m_pimpl->bind_result(arg);
 
             {
@@ -148,9 +159,17 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
 #endif
         }
 
+        bool is_stackless() const
+        {
+            HPX_ASSERT(m_pimpl);
+            return m_pimpl->is_stackless();
+        }
+
         std::ptrdiff_t get_available_stack_space()
         {
 #if defined(HPX_HAVE_THREADS_GET_STACK_POINTER)
+            if (m_pimpl->is_stackless())
+                return (std::numeric_limits<std::ptrdiff_t>::max)();
             return m_pimpl->get_available_stack_space();
 #else
             return (std::numeric_limits<std::ptrdiff_t>::max)();
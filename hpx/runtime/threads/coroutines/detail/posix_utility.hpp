@@ -31,6 +31,7 @@
 #define HPX_RUNTIME_THREADS_COROUTINES_DETAIL_POSIX_UTILITY_HPP
 
 #include <hpx/config.hpp>
+#include <hpx/runtime/threads/coroutines/detail/stack_pool.hpp>
 #include <hpx/util/assert.hpp>
 
 // include unist.d conditionally to check for POSIX version. Not all OSs have the
@@ -78,7 +79,10 @@ namespace posix
 #if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) \
  && _POSIX_MAPPED_FILES > 0
 
-    inline void* alloc_stack(std::size_t size)
+    // Reserve the address space for a new stack (including its guard page).
+    // The memory is committed lazily by the operating system when it is
+    // touched for the first time.
+    inline void* map_stack(std::size_t size)
     {
         void* real_stack = ::mmap(nullptr,
             size + EXEC_PAGESIZE,
@@ -121,6 +125,31 @@ namespace posix
 #endif
     }
 
+    inline void unmap_stack(void* stack, std::size_t size)
+    {
+#if defined(HPX_HAVE_THREAD_GUARD_PAGE)
+        if (use_guard_pages) {
+            void** real_stack =
+                static_cast<void**>(stack) - (EXEC_PAGESIZE / sizeof(void*));
+            ::munmap(static_cast<void*>(real_stack), size + EXEC_PAGESIZE);
+        } else {
+            ::munmap(stack, size);
+        }
+#else
+        ::munmap(stack, size);
+#endif
+    }
+
+    // Stacks are taken from (and returned to) the stack pool whenever
+    // possible, see stack_pool.hpp.
+    inline void* alloc_stack(std::size_t size)
+    {
+        void* stack = stack_pool_allocate(size);
+        if (stack == nullptr)
+            stack = map_stack(size);
+        return stack;
+    }
+
     inline void watermark_stack(void* stack, std::size_t size)
     {
         HPX_ASSERT(size > EXEC_PAGESIZE);
@@ -151,17 +180,8 @@ namespace posix
 
     inline void free_stack(void* stack, std::size_t size)
     {
-#if defined(HPX_HAVE_THREAD_GUARD_PAGE)
-        if (use_guard_pages) {
-            void** real_stack =
-                static_cast<void**>(stack) - (EXEC_PAGESIZE / sizeof(void*));
-            ::munmap(static_cast<void*>(real_stack), size + EXEC_PAGESIZE);
-        } else {
-            ::munmap(stack, size);
-        }
-#else
-        ::munmap(stack, size);
-#endif
+        if (!stack_pool_deallocate(stack, size))
+            unmap_stack(stack, size);
     }
 
 #else  // non-mmap()
@@ -0,0 +1,56 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_RUNTIME_THREADS_COROUTINES_DETAIL_STACK_POOL_HPP
+#define HPX_RUNTIME_THREADS_COROUTINES_DETAIL_STACK_POOL_HPP
+
+#include <hpx/config.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+// The stack pool keeps coroutine stacks which are not in use anymore for later
+// reuse. Stacks are kept in separate free lists for each NUMA domain and each
+// stack size. Before a stack is returned to the pool all of its pages which
+// were touched beyond the first one are handed back to the operating system
+// (madvise), which limits the resident set size of the pooled stacks to a
+// single page each, while the address space (including the guard page) stays
+// reserved.
+//
+// The pool is used only if stacks are allocated using mmap (see
+// HPX_WITH_THREAD_STACK_MMAP), otherwise the functions below are no-ops.
+namespace hpx { namespace threads { namespace coroutines { namespace detail
+{
+namespace posix
+{
+    // Maximum number of stacks kept for each stack size and NUMA domain,
+    // pooling is disabled if this is zero (see hpx.stacks.pool_size).
+    HPX_EXPORT extern std::atomic<std::size_t> stack_pool_size;
+
+    // Remember the NUMA domain the calling OS-thread is bound to, this has
+    // to be called after the affinity of the thread was set. Stacks used by
+    // threads which never called this function go to the free lists of the
+    // domain they happen to run on.
+    HPX_EXPORT void stack_pool_set_numa_domain(std::size_t domain);
+
+    // Return a stack of the given size from the pool, returns nullptr if no
+    // stack of this size is available.
+    HPX_EXPORT void* stack_pool_allocate(std::size_t size);
+
+    // Hand the given stack back to the pool, returns false if the stack was
+    // not accepted and has to be released by the caller.
+    HPX_EXPORT bool stack_pool_deallocate(void* stack, std::size_t size);
+
+    // Performance counter support
+    HPX_EXPORT std::int64_t get_stack_pool_hit_count(bool reset);
+    HPX_EXPORT std::int64_t get_stack_pool_miss_count(bool reset);
+    HPX_EXPORT std::int64_t get_stack_pool_resident_bytes(bool reset);
+}
+}}}}
+
+#endif /*HPX_RUNTIME_THREADS_COROUTINES_DETAIL_STACK_POOL_HPP*/
@@ -191,6 +191,13 @@ namespace hpx { namespace threads { namespace detail
             return sched_->Scheduler::get_num_stolen_from_pending(num, reset);
         }
 
+        std::int64_t get_num_stolen_from_pending_batches(
+            std::size_t num, bool reset)
+        {
+            return sched_->Scheduler::get_num_stolen_from_pending_batches(
+                num, reset);
+        }
+
         std::int64_t get_num_stolen_to_pending(std::size_t num, bool reset)
         {
             return sched_->Scheduler::get_num_stolen_to_pending(num, reset);
@@ -206,6 +213,49 @@ namespace hpx { namespace threads { namespace detail
             return sched_->Scheduler::get_num_stolen_to_staged(num, reset);
         }
 #endif
+
+        std::int64_t get_thread_cache_hits(std::size_t num, bool reset)
+        {
+            return sched_->Scheduler::get_thread_cache_hits(num, reset);
+        }
+
+        std::int64_t get_thread_cache_misses(std::size_t num, bool reset)
+        {
+            return sched_->Scheduler::get_thread_cache_misses(num, reset);
+        }
+
+        std::int64_t get_num_deadline_misses(std::size_t num, bool reset)
+        {
+            return sched_->Scheduler::get_num_deadline_misses(num, reset);
+        }
+
+        std::int64_t get_affinity_hits(std::size_t num, bool reset)
+        {
+            return sched_->Scheduler::get_affinity_hits(num, reset);
+        }
+
+        std::int64_t get_affinity_misses(std::size_t num, bool reset)
+        {
+            return sched_->Scheduler::get_affinity_misses(num, reset);
+        }
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        std::int64_t get_idle_park_count(std::size_t num, bool reset)
+        {
+            return sched_->Scheduler::get_idle_park_count(num, reset);
+        }
+
+        std::int64_t get_idle_wakeup_count(std::size_t num, bool reset)
+        {
+            return sched_->Scheduler::get_idle_wakeup_count(num, reset);
+        }
+
+        std::int64_t get_average_idle_wake_latency(std::size_t num, bool reset)
+        {
+            return sched_->Scheduler::get_average_idle_wake_latency(
+                num, reset);
+        }
+#endif
         std::int64_t get_queue_length(std::size_t num_thread, bool reset)
         {
             return sched_->Scheduler::get_queue_length(num_thread);
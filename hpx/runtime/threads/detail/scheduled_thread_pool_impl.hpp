@@ -15,6 +15,7 @@
 #include <hpx/exception_info.hpp>
 #include <hpx/lcos/future.hpp>
 #include <hpx/runtime/resource/detail/partitioner.hpp>
+#include <hpx/runtime/threads/coroutines/detail/stack_pool.hpp>
 #include <hpx/runtime/threads/detail/create_thread.hpp>
 #include <hpx/runtime/threads/detail/create_work.hpp>
 #include <hpx/runtime/threads/detail/scheduled_thread_pool.hpp>
@@ -519,6 +520,15 @@ namespace hpx { namespace threads { namespace detail
                 << global_thread_num << " was explicitly disabled.";
         }
 
+        // stacks are pooled per NUMA domain, which is known only now that
+        // the thread is bound
+        if (any(mask) && !ec)
+        {
+            coroutines::detail::posix::stack_pool_set_numa_domain(
+                topo.get_numa_node_number(
+                    rp.get_affinity_data().get_pu_num(global_thread_num)));
+        }
+
         // Setting priority of worker threads to a lower priority, this
         // needs to
         // be done in order to give the parcel pool threads higher
@@ -582,7 +592,7 @@ namespace hpx { namespace threads { namespace detail
                 detail::scheduling_callbacks callbacks(
                     util::bind(    //-V107
                         &policies::scheduler_base::idle_callback,
-                        std::ref(sched_), global_thread_num),
+                        std::ref(sched_), thread_num),
                     detail::scheduling_callbacks::callback_type());
 
                 if (mode_ & policies::do_background_work)
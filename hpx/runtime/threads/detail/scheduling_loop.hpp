@@ -618,6 +618,8 @@ namespace hpx { namespace threads { namespace detail
                 idle_loop_count = 0;
                 ++busy_loop_count;
 
+                scheduler.SchedulingPolicy::reset_idle_backoff(num_thread);
+
                 may_exit = false;
 
                 // Only pending HPX threads will be executed.
@@ -642,6 +644,10 @@ namespace hpx { namespace threads { namespace detail
                         {
                             tfunc_time_wrapper tfunc_time_collector(idle_rate);
 
+                            // remember the worker this thread runs on, the
+                            // thread will be resumed on it if possible
+                            thrd->set_last_worker_num(num_thread);
+
                             // thread returns new required state
                             // store the returned state in the thread
                             {
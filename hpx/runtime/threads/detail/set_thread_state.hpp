@@ -229,6 +229,14 @@ namespace hpx { namespace threads { namespace detail
             // REVIEW: Passing a specific target thread may interfere with the
             // round robin queuing.
 
+            // prefer resuming the thread on the worker it ran on before, if
+            // requested
+            if (schedulehint.mode == thread_schedule_hint_mode_none &&
+                thrd->get_scheduler_base()->use_affinity_hints())
+            {
+                schedulehint = thrd->get_affinity_hint();
+            }
+
             thrd->get_scheduler_base()->schedule_thread(thrd.get(),
                 schedulehint, false, thrd.get()->get_priority());
             // NOTE: Don't care if the hint is a NUMA hint, just want to wake up
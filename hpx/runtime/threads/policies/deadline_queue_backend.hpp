@@ -0,0 +1,148 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_THREADS_POLICIES_DEADLINE_QUEUE_BACKEND_HPP)
+#define HPX_THREADS_POLICIES_DEADLINE_QUEUE_BACKEND_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/threads/thread_data.hpp>
+#include <hpx/runtime/threads/thread_init_data.hpp>
+#include <hpx/util/spinlock.hpp>
+#include <hpx/util/tuple.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+namespace hpx { namespace threads { namespace policies
+{
+namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Extract the deadline from the different kinds of items stored in the
+    // queues of a thread_queue, items without a deadline are ordered after
+    // all items which have one.
+    inline std::uint64_t effective_deadline(std::uint64_t deadline)
+    {
+        return deadline == 0 ?
+            (std::numeric_limits<std::uint64_t>::max)() : deadline;
+    }
+
+    inline std::uint64_t get_deadline(thread_data* thrd)
+    {
+        return effective_deadline(thrd->get_deadline());
+    }
+
+    template <typename ... Ts>
+    std::uint64_t get_deadline(util::tuple<thread_data*, Ts...>* item)
+    {
+        return effective_deadline(util::get<0>(*item)->get_deadline());
+    }
+
+    template <typename ... Ts>
+    std::uint64_t get_deadline(util::tuple<thread_init_data, Ts...>* item)
+    {
+        return effective_deadline(util::get<0>(*item).deadline);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Earliest deadline first: pop always returns the item with the smallest
+// deadline, items with equal deadlines are returned in FIFO order. Thieves
+// take the most urgent item as well.
+struct deadline_order;
+
+template <typename T>
+struct deadline_order_backend
+{
+    typedef T value_type;
+    typedef T& reference;
+    typedef T const& const_reference;
+    typedef std::uint64_t size_type;
+
+    deadline_order_backend(
+        size_type initial_size = 0
+      , size_type num_thread = size_type(-1)
+        )
+      : seq_(0), size_(0)
+    {
+        heap_.reserve(std::size_t(initial_size));
+    }
+
+    bool push(const_reference val, bool /*other_end*/ = false)
+    {
+        std::lock_guard<util::spinlock> l(mtx_);
+
+        heap_.push_back(entry{detail::get_deadline(val), seq_++, val});
+        std::push_heap(heap_.begin(), heap_.end(), entry_greater());
+
+        size_.store(heap_.size(), std::memory_order_release);
+        return true;
+    }
+
+    bool pop(reference val, bool /*steal*/ = true)
+    {
+        if (empty())
+            return false;
+
+        std::lock_guard<util::spinlock> l(mtx_);
+        if (heap_.empty())
+            return false;
+
+        std::pop_heap(heap_.begin(), heap_.end(), entry_greater());
+        val = heap_.back().value_;
+        heap_.pop_back();
+
+        size_.store(heap_.size(), std::memory_order_release);
+        return true;
+    }
+
+    bool empty()
+    {
+        return size_.load(std::memory_order_acquire) == 0;
+    }
+
+    void on_start_thread(std::size_t num_thread) {}
+    void on_stop_thread(std::size_t num_thread) {}
+
+  private:
+    struct entry
+    {
+        std::uint64_t deadline_;
+        std::uint64_t seq_;
+        T value_;
+    };
+
+    struct entry_greater
+    {
+        bool operator()(entry const& lhs, entry const& rhs) const
+        {
+            if (lhs.deadline_ != rhs.deadline_)
+                return lhs.deadline_ > rhs.deadline_;
+            return lhs.seq_ > rhs.seq_;
+        }
+    };
+
+    util::spinlock mtx_;
+    std::vector<entry> heap_;
+    std::uint64_t seq_;
+    std::atomic<std::size_t> size_;
+};
+
+struct deadline_order
+{
+    template <typename T>
+    struct apply
+    {
+        typedef deadline_order_backend<T> type;
+    };
+};
+}}}
+
+#endif
@@ -0,0 +1,120 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_THREADMANAGER_SCHEDULING_DEADLINE_QUEUE_HPP)
+#define HPX_THREADMANAGER_SCHEDULING_DEADLINE_QUEUE_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DEADLINE_SCHEDULER)
+#include <hpx/compat/mutex.hpp>
+#include <hpx/runtime/threads/policies/deadline_queue_backend.hpp>
+#include <hpx/runtime/threads/policies/local_queue_scheduler.hpp>
+#include <hpx/runtime/threads/policies/lockfree_queue_backends.hpp>
+#include <hpx/runtime/threads/thread_data.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace threads { namespace policies
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// The deadline_queue_scheduler maintains exactly one queue of work items
+    /// (threads) per OS thread. Each queue is ordered by the deadline of its
+    /// threads (earliest deadline first, see thread_init_data::deadline),
+    /// threads without a deadline are run after all threads which have one.
+    /// Idle OS threads steal the most urgent thread from other queues.
+    template <typename Mutex = compat::mutex,
+        typename PendingQueuing = deadline_order,
+        typename StagedQueuing = deadline_order,
+        typename TerminatedQueuing = lockfree_lifo>
+    class deadline_queue_scheduler
+        : public local_queue_scheduler<
+            Mutex, PendingQueuing, StagedQueuing, TerminatedQueuing
+          >
+    {
+    public:
+        typedef local_queue_scheduler<
+            Mutex, PendingQueuing, StagedQueuing, TerminatedQueuing
+        > base_type;
+
+        deadline_queue_scheduler(
+                typename base_type::init_parameter_type const& init,
+                bool deferred_initialization = true)
+          : base_type(init, deferred_initialization),
+            deadline_misses_(init.num_queues_)
+        {}
+
+        static std::string get_scheduler_name()
+        {
+            return "deadline_queue_scheduler";
+        }
+
+        /// Return the next thread to be executed, return false if none is
+        /// available
+        bool get_next_thread(std::size_t num_thread, bool running,
+            std::int64_t& idle_loop_count, threads::thread_data*& thrd) override
+        {
+            if (!this->base_type::get_next_thread(
+                    num_thread, running, idle_loop_count, thrd))
+            {
+                return false;
+            }
+
+            std::uint64_t deadline = thrd->get_deadline();
+            if (deadline != 0 && util::high_resolution_clock::now() > deadline)
+            {
+                HPX_ASSERT(num_thread < deadline_misses_.size());
+                ++deadline_misses_[num_thread].count_;
+            }
+            return true;
+        }
+
+        std::int64_t get_num_deadline_misses(
+            std::size_t num_thread, bool reset) override
+        {
+            if (num_thread == std::size_t(-1))
+            {
+                std::int64_t count = 0;
+                for (deadline_miss_data& d : deadline_misses_)
+                    count += util::get_and_reset_value(d.count_, reset);
+                return count;
+            }
+
+            HPX_ASSERT(num_thread < deadline_misses_.size());
+            return util::get_and_reset_value(
+                deadline_misses_[num_thread].count_, reset);
+        }
+
+    private:
+        struct deadline_miss_data
+        {
+            deadline_miss_data()
+              : count_(0)
+            {}
+
+            std::atomic<std::int64_t> count_;
+
+            // avoid false sharing between neighboring counters
+            char pad_[64];
+        };
+
+        std::vector<deadline_miss_data> deadline_misses_;
+    };
+}}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
+#endif
@@ -25,6 +25,7 @@
 #include <cstdint>
 #include <exception>
 #include <memory>
+#include <random>
 #include <string>
 #include <type_traits>
 #include <vector>
@@ -131,6 +132,9 @@ namespace hpx { namespace threads { namespace policies
         {
             victim_threads_.clear();
             victim_threads_.resize(init.num_queues_);
+            victim_levels_.clear();
+            victim_levels_.resize(init.num_queues_);
+            victim_seeds_.resize(init.num_queues_);
 
             if (!deferred_initialization)
             {
@@ -474,6 +478,7 @@ namespace hpx { namespace threads { namespace policies
             thread_state_enum initial_state, bool run_now, error_code& ec) override
         {
             // NOTE: This scheduler ignores NUMA hints.
+            data.schedulehint = resolve_affinity_hint(data.schedulehint);
             std::size_t num_thread =
                 data.schedulehint.mode == thread_schedule_hint_mode_thread ?
                 data.schedulehint.hint : std::size_t(-1);
@@ -574,30 +579,44 @@ namespace hpx { namespace threads { namespace policies
                 return false;
             }
 
-            for (std::size_t idx: victim_threads_[num_thread])
-            {
-                HPX_ASSERT(idx != num_thread);
-
-                if (idx < high_priority_queues &&
-                    num_thread < high_priority_queues)
+            bool stolen_any = for_each_victim(num_thread,
+                [&](std::size_t idx) -> bool
                 {
-                    thread_queue_type* q = high_priority_queues_[idx];
-                    if (q->get_next_thread(thrd, running))
+                    HPX_ASSERT(idx != num_thread);
+
+                    // steal a batch of threads at once (see
+                    // hpx.thread_queue.max_tasks_to_steal_pending), all but
+                    // the first one are moved to our own queue
+                    if (idx < high_priority_queues &&
+                        num_thread < high_priority_queues)
                     {
-                        q->increment_num_stolen_from_pending();
-                        this_high_priority_queue->
-                            increment_num_stolen_to_pending();
+                        thread_queue_type* q = high_priority_queues_[idx];
+                        std::int64_t stolen = this_high_priority_queue->
+                            steal_work_items_from(q, thrd, running);
+                        if (stolen != 0)
+                        {
+                            q->increment_num_stolen_from_pending(stolen);
+                            this_high_priority_queue->
+                                increment_num_stolen_to_pending(stolen);
+                            increment_num_stolen_from_pending_batches(idx);
+                            return true;
+                        }
+                    }
+
+                    std::int64_t stolen = this_queue->
+                        steal_work_items_from(queues_[idx], thrd, running);
+                    if (stolen != 0)
+                    {
+                        queues_[idx]->increment_num_stolen_from_pending(stolen);
+                        this_queue->increment_num_stolen_to_pending(stolen);
+                        increment_num_stolen_from_pending_batches(idx);
                         return true;
                     }
-                }
+                    return false;
+                });
 
-                if (queues_[idx]->get_next_thread(thrd, running))
-                {
-                    queues_[idx]->increment_num_stolen_from_pending();
-                    this_queue->increment_num_stolen_to_pending();
-                    return true;
-                }
-            }
+            if (stolen_any)
+                return true;
 
             return low_priority_queue_.get_next_thread(thrd);
         }
@@ -609,6 +628,7 @@ namespace hpx { namespace threads { namespace policies
             thread_priority priority = thread_priority_normal) override
         {
             // NOTE: This scheduler ignores NUMA hints.
+            schedulehint = resolve_affinity_hint(schedulehint);
             std::size_t num_thread = std::size_t(-1);
             if (schedulehint.mode == thread_schedule_hint_mode_thread)
             {
@@ -657,6 +677,7 @@ namespace hpx { namespace threads { namespace policies
             thread_priority priority = thread_priority_normal) override
         {
             // NOTE: This scheduler ignores NUMA hints.
+            schedulehint = resolve_affinity_hint(schedulehint);
             std::size_t num_thread = std::size_t(-1);
             if (schedulehint.mode == thread_schedule_hint_mode_thread)
             {
@@ -707,6 +728,67 @@ namespace hpx { namespace threads { namespace policies
             thrd->get_queue<thread_queue_type>().destroy_thread(thrd, busy_count);
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Queries the number of thread objects reused from (or not found in)
+        // the per-worker thread caches.
+        std::int64_t get_thread_cache_hits(std::size_t num_thread, bool reset) override
+        {
+            std::int64_t count = 0;
+            if (num_thread == std::size_t(-1))
+            {
+                for (std::size_t i = 0; i != high_priority_queues_.size(); ++i)
+                    count += high_priority_queues_[i]->get_thread_cache_hits(reset);
+
+                for (std::size_t i = 0; i != queues_.size(); ++i)
+                    count += queues_[i]->get_thread_cache_hits(reset);
+
+                count += low_priority_queue_.get_thread_cache_hits(reset);
+                return count;
+            }
+
+            count += queues_[num_thread]->get_thread_cache_hits(reset);
+
+            if (num_thread < high_priority_queues_.size())
+            {
+                count += high_priority_queues_[num_thread]->
+                    get_thread_cache_hits(reset);
+            }
+            if (num_thread == 0)
+            {
+                count += low_priority_queue_.get_thread_cache_hits(reset);
+            }
+            return count;
+        }
+
+        std::int64_t get_thread_cache_misses(std::size_t num_thread, bool reset) override
+        {
+            std::int64_t count = 0;
+            if (num_thread == std::size_t(-1))
+            {
+                for (std::size_t i = 0; i != high_priority_queues_.size(); ++i)
+                    count += high_priority_queues_[i]->get_thread_cache_misses(reset);
+
+                for (std::size_t i = 0; i != queues_.size(); ++i)
+                    count += queues_[i]->get_thread_cache_misses(reset);
+
+                count += low_priority_queue_.get_thread_cache_misses(reset);
+                return count;
+            }
+
+            count += queues_[num_thread]->get_thread_cache_misses(reset);
+
+            if (num_thread < high_priority_queues_.size())
+            {
+                count += high_priority_queues_[num_thread]->
+                    get_thread_cache_misses(reset);
+            }
+            if (num_thread == 0)
+            {
+                count += low_priority_queue_.get_thread_cache_misses(reset);
+            }
+            return count;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // This returns the current length of the queues (work items and new items)
         std::int64_t get_queue_length(
@@ -996,37 +1078,42 @@ namespace hpx { namespace threads { namespace policies
                 return true;
             }
 
-            for (std::size_t idx: victim_threads_[num_thread])
-            {
-                HPX_ASSERT(idx != num_thread);
-
-                if (idx < high_priority_queues &&
-                    num_thread < high_priority_queues)
+            bool stolen_any = for_each_victim(num_thread,
+                [&](std::size_t idx) -> bool
                 {
-                    thread_queue_type* q =  high_priority_queues_[idx];
-                    result = this_high_priority_queue->
-                        wait_or_add_new(running, idle_loop_count,
-                            added, q)
-                      && result;
+                    HPX_ASSERT(idx != num_thread);
+
+                    if (idx < high_priority_queues &&
+                        num_thread < high_priority_queues)
+                    {
+                        thread_queue_type* q =  high_priority_queues_[idx];
+                        result = this_high_priority_queue->
+                            wait_or_add_new(running, idle_loop_count,
+                                added, q)
+                          && result;
+
+                        if (0 != added)
+                        {
+                            q->increment_num_stolen_from_staged(added);
+                            this_high_priority_queue->
+                                increment_num_stolen_to_staged(added);
+                            return true;
+                        }
+                    }
 
+                    result = this_queue->wait_or_add_new(running,
+                        idle_loop_count, added, queues_[idx]) && result;
                     if (0 != added)
                     {
-                        q->increment_num_stolen_from_staged(added);
-                        this_high_priority_queue->
-                            increment_num_stolen_to_staged(added);
-                        return result;
+                        queues_[idx]->increment_num_stolen_from_staged(added);
+                        this_queue->increment_num_stolen_to_staged(added);
+                        return true;
                     }
-                }
+                    return false;
+                });
 
-                result = this_queue->wait_or_add_new(running,
-                    idle_loop_count, added, queues_[idx]) && result;
-                if (0 != added)
-                {
-                    queues_[idx]->increment_num_stolen_from_staged(added);
-                    this_queue->increment_num_stolen_to_staged(added);
-                    return result;
-                }
-            }
+            if (stolen_any)
+                return result;
 
 #ifdef HPX_HAVE_THREAD_MINIMAL_DEADLOCK_DETECTION
             // no new work is available, are we deadlocked?
@@ -1094,13 +1181,19 @@ namespace hpx { namespace threads { namespace policies
             std::size_t num_threads = queues_.size();
             auto const& topo = rp_.get_topology();
 
-            // get numa domain masks of all queues...
+            // get the topology masks of all queues...
+            std::vector<mask_type> socket_masks(num_threads);
             std::vector<mask_type> numa_masks(num_threads);
+            std::vector<mask_type> l3_masks(num_threads);
+            std::vector<mask_type> l2_masks(num_threads);
             std::vector<mask_type> core_masks(num_threads);
             for (std::size_t i = 0; i != num_threads; ++i)
             {
                 std::size_t num_pu = rp_.get_affinity_data().get_pu_num(i);
+                socket_masks[i] = topo.get_socket_affinity_mask(num_pu);
                 numa_masks[i] = topo.get_numa_node_affinity_mask(num_pu);
+                l3_masks[i] = topo.get_cache_affinity_mask(num_pu, 3);
+                l2_masks[i] = topo.get_cache_affinity_mask(num_pu, 2);
                 core_masks[i] = topo.get_core_affinity_mask(num_pu);
             }
 
@@ -1108,11 +1201,22 @@ namespace hpx { namespace threads { namespace policies
             // steal from
             std::ptrdiff_t radius =
                 static_cast<std::ptrdiff_t>((num_threads / 2.0) + 0.5);
+            victim_threads_[num_thread].clear();
             victim_threads_[num_thread].reserve(num_threads);
+            victim_levels_[num_thread].clear();
+
+            // every worker picks its victims based on a sequence of its own,
+            // the state must never be zero
+            victim_seeds_[num_thread].state_ =
+                (static_cast<std::uint64_t>(std::random_device{}()) << 32 |
+                    (num_thread + 1)) | 1;
 
             std::size_t num_pu = rp_.get_affinity_data().get_pu_num(num_thread);
             mask_cref_type pu_mask = topo.get_thread_affinity_mask(num_pu);
+            mask_cref_type socket_mask = socket_masks[num_thread];
             mask_cref_type numa_mask = numa_masks[num_thread];
+            mask_cref_type l3_mask = l3_masks[num_thread];
+            mask_cref_type l2_mask = l2_masks[num_thread];
             mask_cref_type core_mask = core_masks[num_thread];
 
             // we allow the thread on the boundary of the NUMA domain to steal
@@ -1158,9 +1262,13 @@ namespace hpx { namespace threads { namespace policies
                         victim_threads_[num_thread].push_back(right);
                     }
                 }
+
+                // remember where this level of the hierarchy ends
+                victim_levels_[num_thread].push_back(
+                    victim_threads_[num_thread].size());
             };
 
-            // check for threads which share the same core...
+            // check for threads which share the same core (SMT siblings)...
             iterate(
                 [&](std::size_t other_num_thread)
                 {
@@ -1168,23 +1276,56 @@ namespace hpx { namespace threads { namespace policies
                 }
             );
 
+            // check for threads which share the same L2 cache...
+            iterate(
+                [&](std::size_t other_num_thread)
+                {
+                    return
+                        !any(core_mask & core_masks[other_num_thread])
+                        && any(l2_mask & l2_masks[other_num_thread]);
+                }
+            );
+
+            // check for threads which share the same L3 cache...
+            iterate(
+                [&](std::size_t other_num_thread)
+                {
+                    return
+                        !any(core_mask & core_masks[other_num_thread])
+                        && !any(l2_mask & l2_masks[other_num_thread])
+                        && any(l3_mask & l3_masks[other_num_thread]);
+                }
+            );
+
             // check for threads which share the same numa domain...
             iterate(
                 [&](std::size_t other_num_thread)
                 {
                     return
                         !any(core_mask & core_masks[other_num_thread])
+                        && !any(l2_mask & l2_masks[other_num_thread])
+                        && !any(l3_mask & l3_masks[other_num_thread])
                         && any(numa_mask & numa_masks[other_num_thread]);
                 }
             );
 
-            // check for the rest and if we are numa aware
+            // check for the rest and if we are numa aware, prefer threads
+            // on the same socket
             if (numa_sensitive_ != 2 && any(first_mask & pu_mask))
             {
                 iterate(
                     [&](std::size_t other_num_thread)
                     {
-                        return !any(numa_mask & numa_masks[other_num_thread]);
+                        return !any(numa_mask & numa_masks[other_num_thread])
+                            && any(socket_mask & socket_masks[other_num_thread]);
+                    }
+                );
+
+                iterate(
+                    [&](std::size_t other_num_thread)
+                    {
+                        return !any(numa_mask & numa_masks[other_num_thread])
+                            && !any(socket_mask & socket_masks[other_num_thread]);
                     }
                 );
             }
@@ -1216,6 +1357,42 @@ namespace hpx { namespace threads { namespace policies
         }
 
     protected:
+        // Invoke the given function for all threads the given thread may
+        // steal from until it returns true. The victims are visited level by
+        // level of the topology hierarchy (core, L2, L3, NUMA domain, socket,
+        // machine). The starting point inside each level is chosen
+        // pseudo-randomly to spread the stealing threads over the victims.
+        template <typename F>
+        bool for_each_victim(std::size_t num_thread, F && f) const
+        {
+            std::vector<std::size_t> const& victims =
+                victim_threads_[num_thread];
+
+            // xorshift64*, only the given worker accesses its state
+            std::uint64_t& state = victim_seeds_[num_thread].state_;
+            state ^= state >> 12;
+            state ^= state << 25;
+            state ^= state >> 27;
+            std::uint64_t const seed = (state * 0x2545f4914f6cdd1dull) >> 32;
+
+            std::size_t begin = 0;
+            for (std::size_t end : victim_levels_[num_thread])
+            {
+                std::size_t size = end - begin;
+                if (size != 0)
+                {
+                    std::size_t offset = static_cast<std::size_t>(seed % size);
+                    for (std::size_t i = 0; i != size; ++i)
+                    {
+                        if (f(victims[begin + (offset + i) % size]))
+                            return true;
+                    }
+                }
+                begin = end;
+            }
+            return false;
+        }
+
         std::size_t max_queue_thread_count_;
         std::vector<thread_queue_type*> queues_;
         std::vector<thread_queue_type*> high_priority_queues_;
@@ -1224,6 +1401,20 @@ namespace hpx { namespace threads { namespace policies
         std::size_t numa_sensitive_;
 
         std::vector<std::vector<std::size_t> > victim_threads_;
+        std::vector<std::vector<std::size_t> > victim_levels_;
+
+        struct victim_seed
+        {
+            victim_seed()
+              : state_(1)
+            {}
+
+            std::uint64_t state_;
+
+            // avoid false sharing between neighboring workers
+            char pad_[64];
+        };
+        mutable std::vector<victim_seed> victim_seeds_;
 
         resource::detail::partitioner& rp_;
     };
@@ -305,6 +305,7 @@ namespace hpx { namespace threads { namespace policies
         void create_thread(thread_init_data& data, thread_id_type* id,
             thread_state_enum initial_state, bool run_now, error_code& ec) override
         {
+            data.schedulehint = resolve_affinity_hint(data.schedulehint);
             std::size_t num_thread =
                 data.schedulehint.mode == thread_schedule_hint_mode_thread ?
                 data.schedulehint.hint : std::size_t(-1);
@@ -402,6 +403,7 @@ namespace hpx { namespace threads { namespace policies
                         {
                             q->increment_num_stolen_from_pending();
                             queues_[num_thread]->increment_num_stolen_to_pending();
+                            increment_num_stolen_from_pending_batches(idx);
                             return true;
                         }
                     }
@@ -431,6 +433,7 @@ namespace hpx { namespace threads { namespace policies
                         {
                             q->increment_num_stolen_from_pending();
                             queues_[num_thread]->increment_num_stolen_to_pending();
+                            increment_num_stolen_from_pending_batches(idx);
                             return true;
                         }
                     }
@@ -452,6 +455,7 @@ namespace hpx { namespace threads { namespace policies
                     {
                         q->increment_num_stolen_from_pending();
                         queues_[num_thread]->increment_num_stolen_to_pending();
+                        increment_num_stolen_from_pending_batches(idx);
                         return true;
                     }
                 }
@@ -467,6 +471,7 @@ namespace hpx { namespace threads { namespace policies
             thread_priority priority = thread_priority_normal) override
         {
             // NOTE: This scheduler ignores NUMA hints.
+            schedulehint = resolve_affinity_hint(schedulehint);
             std::size_t num_thread = std::size_t(-1);
             if (schedulehint.mode == thread_schedule_hint_mode_thread)
             {
@@ -503,6 +508,7 @@ namespace hpx { namespace threads { namespace policies
             thread_priority priority = thread_priority_normal) override
         {
             // NOTE: This scheduler ignores NUMA hints.
+            schedulehint = resolve_affinity_hint(schedulehint);
             std::size_t num_thread = std::size_t(-1);
             if (schedulehint.mode == thread_schedule_hint_mode_thread)
             {
@@ -541,6 +547,37 @@ namespace hpx { namespace threads { namespace policies
             thrd->get_queue<thread_queue_type>().destroy_thread(thrd, busy_count);
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Queries the number of thread objects reused from (or not found in)
+        // the per-worker thread caches.
+        std::int64_t get_thread_cache_hits(std::size_t num_thread, bool reset) override
+        {
+            std::int64_t count = 0;
+            if (num_thread == std::size_t(-1))
+            {
+                for (std::size_t i = 0; i != queues_.size(); ++i)
+                    count += queues_[i]->get_thread_cache_hits(reset);
+                return count;
+            }
+
+            count += queues_[num_thread]->get_thread_cache_hits(reset);
+            return count;
+        }
+
+        std::int64_t get_thread_cache_misses(std::size_t num_thread, bool reset) override
+        {
+            std::int64_t count = 0;
+            if (num_thread == std::size_t(-1))
+            {
+                for (std::size_t i = 0; i != queues_.size(); ++i)
+                    count += queues_[i]->get_thread_cache_misses(reset);
+                return count;
+            }
+
+            count += queues_[num_thread]->get_thread_cache_misses(reset);
+            return count;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // This returns the current length of the queues (work items and new items)
         std::int64_t get_queue_length(
@@ -10,10 +10,13 @@
 
 #include <hpx/config.hpp>
 
+#include <hpx/util/lockfree/chase_lev_deque.hpp>
 #include <hpx/util/lockfree/deque.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <thread>
 
 namespace hpx { namespace threads { namespace policies
 {
@@ -53,6 +56,9 @@ struct lockfree_fifo_backend
         return queue_.empty();
     }
 
+    void on_start_thread(std::size_t num_thread) {}
+    void on_stop_thread(std::size_t num_thread) {}
+
   private:
     container_type queue_;
 };
@@ -100,6 +106,9 @@ struct lockfree_lifo_backend
         return queue_.empty();
     }
 
+    void on_start_thread(std::size_t num_thread) {}
+    void on_stop_thread(std::size_t num_thread) {}
+
   private:
     container_type queue_;
 };
@@ -113,6 +122,101 @@ struct lockfree_lifo
     };
 };
 
+///////////////////////////////////////////////////////////////////////////////
+// LIFO for the owning worker thread + stealing at opposite end.
+// E.g. Chase-Lev work-stealing deque
+// http://dl.acm.org/citation.cfm?id=1073974
+//
+// The first worker thread which started using the queue (see on_start_thread)
+// is its owner. The owner pushes and pops without any atomic read-modify-write
+// operation, only thieves contend with each other. Items pushed by any other
+// thread (or pushed to the other end) are placed into a separate
+// multi-producer queue which is consulted once the deque runs empty.
+struct lockfree_chase_lev;
+
+template <typename T>
+struct lockfree_chase_lev_backend
+{
+    typedef boost::lockfree::chase_lev_deque<T> container_type;
+    typedef boost::lockfree::deque<T> shared_container_type;
+    typedef T value_type;
+    typedef T& reference;
+    typedef T const& const_reference;
+    typedef std::uint64_t size_type;
+
+    lockfree_chase_lev_backend(
+        size_type initial_size = 0
+      , size_type num_thread = size_type(-1)
+        )
+      : queue_(std::size_t(initial_size))
+      , shared_queue_(std::size_t(initial_size))
+      , owner_(std::thread::id())
+    {}
+
+    bool push(const_reference val, bool other_end = false)
+    {
+        if (!other_end && is_owner())
+        {
+            queue_.push(val);
+            return true;
+        }
+        return shared_queue_.push_left(val);
+    }
+
+    bool pop(reference val, bool steal = true)
+    {
+        if (!steal && is_owner())
+        {
+            if (queue_.pop(val))
+                return true;
+        }
+        else if (queue_.steal(val))
+        {
+            return true;
+        }
+        return shared_queue_.pop_right(val);
+    }
+
+    bool empty()
+    {
+        return queue_.empty() && shared_queue_.empty();
+    }
+
+    // The queue might be shared between several worker threads, only the
+    // first one to start becomes its owner.
+    void on_start_thread(std::size_t num_thread)
+    {
+        std::thread::id expected;
+        owner_.compare_exchange_strong(expected, std::this_thread::get_id());
+    }
+
+    void on_stop_thread(std::size_t num_thread)
+    {
+        std::thread::id expected = std::this_thread::get_id();
+        owner_.compare_exchange_strong(expected, std::thread::id());
+    }
+
+  private:
+    bool is_owner() const
+    {
+        return owner_.load(std::memory_order_relaxed) ==
+            std::this_thread::get_id();
+    }
+
+    container_type queue_;
+    shared_container_type shared_queue_;
+    std::atomic<std::thread::id> owner_;
+};
+
+struct lockfree_chase_lev
+{
+    template <typename T>
+    struct apply
+    {
+        typedef lockfree_chase_lev_backend<T> type;
+    };
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 // FIFO + stealing at opposite end.
 #if defined(HPX_HAVE_ABP_SCHEDULER)
@@ -152,6 +256,9 @@ struct lockfree_abp_fifo_backend
         return queue_.empty();
     }
 
+    void on_start_thread(std::size_t num_thread) {}
+    void on_stop_thread(std::size_t num_thread) {}
+
   private:
     container_type queue_;
 };
@@ -204,6 +311,9 @@ struct lockfree_abp_lifo_backend
         return queue_.empty();
     }
 
+    void on_start_thread(std::size_t num_thread) {}
+    void on_stop_thread(std::size_t num_thread) {}
+
   private:
     container_type queue_;
 };
@@ -12,11 +12,13 @@
 
 #include <hpx/config.hpp>
 #include <hpx/runtime/threads/thread_data.hpp>
+#include <hpx/util/assert.hpp>
 #include <hpx/util/logging.hpp>
 #include <hpx/util/unused.hpp>
 
 #include <cstddef>
 #include <cstdint>
+#include <utility>
 #include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -82,6 +84,20 @@ namespace hpx { namespace threads { namespace policies
             return false;
         }
 
+        // ----------------------------------------------------------------
+        // take one task, the queues are visited in the order set up for the
+        // given core by set_victims, starting at a position derived from the
+        // given seed inside each level
+        inline bool get_next_thread(std::size_t id, threads::thread_data*& thrd,
+            std::uint64_t seed)
+        {
+            return for_each_victim(id, seed,
+                [&](std::size_t q)
+                {
+                    return queues_[q]->get_next_thread(thrd);
+                });
+        }
+
         // ----------------------------------------------------------------
         inline bool wait_or_add_new(std::size_t id, bool running,
            std::int64_t& idle_loop_count, std::size_t& added)
@@ -99,6 +115,37 @@ namespace hpx { namespace threads { namespace policies
             return result;
         }
 
+        // ----------------------------------------------------------------
+        inline bool wait_or_add_new(std::size_t id, bool running,
+           std::int64_t& idle_loop_count, std::size_t& added,
+           std::uint64_t seed)
+        {
+            bool result = true;
+            for_each_victim(id, seed,
+                [&](std::size_t q)
+                {
+                    result = queues_[q]->wait_or_add_new(running,
+                        idle_loop_count, added) && result;
+                    return 0 != added;
+                });
+            return result;
+        }
+
+        // ----------------------------------------------------------------
+        // set the order in which the given core visits the queues, the
+        // victims are grouped into levels of the topology hierarchy, levels
+        // holds the end of each group
+        void set_victims(std::size_t id, std::vector<std::size_t> victims,
+            std::vector<std::size_t> levels)
+        {
+            HPX_ASSERT(id < num_cores);
+            HPX_ASSERT(levels.empty() || levels.back() == victims.size());
+            victims_.resize(num_cores);
+            victim_levels_.resize(num_cores);
+            victims_[id] = std::move(victims);
+            victim_levels_[id] = std::move(levels);
+        }
+
         // ----------------------------------------------------------------
         inline std::size_t get_queue_length() const
         {
@@ -129,11 +176,49 @@ namespace hpx { namespace threads { namespace policies
             return num_queues;
         }
 
+        // ----------------------------------------------------------------
+        // invoke f for the queues in the order set up for the given core
+        // until it returns true, cores without a victim order visit all
+        // queues starting with their own one
+        template <typename F>
+        bool for_each_victim(std::size_t id, std::uint64_t seed, F && f) const
+        {
+            if (id >= victims_.size() || victims_[id].empty())
+            {
+                for (std::size_t i=0; i<num_queues; ++i) {
+                    if (f((id + i) % num_queues)) return true;
+                }
+                return false;
+            }
+
+            std::vector<std::size_t> const& victims = victims_[id];
+            std::size_t begin = 0;
+            for (std::size_t end : victim_levels_[id])
+            {
+                std::size_t size = end - begin;
+                if (size != 0)
+                {
+                    std::size_t offset = static_cast<std::size_t>(seed % size);
+                    for (std::size_t i = 0; i != size; ++i)
+                    {
+                        if (f(victims[begin + (offset + i) % size]))
+                            return true;
+                    }
+                }
+                begin = end;
+            }
+            return false;
+        }
+
         // ----------------------------------------------------------------
         std::size_t             num_cores;
         std::size_t             num_queues;
         double                  scale;
         std::vector<QueueType*> queues_;
+
+        // queues to steal from for each core, grouped by topology level
+        std::vector<std::vector<std::size_t> > victims_;
+        std::vector<std::vector<std::size_t> > victim_levels_;
     };
 
     struct add_new_tag {};
@@ -177,10 +262,9 @@ namespace detail
         bool collect_suspended = true;
 
         bool logged_headline = false;
-        typename Map::const_iterator end = tm.end();
-        for (typename Map::const_iterator it = tm.begin(); it != end; ++it)
+        for (threads::thread_id_type const& id : tm)
         {
-            threads::thread_data const* thrd = it->get();
+            threads::thread_data const* thrd = id.get();
             threads::thread_state_enum state = thrd->get_state().state();
             threads::thread_state_enum marked_state = thrd->get_marked_state();
 
@@ -204,7 +288,7 @@ namespace detail
                     LTM_(error) << "queue(" << num_thread << "): " //-V128
                                 << get_thread_state_name(state)
                                 << "(" << std::hex << std::setw(8)
-                                    << std::setfill('0') << (*it)
+                                    << std::setfill('0') << id
                                 << "." << std::hex << std::setw(2)
                                     << std::setfill('0') << thrd->get_thread_phase()
                                 << "/" << std::hex << std::setw(8)
@@ -222,7 +306,7 @@ namespace detail
                                 << "queue(" << num_thread << "): "
                                 << get_thread_state_name(state)
                                 << "(" << std::hex << std::setw(8)
-                                    << std::setfill('0') << (*it)
+                                    << std::setfill('0') << id
                                 << "." << std::hex << std::setw(2)
                                     << std::setfill('0') << thrd->get_thread_phase()
                                 << "/" << std::hex << std::setw(8)
@@ -18,6 +18,8 @@
 #include <hpx/runtime/threads/thread_pool_base.hpp>
 #include <hpx/state.hpp>
 #include <hpx/util/assert.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
 #include <hpx/util/safe_lexical_cast.hpp>
 #include <hpx/util/yield_while.hpp>
 #include <hpx/util_fwd.hpp>
@@ -36,6 +38,7 @@
 #include <memory>
 #include <mutex>
 #include <set>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -62,9 +65,75 @@ namespace hpx { namespace threads { namespace policies
             }
             std::atomic<std::int32_t>& counter_;
         };
+
+        // Each worker thread which runs out of work first keeps spinning,
+        // then yields its core to the operating system, and eventually parks
+        // on its own condition variable. Having one condition variable per
+        // worker allows to wake up exactly the worker new work was scheduled
+        // for.
+        struct idle_park_data
+        {
+            idle_park_data()
+              : parked_(false), idle_count_(0), wake_time_(0),
+                parks_(0), wakeups_(0), wake_latency_(0), wake_latency_count_(0)
+            {}
+
+            compat::mutex mtx_;
+            compat::condition_variable cond_;
+            std::atomic<bool> parked_;
+            std::atomic<std::uint32_t> idle_count_;
+
+            // the members below are protected by mtx_
+            std::uint64_t wake_time_;
+            std::int64_t parks_;
+            std::int64_t wakeups_;
+            std::int64_t wake_latency_;
+            std::int64_t wake_latency_count_;
+
+            // avoid false sharing between neighboring workers
+            char pad_[64];
+        };
     }
 #endif
 
+    namespace detail
+    {
+        // Number of affinity hints which could (or could not) be honored,
+        // kept separately for each hinted worker thread.
+        struct affinity_hint_data
+        {
+            affinity_hint_data()
+              : hits_(0), misses_(0), resolved_(0), overloaded_(false)
+            {}
+
+            std::atomic<std::int64_t> hits_;
+            std::atomic<std::int64_t> misses_;
+
+            // the queue length is sampled only every so many hints
+            std::atomic<std::uint32_t> resolved_;
+            std::atomic<bool> overloaded_;
+
+            // avoid false sharing between neighboring workers
+            char pad_[64];
+        };
+
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+        // Number of steal operations performed by a worker thread, each of
+        // which may have stolen more than one thread.
+        struct steal_batch_data
+        {
+            steal_batch_data()
+              : batches_(0)
+            {}
+
+            std::atomic<std::int64_t> batches_;
+
+            // avoid false sharing between neighboring workers
+            char pad_[64];
+        };
+#endif
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     /// The scheduler_base defines the interface to be implemented by all
     /// scheduler policies
@@ -81,7 +150,14 @@ namespace hpx { namespace threads { namespace policies
                 scheduler_mode mode = nothing_special)
           : mode_(mode)
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-          , wait_count_(0)
+          , idle_data_(num_threads)
+          , parked_count_(0)
+          , idle_spin_count_(
+                hpx::util::safe_lexical_cast<std::uint32_t>(
+                    hpx::get_config_entry("hpx.scheduler.idle_spin_count", 0)))
+          , idle_yield_count_(
+                hpx::util::safe_lexical_cast<std::uint32_t>(
+                    hpx::get_config_entry("hpx.scheduler.idle_yield_count", 4)))
           , max_idle_backoff_time_(
                 hpx::util::safe_lexical_cast<double>(
                     hpx::get_config_entry("hpx.max_idle_backoff_time",
@@ -94,6 +170,18 @@ namespace hpx { namespace threads { namespace policies
           , description_(description)
           , parent_pool_(nullptr)
           , background_thread_count_(0)
+          , affinity_data_(num_threads)
+          , affinity_hints_(
+                hpx::util::safe_lexical_cast<int>(
+                    hpx::get_config_entry(
+                        "hpx.scheduler.affinity_hints", 0)) != 0)
+          , affinity_max_queue_length_(
+                hpx::util::safe_lexical_cast<std::int64_t>(
+                    hpx::get_config_entry(
+                        "hpx.scheduler.affinity_max_queue_length", 16)))
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+          , steal_batch_data_(num_threads)
+#endif
         {
             for (std::size_t i = 0; i != num_threads; ++i)
                 states_[i].store(state_initialized);
@@ -127,23 +215,82 @@ namespace hpx { namespace threads { namespace policies
 
         char const* get_description() const { return description_; }
 
-        void idle_callback(std::size_t /*num_thread*/)
+        void idle_callback(std::size_t num_thread)
         {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-            // Put this thread to sleep for some time, additionally it gets
-            // woken up on new work.
+            HPX_ASSERT(num_thread < idle_data_.size());
+            detail::idle_park_data& d = idle_data_[num_thread];
+
+            // Keep spinning for the first idle rounds, then give up the core
+            // for a couple of rounds before parking this thread.
+            std::uint32_t idle_count =
+                d.idle_count_.fetch_add(1, std::memory_order_relaxed);
+            if (idle_count < idle_spin_count_)
+                return;
+
+            idle_count -= idle_spin_count_;
+            if (idle_count < idle_yield_count_)
+            {
+                std::this_thread::yield();
+                return;
+            }
 
-            // Exponential backoff with a maximum sleep time.
-            double exponent = (std::min)(double(wait_count_),
+            // Park this thread for some time, additionally it gets woken up
+            // on new work. Exponential backoff with a maximum sleep time.
+            double exponent = (std::min)(double(idle_count - idle_yield_count_),
                 double(std::numeric_limits<double>::max_exponent - 1));
 
             std::chrono::milliseconds period(std::lround(
                 (std::min)(max_idle_backoff_time_, std::pow(2.0, exponent))));
 
-            ++wait_count_;
+            std::unique_lock<pu_mutex_type> l(d.mtx_);
 
-            std::unique_lock<pu_mutex_type> l(mtx_);
-            cond_.wait_for(l, period);
+            d.parked_.store(true);
+            ++parked_count_;
+
+            // Work scheduled before parked_ was set may not have triggered a
+            // wakeup, re-check the queues before going to sleep. Work queued
+            // for other workers counts as well if it can be stolen, those
+            // workers are not necessarily going to wake us up.
+            std::size_t const queue_num =
+                has_thread_stealing() ? std::size_t(-1) : num_thread;
+            if (get_queue_length(queue_num) != 0)
+            {
+                d.parked_.store(false, std::memory_order_relaxed);
+                --parked_count_;
+                d.idle_count_.store(0, std::memory_order_relaxed);
+                return;
+            }
+
+            ++d.parks_;
+            if (d.cond_.wait_for(l, period,
+                    [&d]() { return !d.parked_.load(); }))
+            {
+                // woken up by unpark(), expect new work to be available
+                ++d.wakeups_;
+                ++d.wake_latency_count_;
+                d.wake_latency_ += static_cast<std::int64_t>(
+                    util::high_resolution_clock::now() - d.wake_time_);
+                d.idle_count_.store(0, std::memory_order_relaxed);
+            }
+            else
+            {
+                d.parked_.store(false, std::memory_order_relaxed);
+                --parked_count_;
+            }
+#endif
+        }
+
+        /// This function gets called by the scheduling loop whenever it has
+        /// found work, it restarts the idle backoff of the given worker.
+        void reset_idle_backoff(std::size_t num_thread)
+        {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+            HPX_ASSERT(num_thread < idle_data_.size());
+            std::atomic<std::uint32_t>& idle_count =
+                idle_data_[num_thread].idle_count_;
+            if (idle_count.load(std::memory_order_relaxed) != 0)
+                idle_count.store(0, std::memory_order_relaxed);
 #endif
         }
 
@@ -164,15 +311,55 @@ namespace hpx { namespace threads { namespace policies
         void do_some_work(std::size_t num_thread)
         {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-            wait_count_.store(0, std::memory_order_release);
+            // nothing to do if no worker is parked
+            if (parked_count_.load() == 0)
+                return;
 
+            std::size_t const num_workers = idle_data_.size();
             if (num_thread == std::size_t(-1))
-                cond_.notify_all();
-            else
-                cond_.notify_one();
+            {
+                for (std::size_t i = 0; i != num_workers; ++i)
+                    unpark(i);
+                return;
+            }
+
+            // Prefer waking the worker the work was scheduled for, otherwise
+            // wake any other parked worker which may steal the work.
+            num_thread %= num_workers;
+            for (std::size_t i = 0; i != num_workers; ++i)
+            {
+                if (unpark((num_thread + i) % num_workers))
+                    break;
+            }
 #endif
         }
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        std::int64_t get_idle_park_count(std::size_t num_thread, bool reset)
+        {
+            return accumulate_idle_data(num_thread, reset,
+                &detail::idle_park_data::parks_);
+        }
+
+        std::int64_t get_idle_wakeup_count(std::size_t num_thread, bool reset)
+        {
+            return accumulate_idle_data(num_thread, reset,
+                &detail::idle_park_data::wakeups_);
+        }
+
+        // average time between unparking a worker and the worker running
+        // again [ns]
+        std::int64_t get_average_idle_wake_latency(
+            std::size_t num_thread, bool reset)
+        {
+            std::int64_t wakeups = accumulate_idle_data(num_thread, reset,
+                &detail::idle_park_data::wake_latency_count_);
+            std::int64_t latency = accumulate_idle_data(num_thread, reset,
+                &detail::idle_park_data::wake_latency_);
+            return wakeups == 0 ? 0 : latency / wakeups;
+        }
+#endif
+
         virtual void suspend(std::size_t num_thread)
         {
             HPX_ASSERT(num_thread < suspend_conds_.size());
@@ -456,6 +643,25 @@ namespace hpx { namespace threads { namespace policies
 
         virtual std::int64_t get_num_stolen_from_pending(std::size_t num_thread,
             bool reset) = 0;
+
+        // The number of steal operations other workers performed on the
+        // pending queue of the given worker.
+        virtual std::int64_t get_num_stolen_from_pending_batches(
+            std::size_t num_thread, bool reset)
+        {
+            if (num_thread != std::size_t(-1))
+            {
+                HPX_ASSERT(num_thread < steal_batch_data_.size());
+                return util::get_and_reset_value(
+                    steal_batch_data_[num_thread].batches_, reset);
+            }
+
+            std::int64_t result = 0;
+            for (detail::steal_batch_data& d : steal_batch_data_)
+                result += util::get_and_reset_value(d.batches_, reset);
+            return result;
+        }
+
         virtual std::int64_t get_num_stolen_to_pending(std::size_t num_thread,
             bool reset) = 0;
         virtual std::int64_t get_num_stolen_from_staged(std::size_t num_thread,
@@ -464,9 +670,76 @@ namespace hpx { namespace threads { namespace policies
             bool reset) = 0;
 #endif
 
+        virtual std::int64_t get_thread_cache_hits(std::size_t num_thread,
+            bool reset) = 0;
+        virtual std::int64_t get_thread_cache_misses(std::size_t num_thread,
+            bool reset) = 0;
+
+        // Only schedulers which order their work by deadline keep track of
+        // missed deadlines.
+        virtual std::int64_t get_num_deadline_misses(std::size_t num_thread,
+            bool reset)
+        {
+            return 0;
+        }
+
         virtual std::int64_t get_queue_length(
             std::size_t num_thread = std::size_t(-1)) const = 0;
 
+        // Return whether resumed threads and asynchronous continuations
+        // should be given an affinity hint by default (see
+        // hpx.scheduler.affinity_hints).
+        bool use_affinity_hints() const
+        {
+            return affinity_hints_;
+        }
+
+        // An affinity hint names the worker thread the work was related to
+        // last (see thread_schedule_hint_mode_affinity). It is turned into a
+        // plain hint for that worker as long as the worker's queue is not
+        // overloaded, otherwise the hint is dropped. The queue length is
+        // sampled only for every affinity_sample_interval-th hint.
+        thread_schedule_hint resolve_affinity_hint(
+            thread_schedule_hint schedulehint) const
+        {
+            if (schedulehint.mode != thread_schedule_hint_mode_affinity)
+                return schedulehint;
+
+            std::size_t num_thread = std::size_t(schedulehint.hint);
+            if (schedulehint.hint < 0 || num_thread >= affinity_data_.size())
+                return thread_schedule_hint();
+
+            detail::affinity_hint_data& d = affinity_data_[num_thread];
+            if (d.resolved_.fetch_add(1, std::memory_order_relaxed) %
+                    affinity_sample_interval == 0)
+            {
+                d.overloaded_.store(
+                    get_queue_length(num_thread) >= affinity_max_queue_length_,
+                    std::memory_order_relaxed);
+            }
+
+            if (d.overloaded_.load(std::memory_order_relaxed))
+            {
+                ++d.misses_;
+                return thread_schedule_hint();
+            }
+
+            ++d.hits_;
+            return thread_schedule_hint(schedulehint.hint);
+        }
+
+        std::int64_t get_affinity_hits(std::size_t num_thread, bool reset)
+        {
+            return accumulate_affinity_data(
+                num_thread, reset, &detail::affinity_hint_data::hits_);
+        }
+
+        std::int64_t get_affinity_misses(std::size_t num_thread, bool reset)
+        {
+            return accumulate_affinity_data(
+                num_thread, reset, &detail::affinity_hint_data::misses_);
+        }
+
         virtual std::int64_t get_thread_count(
             thread_state_enum state = unknown,
             thread_priority priority = thread_priority_default,
@@ -542,13 +815,70 @@ namespace hpx { namespace threads { namespace policies
         std::atomic<scheduler_mode> mode_;
 
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-        // support for suspension on idle queues
-        pu_mutex_type mtx_;
-        compat::condition_variable cond_;
-        std::atomic<std::uint32_t> wait_count_;
+        // Wake up the given worker if it is parked, return whether the worker
+        // was woken up.
+        bool unpark(std::size_t num_thread)
+        {
+            detail::idle_park_data& d = idle_data_[num_thread];
+            if (!d.parked_.load(std::memory_order_relaxed))
+                return false;
+
+            std::lock_guard<pu_mutex_type> l(d.mtx_);
+            if (!d.parked_.load(std::memory_order_relaxed))
+                return false;
+
+            d.parked_.store(false, std::memory_order_relaxed);
+            --parked_count_;
+            d.wake_time_ = util::high_resolution_clock::now();
+            d.cond_.notify_one();
+            return true;
+        }
+
+        std::int64_t accumulate_idle_data(std::size_t num_thread, bool reset,
+            std::int64_t detail::idle_park_data::* value)
+        {
+            if (num_thread != std::size_t(-1))
+            {
+                HPX_ASSERT(num_thread < idle_data_.size());
+                detail::idle_park_data& d = idle_data_[num_thread];
+                std::lock_guard<pu_mutex_type> l(d.mtx_);
+                return util::get_and_reset_value(d.*value, reset);
+            }
+
+            std::int64_t result = 0;
+            for (detail::idle_park_data& d : idle_data_)
+            {
+                std::lock_guard<pu_mutex_type> l(d.mtx_);
+                result += util::get_and_reset_value(d.*value, reset);
+            }
+            return result;
+        }
+
+        // support for parking of worker threads on idle queues
+        std::vector<detail::idle_park_data> idle_data_;
+        std::atomic<std::size_t> parked_count_;
+        std::uint32_t const idle_spin_count_;
+        std::uint32_t const idle_yield_count_;
         double max_idle_backoff_time_;
 #endif
 
+        std::int64_t accumulate_affinity_data(std::size_t num_thread,
+            bool reset,
+            std::atomic<std::int64_t> detail::affinity_hint_data::* value)
+        {
+            if (num_thread != std::size_t(-1))
+            {
+                HPX_ASSERT(num_thread < affinity_data_.size());
+                return util::get_and_reset_value(
+                    affinity_data_[num_thread].*value, reset);
+            }
+
+            std::int64_t result = 0;
+            for (detail::affinity_hint_data& d : affinity_data_)
+                result += util::get_and_reset_value(d.*value, reset);
+            return result;
+        }
+
         // support for suspension of pus
         std::vector<pu_mutex_type> suspend_mtxs_;
         std::vector<compat::condition_variable> suspend_conds_;
@@ -563,6 +893,26 @@ namespace hpx { namespace threads { namespace policies
 
         std::atomic<std::int64_t> background_thread_count_;
 
+        // support for affinity hints
+        enum { affinity_sample_interval = 16 };
+
+        mutable std::vector<detail::affinity_hint_data> affinity_data_;
+        bool const affinity_hints_;
+        std::int64_t const affinity_max_queue_length_;
+
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+        // counted for the worker the threads were stolen from
+        void increment_num_stolen_from_pending_batches(std::size_t victim)
+        {
+            HPX_ASSERT(victim < steal_batch_data_.size());
+            ++steal_batch_data_[victim].batches_;
+        }
+
+        std::vector<detail::steal_batch_data> steal_batch_data_;
+#else
+        void increment_num_stolen_from_pending_batches(std::size_t) {}
+#endif
+
 #if defined(HPX_HAVE_SCHEDULER_LOCAL_STORAGE)
     public:
         coroutines::detail::tss_data_node* find_tss_data(void const* key)
@@ -21,14 +21,17 @@
 #include <hpx/util/logging.hpp>
 #include <hpx/util_fwd.hpp>
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <memory>
+#include <random>
 #include <string>
 #include <numeric>
 #include <type_traits>
+#include <vector>
 
 #include <hpx/config/warnings_prefix.hpp>
 
@@ -74,6 +77,8 @@ namespace policies {
             char const* description,
             int max_tasks = max_thread_count)
           : scheduler_base(num_worker_threads, description)
+          , d_victims_(1, std::vector<std::size_t>(1, 0))
+          , victim_seeds_(num_worker_threads)
           , cores_per_queue_(cores_per_queue)
           , max_queue_thread_count_(max_tasks)
           , num_workers_(num_worker_threads)
@@ -587,6 +592,7 @@ namespace policies {
 
             using threads::thread_schedule_hint_mode;
 
+            data.schedulehint = resolve_affinity_hint(data.schedulehint);
             switch (data.schedulehint.mode) {
             case thread_schedule_hint_mode::thread_schedule_hint_mode_none:
             {
@@ -686,26 +692,33 @@ namespace policies {
 
             // find the numa domain from the local thread index
             std::size_t domain_num = d_lookup_[thread_num];
+            std::uint64_t const seed = next_victim_seed(thread_num);
 
             // is there a high priority task, take first from our numa domain
             // and then try to steal from others
             for (std::size_t d=0; d<num_domains_; ++d) {
-                std::size_t dom = (domain_num+d) % num_domains_;
-                // set the preferred queue for this domain, if applicable
-                std::size_t q_index = q_lookup_[thread_num];
-                // get next task, steal if from another domain
-                result = hp_queues_[dom].get_next_thread(q_index, thrd);
+                std::size_t dom = d_victims_[domain_num][d];
+                // get next task from our own domain, steal from the
+                // other domains starting at a random queue
+                result = (dom == domain_num) ?
+                    hp_queues_[dom].get_next_thread(
+                        q_lookup_[thread_num], thrd, seed) :
+                    hp_queues_[dom].get_next_thread(
+                        seed % hp_queues_[dom].size(), thrd);
                 if (result) break;
             }
 
             // try a normal priority task
             if (!result) {
                 for (std::size_t d=0; d<num_domains_; ++d) {
-                    std::size_t dom = (domain_num+d) % num_domains_;
-                    // set the preferred queue for this domain, if applicable
-                    std::size_t q_index = q_lookup_[thread_num];
-                    // get next task, steal if from another domain
-                    result = np_queues_[dom].get_next_thread(q_index, thrd);
+                    std::size_t dom = d_victims_[domain_num][d];
+                    // get next task from our own domain, steal from the
+                    // other domains starting at a random queue
+                    result = (dom == domain_num) ?
+                        np_queues_[dom].get_next_thread(
+                            q_lookup_[thread_num], thrd, seed) :
+                        np_queues_[dom].get_next_thread(
+                            seed % np_queues_[dom].size(), thrd);
                     if (result) break;
                 }
             }
@@ -752,6 +765,7 @@ namespace policies {
 
             using threads::thread_schedule_hint_mode;
 
+            schedulehint = resolve_affinity_hint(schedulehint);
             switch (schedulehint.mode) {
             case thread_schedule_hint_mode::thread_schedule_hint_mode_none:
             {
@@ -842,6 +856,7 @@ namespace policies {
 
             using threads::thread_schedule_hint_mode;
 
+            schedulehint = resolve_affinity_hint(schedulehint);
             switch (schedulehint.mode) {
             case thread_schedule_hint_mode::thread_schedule_hint_mode_none:
             {
@@ -926,6 +941,83 @@ namespace policies {
             thrd->get_queue<thread_queue_type>().destroy_thread(thrd, busy_count);
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Queries the number of thread objects reused from (or not found in)
+        // the per-worker thread caches.
+        std::int64_t get_thread_cache_hits(std::size_t num_thread, bool reset) override
+        {
+            std::int64_t count = 0;
+
+            if (num_thread == std::size_t(-1))
+            {
+                for (std::size_t d = 0; d < num_domains_; ++d) {
+                    for (auto &queue : lp_queues_[d].queues_) {
+                        count += queue->get_thread_cache_hits(reset);
+                    }
+
+                    for (auto &queue : np_queues_[d].queues_) {
+                        count += queue->get_thread_cache_hits(reset);
+                    }
+
+                    for (auto &queue : hp_queues_[d].queues_) {
+                        count += queue->get_thread_cache_hits(reset);
+                    }
+                }
+
+                return count;
+            }
+
+            std::size_t domain_num = d_lookup_[num_thread];
+
+            count += lp_queues_[domain_num].queues_[lp_lookup_[num_thread]]->
+                get_thread_cache_hits(reset);
+
+            count += np_queues_[domain_num].queues_[np_lookup_[num_thread]]->
+                get_thread_cache_hits(reset);
+
+            count += hp_queues_[domain_num].queues_[hp_lookup_[num_thread]]->
+                get_thread_cache_hits(reset);
+
+            return count;
+        }
+
+        std::int64_t get_thread_cache_misses(std::size_t num_thread, bool reset) override
+        {
+            std::int64_t count = 0;
+
+            if (num_thread == std::size_t(-1))
+            {
+                for (std::size_t d = 0; d < num_domains_; ++d) {
+                    for (auto &queue : lp_queues_[d].queues_) {
+                        count += queue->get_thread_cache_misses(reset);
+                    }
+
+                    for (auto &queue : np_queues_[d].queues_) {
+                        count += queue->get_thread_cache_misses(reset);
+                    }
+
+                    for (auto &queue : hp_queues_[d].queues_) {
+                        count += queue->get_thread_cache_misses(reset);
+                    }
+                }
+
+                return count;
+            }
+
+            std::size_t domain_num = d_lookup_[num_thread];
+
+            count += lp_queues_[domain_num].queues_[lp_lookup_[num_thread]]->
+                get_thread_cache_misses(reset);
+
+            count += np_queues_[domain_num].queues_[np_lookup_[num_thread]]->
+                get_thread_cache_misses(reset);
+
+            count += hp_queues_[domain_num].queues_[hp_lookup_[num_thread]]->
+                get_thread_cache_misses(reset);
+
+            return count;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // This returns the current length of the queues (work items and new
         // items)
@@ -1086,28 +1178,35 @@ namespace policies {
 
             // find the numa domain from the local thread index
             std::size_t domain_num = d_lookup_[thread_num];
+            std::uint64_t const seed = next_victim_seed(thread_num);
 
             // is there a high priority task, take first from our numa domain
             // and then try to steal from others
             for (std::size_t d=0; d<num_domains_; ++d) {
-                std::size_t dom = (domain_num+d) % num_domains_;
-                // set the preferred queue for this domain, if applicable
-                std::size_t q_index = q_lookup_[thread_num];
-                // get next task, steal if from another domain
-                result = hp_queues_[dom].wait_or_add_new(q_index, running,
-                    idle_loop_count, added);
+                std::size_t dom = d_victims_[domain_num][d];
+                // get next task from our own domain, steal from the
+                // other domains starting at a random queue
+                result = (dom == domain_num) ?
+                    hp_queues_[dom].wait_or_add_new(q_lookup_[thread_num],
+                        running, idle_loop_count, added, seed) :
+                    hp_queues_[dom].wait_or_add_new(
+                        seed % hp_queues_[dom].size(), running,
+                        idle_loop_count, added);
                 if (0 != added) return result;
             }
 
             // try a normal priority task
             if (!result) {
                 for (std::size_t d=0; d<num_domains_; ++d) {
-                    std::size_t dom = (domain_num+d) % num_domains_;
-                    // set the preferred queue for this domain, if applicable
-                    std::size_t q_index = q_lookup_[thread_num];
-                    // get next task, steal if from another domain
-                    result = np_queues_[dom].wait_or_add_new(q_index, running,
-                        idle_loop_count, added);
+                    std::size_t dom = d_victims_[domain_num][d];
+                    // get next task from our own domain, steal from the
+                    // other domains starting at a random queue
+                    result = (dom == domain_num) ?
+                        np_queues_[dom].wait_or_add_new(q_lookup_[thread_num],
+                            running, idle_loop_count, added, seed) :
+                        np_queues_[dom].wait_or_add_new(
+                            seed % np_queues_[dom].size(), running,
+                            idle_loop_count, added);
                     if (0 != added) return result;
                 }
             }
@@ -1174,6 +1273,41 @@ namespace policies {
                     q_lookup_[local_id] = q_counts_[d_lookup_[local_id]]++;
                 }
 
+                // determine the socket of each numa domain
+                std::array<std::size_t, HPX_HAVE_MAX_NUMA_DOMAIN_COUNT> s_lookup;
+                std::fill(s_lookup.begin(), s_lookup.end(), 0);
+                for (std::size_t local_id=0; local_id!=num_workers_; ++local_id)
+                {
+                    std::size_t global_id = local_to_global_thread_index(local_id);
+                    std::size_t pu_num = rp.get_pu_num(global_id);
+                    s_lookup[d_lookup_[local_id]] =
+                        topo.get_socket_number(pu_num);
+                }
+
+                // order in which the numa domains are visited when looking
+                // for work: our own domain first, then the domains located
+                // on the same socket, then all remote ones
+                d_victims_.assign(num_domains_,
+                    std::vector<std::size_t>(num_domains_, 0));
+                for (std::size_t d = 0; d < num_domains_; ++d)
+                {
+                    std::size_t n = 0;
+                    d_victims_[d][n++] = d;
+                    for (std::size_t i = 1; i < num_domains_; ++i)
+                    {
+                        std::size_t dom = (d + i) % num_domains_;
+                        if (s_lookup[dom] == s_lookup[d])
+                            d_victims_[d][n++] = dom;
+                    }
+                    for (std::size_t i = 1; i < num_domains_; ++i)
+                    {
+                        std::size_t dom = (d + i) % num_domains_;
+                        if (s_lookup[dom] != s_lookup[d])
+                            d_victims_[d][n++] = dom;
+                    }
+                    HPX_ASSERT(n == num_domains_);
+                }
+
                 // create queue sets for each numa domain
                 for (std::size_t i = 0; i < num_domains_; ++i)
                 {
@@ -1206,10 +1340,82 @@ namespace policies {
                     lp_lookup_[local_id] = lp_queues_[d_lookup_[local_id]].
                         get_queue_index(q_lookup_[local_id]);
                 }
+
+                // get the topology masks of all workers...
+                std::vector<mask_type> l3_masks(num_workers_);
+                std::vector<mask_type> l2_masks(num_workers_);
+                std::vector<mask_type> core_masks(num_workers_);
+                for (std::size_t local_id=0; local_id!=num_workers_; ++local_id)
+                {
+                    std::size_t global_id = local_to_global_thread_index(local_id);
+                    std::size_t pu_num = rp.get_pu_num(global_id);
+                    l3_masks[local_id] =
+                        topo.get_cache_affinity_mask(pu_num, 3);
+                    l2_masks[local_id] =
+                        topo.get_cache_affinity_mask(pu_num, 2);
+                    core_masks[local_id] = topo.get_core_affinity_mask(pu_num);
+                }
+
+                // ...and determine the order in which each worker visits the
+                // queues of its own domain: its own queue first, then the
+                // queues of the workers sharing the same core (SMT siblings),
+                // the same L2 cache, the same L3 cache and all others
+                auto set_victims =
+                    [&](numa_queues& queues, std::size_t local_id)
+                {
+                    std::size_t const domain = d_lookup_[local_id];
+                    std::size_t const own =
+                        queues.get_queue_index(q_lookup_[local_id]);
+
+                    // the closest level shared with any worker of the queue
+                    std::vector<std::size_t> level(queues.size(), 3);
+                    for (std::size_t other=0; other!=num_workers_; ++other)
+                    {
+                        if (d_lookup_[other] != domain)
+                            continue;
+
+                        std::size_t& l =
+                            level[queues.get_queue_index(q_lookup_[other])];
+                        if (any(core_masks[local_id] & core_masks[other]))
+                            l = 0;
+                        else if (any(l2_masks[local_id] & l2_masks[other]))
+                            l = (std::min)(l, std::size_t(1));
+                        else if (any(l3_masks[local_id] & l3_masks[other]))
+                            l = (std::min)(l, std::size_t(2));
+                    }
+
+                    std::vector<std::size_t> victims(1, own);
+                    std::vector<std::size_t> levels(1, 1);
+                    for (std::size_t l = 0; l != 4; ++l)
+                    {
+                        for (std::size_t i = 1; i < queues.size(); ++i)
+                        {
+                            std::size_t q = (own + i) % queues.size();
+                            if (level[q] == l)
+                                victims.push_back(q);
+                        }
+                        levels.push_back(victims.size());
+                    }
+
+                    queues.set_victims(q_lookup_[local_id], std::move(victims),
+                        std::move(levels));
+                };
+
+                for (std::size_t local_id=0; local_id!=num_workers_; ++local_id)
+                {
+                    set_victims(hp_queues_[d_lookup_[local_id]], local_id);
+                    set_victims(np_queues_[d_lookup_[local_id]], local_id);
+                }
             }
 
             lock.unlock();
 
+            // every worker picks its victims based on a sequence of its own,
+            // the state must never be zero
+            victim_seeds_[thread_num].state_ =
+                (static_cast<std::uint64_t>(std::random_device{}()) << 32 |
+                    (thread_num + 1)) | 1;
+
             std::size_t domain_num = d_lookup_[thread_num];
 
             // NOTE: This may call on_start_thread multiple times for a single
@@ -1275,6 +1481,19 @@ namespace policies {
         }
 
     protected:
+        // advance the pseudo-random sequence of the given worker which
+        // determines where it starts looking for work in each level of the
+        // topology hierarchy
+        std::uint64_t next_victim_seed(std::size_t thread_num)
+        {
+            // xorshift64*, only the given worker accesses its state
+            std::uint64_t& state = victim_seeds_[thread_num].state_;
+            state ^= state >> 12;
+            state ^= state << 25;
+            state ^= state >> 27;
+            return (state * 0x2545f4914f6cdd1dull) >> 32;
+        }
+
         typedef queue_holder<thread_queue_type> numa_queues;
 
         std::array<numa_queues, HPX_HAVE_MAX_NUMA_DOMAIN_COUNT> np_queues_;
@@ -1285,6 +1504,9 @@ namespace policies {
         // lookup domain from local worker index
         std::array<std::size_t, HPX_HAVE_MAX_CPU_COUNT> d_lookup_;
 
+        // order of domains to steal from for each domain
+        std::vector<std::vector<std::size_t> > d_victims_;
+
         // index of queue on domain from local worker index
         std::array<std::size_t, HPX_HAVE_MAX_CPU_COUNT> hp_lookup_;
         std::array<std::size_t, HPX_HAVE_MAX_CPU_COUNT> np_lookup_;
@@ -1293,6 +1515,19 @@ namespace policies {
         // lookup sub domain queue index from local worker index
         std::array<std::size_t, HPX_HAVE_MAX_CPU_COUNT> q_lookup_;
 
+        struct victim_seed
+        {
+            victim_seed()
+              : state_(1)
+            {}
+
+            std::uint64_t state_;
+
+            // avoid false sharing between neighboring workers
+            char pad_[64];
+        };
+        std::vector<victim_seed> victim_seeds_;
+
         // number of cores per queue for HP, NP, LP queues
         core_ratios cores_per_queue_;
 
@@ -13,6 +13,7 @@
 #include <hpx/runtime/config_entry.hpp>
 #include <hpx/runtime/threads/policies/lockfree_queue_backends.hpp>
 #include <hpx/runtime/threads/policies/queue_helpers.hpp>
+#include <hpx/runtime/threads/policies/thread_registry.hpp>
 #include <hpx/runtime/threads/thread_data.hpp>
 #include <hpx/throw_exception.hpp>
 #include <hpx/util/assert.hpp>
@@ -28,6 +29,7 @@
 
 #include <boost/lexical_cast.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -38,7 +40,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
-#include <unordered_set>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -70,6 +72,14 @@ namespace hpx { namespace threads { namespace policies
             return min_tasks_to_steal_pending;
         }
 
+        inline int get_max_tasks_to_steal_pending()
+        {
+            static int max_tasks_to_steal_pending =
+                boost::lexical_cast<int>(hpx::get_config_entry(
+                    "hpx.thread_queue.max_tasks_to_steal_pending", "1"));
+            return max_tasks_to_steal_pending;
+        }
+
         inline int get_min_tasks_to_steal_staged()
         {
             static int min_tasks_to_steal_staged =
@@ -102,6 +112,14 @@ namespace hpx { namespace threads { namespace policies
             return max_delete_count;
         }
 
+        inline int get_thread_cache_size()
+        {
+            static int thread_cache_size =
+                boost::lexical_cast<int>(hpx::get_config_entry(
+                    "hpx.thread_queue.thread_cache_size", "64"));
+            return thread_cache_size;
+        }
+
         inline int get_max_terminated_threads()
         {
             static int max_terminated_threads =
@@ -134,6 +152,10 @@ namespace hpx { namespace threads { namespace policies
     //     bool pop(reference val, bool steal = true);
     //
     //     bool empty();
+    //
+    //     void on_start_thread(std::size_t num_thread);
+    //
+    //     void on_stop_thread(std::size_t num_thread);
     // };
     //
     // struct queue_policy
@@ -158,6 +180,10 @@ namespace hpx { namespace threads { namespace policies
         int const min_tasks_to_steal_pending;
         int const min_tasks_to_steal_staged;
 
+        // steal at most this amount of tasks at once (but not more than half
+        // of the tasks available)
+        int const max_tasks_to_steal_pending;
+
         // create at least this amount of threads from tasks
         int const min_add_new_count;
 
@@ -170,8 +196,9 @@ namespace hpx { namespace threads { namespace policies
         // number of terminated threads to collect before cleaning them up
         int const max_terminated_threads;
 
-        // this is the type of a map holding all threads (except depleted ones)
-        typedef std::unordered_set<thread_id_type> thread_map_type;
+        // this is the type of the registry holding all threads (except
+        // depleted ones), threads are linked intrusively
+        typedef detail::thread_registry thread_map_type;
 
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
         typedef
@@ -197,69 +224,118 @@ namespace hpx { namespace threads { namespace policies
             apply<thread_data*>::type terminated_items_type;
 
     protected:
-        template <typename Lock>
-        void create_thread_object(threads::thread_id_type& thrd,
-            threads::thread_init_data& data, thread_state_enum state, Lock& lk)
+        // Map the given stack size onto the index of the thread heap (and
+        // thread cache) holding unused thread objects of that stack size.
+        static std::size_t get_thread_heap_index(std::ptrdiff_t stacksize)
         {
-            HPX_ASSERT(lk.owns_lock());
-            HPX_ASSERT(data.stacksize != 0);
+            if (stacksize == get_stack_size(thread_stacksize_small))
+                return 0;
+            if (stacksize == get_stack_size(thread_stacksize_medium))
+                return 1;
+            if (stacksize == get_stack_size(thread_stacksize_large))
+                return 2;
+            if (stacksize == get_stack_size(thread_stacksize_huge))
+                return 3;
+
+            switch(stacksize) {
+            case thread_stacksize_small:
+                return 0;
 
-            std::ptrdiff_t stacksize = data.stacksize;
+            case thread_stacksize_medium:
+                return 1;
 
-            std::list<thread_id_type>* heap = nullptr;
+            case thread_stacksize_large:
+                return 2;
 
-            if (stacksize == get_stack_size(thread_stacksize_small))
-            {
-                heap = &thread_heap_small_;
-            }
-            else if (stacksize == get_stack_size(thread_stacksize_medium))
-            {
-                heap = &thread_heap_medium_;
-            }
-            else if (stacksize == get_stack_size(thread_stacksize_large))
-            {
-                heap = &thread_heap_large_;
+            case thread_stacksize_huge:
+                return 3;
+
+            case thread_stacksize_nostack:
+                return 4;
+
+            default:
+                break;
             }
-            else if (stacksize == get_stack_size(thread_stacksize_huge))
+
+            HPX_ASSERT(false);
+            return 0;
+        }
+
+        // Return whether the calling OS-thread is the worker owning this
+        // queue, only this worker may access the thread caches.
+        bool is_owning_worker() const
+        {
+            return owner_.load(std::memory_order_relaxed) ==
+                std::this_thread::get_id();
+        }
+
+        // Take an unused thread object from the cache of the owning worker.
+        // The cache has a single writer, this does not need the mutex.
+        bool get_cached_thread_object(threads::thread_id_type& thrd,
+            threads::thread_init_data& data, thread_state_enum state)
+        {
+            HPX_ASSERT(data.stacksize != 0);
+
+            if (!is_owning_worker())
+                return false;
+
+            std::vector<thread_data*>& cache =
+                thread_caches_[get_thread_heap_index(data.stacksize)];
+            if (cache.empty())
+                return false;
+
+            if (state == pending_do_not_schedule || state == pending_boost)
             {
-                heap = &thread_heap_huge_;
+                state = pending;
             }
-            else {
-                switch(stacksize) {
-                case thread_stacksize_small:
-                    heap = &thread_heap_small_;
-                    break;
 
-                case thread_stacksize_medium:
-                    heap = &thread_heap_medium_;
-                    break;
+            thrd = thread_id_type(cache.back());
+            cache.pop_back();
+            thrd->rebind(data, state);
 
-                case thread_stacksize_large:
-                    heap = &thread_heap_large_;
-                    break;
+            thread_cache_hits_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
 
-                case thread_stacksize_huge:
-                    heap = &thread_heap_huge_;
-                    break;
+        template <typename Lock>
+        void create_thread_object(threads::thread_id_type& thrd,
+            threads::thread_init_data& data, thread_state_enum state, Lock& lk)
+        {
+            HPX_ASSERT(lk.owns_lock());
+            HPX_ASSERT(data.stacksize != 0);
 
-                default:
-                    break;
-                }
-            }
-            HPX_ASSERT(heap);
+            std::size_t heap_index = get_thread_heap_index(data.stacksize);
 
             if (state == pending_do_not_schedule || state == pending_boost)
             {
                 state = pending;
             }
 
-            // Check for an unused thread object.
-            if (!heap->empty())
+            thread_cache_misses_.fetch_add(1, std::memory_order_relaxed);
+
+            // Check for an unused thread object in the shared heap.
+            std::list<thread_id_type>& heap = thread_heaps_[heap_index];
+            if (!heap.empty())
             {
                 // Take ownership of the thread object and rebind it.
-                thrd = heap->front();
-                heap->pop_front();
+                thrd = heap.front();
+                heap.pop_front();
                 thrd->rebind(data, state);
+
+                // Refill half of the cache of the owning worker while the
+                // mutex is held anyways.
+                if (is_owning_worker())
+                {
+                    std::vector<thread_data*>& cache =
+                        thread_caches_[heap_index];
+                    std::size_t count = cache.capacity() / 2;
+                    while (count-- != 0 && !heap.empty() &&
+                        cache.size() < cache.capacity())
+                    {
+                        cache.push_back(heap.front().get());
+                        heap.pop_front();
+                    }
+                }
             }
             else
             {
@@ -303,23 +379,13 @@ namespace hpx { namespace threads { namespace policies
                 thread_state_enum state = util::get<1>(*task);
                 threads::thread_id_type thrd;
 
-                create_thread_object(thrd, data, state, lk);
+                if (!get_cached_thread_object(thrd, data, state))
+                    create_thread_object(thrd, data, state, lk);
 
                 delete task;
 
                 // add the new entry to the map of all threads
-                std::pair<thread_map_type::iterator, bool> p =
-                    thread_map_.insert(thrd);
-
-                if (HPX_UNLIKELY(!p.second)) {
-                    --addfrom->new_tasks_count_;
-                    lk.unlock();
-                    HPX_THROW_EXCEPTION(hpx::out_of_memory,
-                        "threadmanager::add_new",
-                        "Couldn't add new thread to the thread map");
-                    return 0;
-                }
-
+                thread_map_.insert(thrd.get());
                 ++thread_map_count_;
 
                 // Decrement only after thread_map_count_ has been incremented
@@ -335,7 +401,7 @@ namespace hpx { namespace threads { namespace policies
                 }
 
                 // this thread has to be in the map now
-                HPX_ASSERT(thread_map_.find(thrd) != thread_map_.end());
+                HPX_ASSERT(thread_map_.contains(thrd.get()));
                 HPX_ASSERT(&thrd->get_queue<thread_queue>() == this);
             }
 
@@ -387,50 +453,37 @@ namespace hpx { namespace threads { namespace policies
             return addednew != 0;
         }
 
+        // The mutex has to be held, thread objects overflowing the cache of
+        // the owning worker are flushed to the shared heap.
         void recycle_thread(thread_id_type thrd)
         {
-            std::ptrdiff_t stacksize = thrd->get_stack_size();
+            std::size_t heap_index =
+                get_thread_heap_index(thrd->get_stack_size());
 
-            if (stacksize == get_stack_size(thread_stacksize_small))
+            std::list<thread_id_type>& heap = thread_heaps_[heap_index];
+            if (!is_owning_worker())
             {
-                thread_heap_small_.push_front(thrd);
+                heap.push_front(thrd);
+                return;
             }
-            else if (stacksize == get_stack_size(thread_stacksize_medium))
-            {
-                thread_heap_medium_.push_front(thrd);
-            }
-            else if (stacksize == get_stack_size(thread_stacksize_large))
-            {
-                thread_heap_large_.push_front(thrd);
-            }
-            else if (stacksize == get_stack_size(thread_stacksize_huge))
-            {
-                thread_heap_huge_.push_front(thrd);
-            }
-            else
+
+            // The cache has a fixed capacity and never allocates, hand half
+            // of it over to the shared heap once it is full.
+            std::vector<thread_data*>& cache = thread_caches_[heap_index];
+            if (cache.size() == cache.capacity())
             {
-                switch(stacksize) {
-                case thread_stacksize_small:
-                    thread_heap_small_.push_front(thrd);
-                    break;
-
-                case thread_stacksize_medium:
-                    thread_heap_medium_.push_front(thrd);
-                    break;
-
-                case thread_stacksize_large:
-                    thread_heap_large_.push_front(thrd);
-                    break;
-
-                case thread_stacksize_huge:
-                    thread_heap_huge_.push_front(thrd);
-                    break;
-
-                default:
-                    HPX_ASSERT(false);
-                    break;
+                std::size_t count = (cache.capacity() + 1) / 2;
+                while (count-- != 0 && !cache.empty())
+                {
+                    heap.push_front(thread_id_type(cache.back()));
+                    cache.pop_back();
                 }
             }
+
+            if (cache.size() < cache.capacity())
+                cache.push_back(thrd.get());
+            else
+                heap.push_front(thrd);
         }
 
     public:
@@ -453,19 +506,15 @@ namespace hpx { namespace threads { namespace policies
                 thread_data* todelete;
                 while (terminated_items_.pop(todelete))
                 {
-                    thread_id_type tid(todelete);
                     --terminated_items_count_;
 
                     // this thread has to be in this map
-                    HPX_ASSERT(thread_map_.find(tid) != thread_map_.end());
-
-                    bool deleted = thread_map_.erase(tid) != 0;
-                    HPX_ASSERT(deleted);
-                    if (deleted) {
-                        delete todelete;
-                        --thread_map_count_;
-                        HPX_ASSERT(thread_map_count_ >= 0);
-                    }
+                    HPX_ASSERT(thread_map_.contains(todelete));
+
+                    thread_map_.erase(todelete);
+                    delete todelete;
+                    --thread_map_count_;
+                    HPX_ASSERT(thread_map_count_ >= 0);
                 }
             }
             else {
@@ -478,17 +527,14 @@ namespace hpx { namespace threads { namespace policies
                 thread_data* todelete;
                 while (delete_count && terminated_items_.pop(todelete))
                 {
-                    thread_id_type tid(todelete);
                     --terminated_items_count_;
 
-                    thread_map_type::iterator it = thread_map_.find(tid);
-
                     // this thread has to be in this map
-                    HPX_ASSERT(it != thread_map_.end());
+                    HPX_ASSERT(thread_map_.contains(todelete));
 
-                    recycle_thread(*it);
+                    thread_map_.erase(todelete);
+                    recycle_thread(thread_id_type(todelete));
 
-                    thread_map_.erase(it);
                     --thread_map_count_;
                     HPX_ASSERT(thread_map_count_ >= 0);
 
@@ -532,6 +578,7 @@ namespace hpx { namespace threads { namespace policies
                 std::size_t max_count = max_thread_count)
           : min_tasks_to_steal_pending(detail::get_min_tasks_to_steal_pending()),
             min_tasks_to_steal_staged(detail::get_min_tasks_to_steal_staged()),
+            max_tasks_to_steal_pending(detail::get_max_tasks_to_steal_pending()),
             min_add_new_count(detail::get_min_add_new_count()),
             max_add_new_count(detail::get_max_add_new_count()),
             max_delete_count(detail::get_max_delete_count()),
@@ -554,10 +601,9 @@ namespace hpx { namespace threads { namespace policies
             new_tasks_wait_(0),
             new_tasks_wait_count_(0),
 #endif
-            thread_heap_small_(),
-            thread_heap_medium_(),
-            thread_heap_large_(),
-            thread_heap_huge_(),
+            owner_(std::thread::id()),
+            thread_cache_hits_(0),
+            thread_cache_misses_(0),
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
             add_new_time_(0),
             cleanup_terminated_time_(0),
@@ -571,21 +617,26 @@ namespace hpx { namespace threads { namespace policies
             stolen_to_staged_(0),
 #endif
             add_new_logger_("thread_queue::add_new")
-        {}
+        {
+            std::size_t cache_size = static_cast<std::size_t>(
+                (std::max)(detail::get_thread_cache_size(), 0));
+            for (std::vector<thread_data*>& cache : thread_caches_)
+                cache.reserve(cache_size);
+        }
 
         ~thread_queue()
         {
-            for(auto t: thread_heap_small_)
-                delete t.get();
-
-            for(auto t: thread_heap_medium_)
-                delete t.get();
-
-            for(auto t: thread_heap_large_)
-                delete t.get();
+            for (std::list<thread_id_type>& heap : thread_heaps_)
+            {
+                for (auto t: heap)
+                    delete t.get();
+            }
 
-            for(auto t: thread_heap_huge_)
-                delete t.get();
+            for (std::vector<thread_data*>& cache : thread_caches_)
+            {
+                for (thread_data* t : cache)
+                    delete t;
+            }
         }
 
         void set_max_count(std::size_t max_count = max_thread_count)
@@ -593,6 +644,16 @@ namespace hpx { namespace threads { namespace policies
             max_count_ = (0 == max_count) ? max_thread_count : max_count; //-V105
         }
 
+        std::int64_t get_thread_cache_hits(bool reset)
+        {
+            return util::get_and_reset_value(thread_cache_hits_, reset);
+        }
+
+        std::int64_t get_thread_cache_misses(bool reset)
+        {
+            return util::get_and_reset_value(thread_cache_misses_, reset);
+        }
+
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
         std::uint64_t get_creation_time(bool reset)
         {
@@ -725,29 +786,26 @@ namespace hpx { namespace threads { namespace policies
             {
                 threads::thread_id_type thrd;
 
+                // The owning worker reuses the thread objects of its cache
+                // without acquiring the mutex.
+                bool cached =
+                    get_cached_thread_object(thrd, data, initial_state);
+
                 // The mutex can not be locked while a new thread is getting
                 // created, as it might have that the current HPX thread gets
                 // suspended.
                 {
                     std::unique_lock<mutex_type> lk(mtx_);
 
-                    create_thread_object(thrd, data, initial_state, lk);
+                    if (!cached)
+                        create_thread_object(thrd, data, initial_state, lk);
 
                     // add a new entry in the map for this thread
-                    std::pair<thread_map_type::iterator, bool> p =
-                        thread_map_.insert(thrd);
-
-                    if (HPX_UNLIKELY(!p.second)) {
-                        lk.unlock();
-                        HPX_THROWS_IF(ec, hpx::out_of_memory,
-                            "threadmanager::register_thread",
-                            "Couldn't add new thread to the map of threads");
-                        return;
-                    }
+                    thread_map_.insert(thrd.get());
                     ++thread_map_count_;
 
                     // this thread has to be in the map now
-                    HPX_ASSERT(thread_map_.find(thrd) != thread_map_.end());
+                    HPX_ASSERT(thread_map_.contains(thrd.get()));
                     HPX_ASSERT(&thrd->get_queue<thread_queue>() == this);
 
                     // push the new thread in the pending queue thread
@@ -780,10 +838,11 @@ namespace hpx { namespace threads { namespace policies
                 ec = make_success_code();
         }
 
-        void move_work_items_from(thread_queue *src, std::int64_t count)
+        std::int64_t move_work_items_from(thread_queue *src, std::int64_t count)
         {
+            std::int64_t moved = 0;
             thread_description* trd;
-            while (src->work_items_.pop(trd))
+            while (moved != count && src->work_items_.pop(trd))
             {
                 --src->work_items_count_;
 
@@ -796,11 +855,11 @@ namespace hpx { namespace threads { namespace policies
                 }
 #endif
 
-                bool finished = count == ++work_items_count_;
+                ++work_items_count_;
                 work_items_.push(trd);
-                if (finished)
-                    break;
+                ++moved;
             }
+            return moved;
         }
 
         void move_task_items_from(thread_queue *src,
@@ -878,6 +937,27 @@ namespace hpx { namespace threads { namespace policies
             return false;
         }
 
+        /// Steal pending threads from the given queue. The first stolen
+        /// thread is returned, up to half of the threads remaining on the
+        /// victim (but not more than max_tasks_to_steal_pending - 1) are
+        /// moved to this queue in the same go. Returns the overall number of
+        /// stolen threads.
+        std::int64_t steal_work_items_from(thread_queue* src,
+            threads::thread_data*& thrd, bool allow_stealing = true)
+        {
+            if (!src->get_next_thread(thrd, allow_stealing))
+                return 0;
+
+            std::int64_t count = (std::min)(
+                static_cast<std::int64_t>(max_tasks_to_steal_pending) - 1,
+                (src->work_items_count_.load(std::memory_order_relaxed) + 1) / 2);
+
+            if (count <= 0)
+                return 1;
+
+            return 1 + move_work_items_from(src, count);
+        }
+
         /// Schedule the passed thread
         void schedule_thread(threads::thread_data* thrd, bool other_end = false)
         {
@@ -920,11 +1000,9 @@ namespace hpx { namespace threads { namespace policies
             std::lock_guard<mutex_type> lk(mtx_);
 
             std::int64_t num_threads = 0;
-            thread_map_type::const_iterator end = thread_map_.end();
-            for (thread_map_type::const_iterator it = thread_map_.begin();
-                 it != end; ++it)
+            for (thread_id_type const& id : thread_map_)
             {
-                if ((*it)->get_state().state() == state)
+                if (id->get_state().state() == state)
                     ++num_threads;
             }
             return num_threads;
@@ -934,14 +1012,12 @@ namespace hpx { namespace threads { namespace policies
         void abort_all_suspended_threads()
         {
             std::lock_guard<mutex_type> lk(mtx_);
-            thread_map_type::iterator end =  thread_map_.end();
-            for (thread_map_type::iterator it = thread_map_.begin();
-                 it != end; ++it)
+            for (thread_id_type const& id : thread_map_)
             {
-                if ((*it)->get_state().state() == suspended)
+                if (id->get_state().state() == suspended)
                 {
-                    (*it)->set_state(pending, wait_abort);
-                    schedule_thread((*it).get());
+                    id->set_state(pending, wait_abort);
+                    schedule_thread(id.get());
                 }
             }
         }
@@ -969,22 +1045,15 @@ namespace hpx { namespace threads { namespace policies
             if (state == unknown)
             {
                 std::lock_guard<mutex_type> lk(mtx_);
-                thread_map_type::const_iterator end =  thread_map_.end();
-                for (thread_map_type::const_iterator it = thread_map_.begin();
-                     it != end; ++it)
-                {
-                    ids.push_back(*it);
-                }
+                ids.assign(thread_map_.begin(), thread_map_.end());
             }
             else
             {
                 std::lock_guard<mutex_type> lk(mtx_);
-                thread_map_type::const_iterator end =  thread_map_.end();
-                for (thread_map_type::const_iterator it = thread_map_.begin();
-                     it != end; ++it)
+                for (thread_id_type const& id : thread_map_)
                 {
-                    if ((*it)->get_state().state() == state)
-                        ids.push_back(*it);
+                    if (id->get_state().state() == state)
+                        ids.push_back(id);
                 }
             }
 
@@ -1092,15 +1161,23 @@ namespace hpx { namespace threads { namespace policies
         }
 
         ///////////////////////////////////////////////////////////////////////
-        void on_start_thread(std::size_t num_thread) {}
-        void on_stop_thread(std::size_t num_thread) {}
+        void on_start_thread(std::size_t num_thread)
+        {
+            owner_.store(std::this_thread::get_id(),
+                std::memory_order_release);
+            work_items_.on_start_thread(num_thread);
+        }
+        void on_stop_thread(std::size_t num_thread)
+        {
+            work_items_.on_stop_thread(num_thread);
+        }
         void on_error(std::size_t num_thread, std::exception_ptr const& e) {}
 
     private:
         mutable mutex_type mtx_;                    ///< mutex protecting the members
 
         thread_map_type thread_map_;
-        ///< mapping of thread id's to HPX-threads
+        ///< intrusive registry of all HPX-threads owned by this queue
         std::atomic<std::int64_t> thread_map_count_;
         ///< overall count of work items
 
@@ -1133,10 +1210,20 @@ namespace hpx { namespace threads { namespace policies
         ///< overall number tasks waited
 #endif
 
-        std::list<thread_id_type> thread_heap_small_;
-        std::list<thread_id_type> thread_heap_medium_;
-        std::list<thread_id_type> thread_heap_large_;
-        std::list<thread_id_type> thread_heap_huge_;
+        enum { num_thread_heaps = 5 };
+
+        std::list<thread_id_type> thread_heaps_[num_thread_heaps];
+        ///< unused thread objects for each stack size
+        std::vector<thread_data*> thread_caches_[num_thread_heaps];
+        ///< unused thread objects for each stack size, accessed by the
+        ///< owning worker only, the capacity is fixed at construction
+        std::atomic<std::thread::id> owner_;
+        ///< the worker owning this queue
+
+        std::atomic<std::int64_t> thread_cache_hits_;
+        ///< count of thread objects reused from the thread caches
+        std::atomic<std::int64_t> thread_cache_misses_;
+        ///< count of thread objects not found in the thread caches
 
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
         std::uint64_t add_new_time_;
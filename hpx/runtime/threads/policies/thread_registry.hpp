@@ -0,0 +1,155 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_THREADS_POLICIES_THREAD_REGISTRY_HPP)
+#define HPX_THREADS_POLICIES_THREAD_REGISTRY_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/threads/thread_data.hpp>
+#include <hpx/util/assert.hpp>
+
+#include <cstddef>
+#include <iterator>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace threads { namespace policies { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The thread_registry keeps track of all threads owned by a thread_queue.
+    // It links the thread_data instances into an intrusive doubly-linked list
+    // using the hooks embedded in each thread_data, which makes inserting and
+    // removing a thread O(1) without any memory allocation or hashing.
+    //
+    // The registry is not thread-safe, all accesses have to be protected by
+    // the mutex of the owning queue.
+    class thread_registry
+    {
+    public:
+        HPX_NON_COPYABLE(thread_registry);
+
+        class const_iterator
+        {
+        public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef thread_id_type value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef thread_id_type const* pointer;
+            typedef thread_id_type reference;
+
+            const_iterator()
+              : thrd_(nullptr)
+            {}
+
+            explicit const_iterator(thread_data* thrd)
+              : thrd_(thrd)
+            {}
+
+            reference operator*() const
+            {
+                HPX_ASSERT(thrd_ != nullptr);
+                return thread_id_type(thrd_);
+            }
+
+            const_iterator& operator++()
+            {
+                HPX_ASSERT(thrd_ != nullptr);
+                thrd_ = thrd_->registry_next_;
+                return *this;
+            }
+
+            const_iterator operator++(int)
+            {
+                const_iterator tmp(*this);
+                ++*this;
+                return tmp;
+            }
+
+            friend bool operator==(const_iterator lhs, const_iterator rhs)
+            {
+                return lhs.thrd_ == rhs.thrd_;
+            }
+            friend bool operator!=(const_iterator lhs, const_iterator rhs)
+            {
+                return lhs.thrd_ != rhs.thrd_;
+            }
+
+        private:
+            thread_data* thrd_;
+        };
+
+        typedef const_iterator iterator;
+
+        thread_registry()
+          : head_(nullptr), size_(0)
+        {}
+
+        // Link the given thread into the registry, the thread must not be
+        // registered already.
+        void insert(thread_data* thrd)
+        {
+            HPX_ASSERT(thrd != nullptr && !contains(thrd));
+
+            thrd->registry_prev_ = nullptr;
+            thrd->registry_next_ = head_;
+            if (head_ != nullptr)
+                head_->registry_prev_ = thrd;
+            head_ = thrd;
+            ++size_;
+        }
+
+        // Unlink the given thread from the registry, the thread must have
+        // been registered before.
+        void erase(thread_data* thrd)
+        {
+            HPX_ASSERT(thrd != nullptr && contains(thrd));
+
+            if (thrd->registry_prev_ != nullptr)
+                thrd->registry_prev_->registry_next_ = thrd->registry_next_;
+            else
+                head_ = thrd->registry_next_;
+
+            if (thrd->registry_next_ != nullptr)
+                thrd->registry_next_->registry_prev_ = thrd->registry_prev_;
+
+            thrd->registry_prev_ = nullptr;
+            thrd->registry_next_ = nullptr;
+
+            HPX_ASSERT(size_ != 0);
+            --size_;
+        }
+
+        // Return whether the given thread is linked into this registry. This
+        // relies on unlinked threads having both hooks reset, a thread which
+        // is the only element of a registry is recognized by being its head.
+        bool contains(thread_data const* thrd) const
+        {
+            return thrd == head_ || thrd->registry_prev_ != nullptr;
+        }
+
+        const_iterator begin() const
+        {
+            return const_iterator(head_);
+        }
+        const_iterator end() const
+        {
+            return const_iterator();
+        }
+
+        std::size_t size() const
+        {
+            return size_;
+        }
+        bool empty() const
+        {
+            return size_ == 0;
+        }
+
+    private:
+        thread_data* head_;
+        std::size_t size_;
+    };
+}}}}
+
+#endif
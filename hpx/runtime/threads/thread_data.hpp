@@ -33,6 +33,7 @@
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <stack>
 #include <string>
 #include <utility>
@@ -44,6 +45,11 @@ namespace hpx { namespace threads
 {
     class thread_data;
 
+    namespace policies { namespace detail
+    {
+        class thread_registry;
+    }}
+
     namespace detail
     {
         ///////////////////////////////////////////////////////////////////////
@@ -90,9 +96,15 @@ namespace hpx { namespace threads
         // Avoid warning about using 'this' in initializer list
         thread_data* this_() { return this; }
 
+        // the registry of the owning queue manages the intrusive hooks
+        friend class policies::detail::thread_registry;
+
     public:
         typedef thread_function_type function_type;
 
+        // the type of the worker numbers stored in a thread_schedule_hint
+        typedef decltype(thread_schedule_hint::hint) schedule_hint_type;
+
         struct tag {};
         typedef util::spinlock_pool<tag> mutex_type;
 
@@ -446,6 +458,41 @@ namespace hpx { namespace threads
             priority_ = priority;
         }
 
+        // Return the absolute deadline of this thread (as measured by
+        // util::high_resolution_clock), zero if it has none.
+        std::uint64_t get_deadline() const
+        {
+            return deadline_;
+        }
+
+        // Return the (pool-local) number of the worker thread which executed
+        // this thread most recently, -1 if it has not run yet or if the
+        // number can't be represented in a thread_schedule_hint.
+        schedule_hint_type get_last_worker_num() const
+        {
+            return last_worker_num_;
+        }
+        void set_last_worker_num(std::size_t num_thread)
+        {
+            if (num_thread > std::size_t(
+                    (std::numeric_limits<schedule_hint_type>::max)()))
+            {
+                last_worker_num_ = -1;
+                return;
+            }
+            last_worker_num_ = static_cast<schedule_hint_type>(num_thread);
+        }
+
+        // Return a hint which schedules work related to this thread onto the
+        // worker thread it ran on most recently.
+        thread_schedule_hint get_affinity_hint() const
+        {
+            if (last_worker_num_ < 0)
+                return thread_schedule_hint();
+            return thread_schedule_hint(
+                thread_schedule_hint_mode_affinity, last_worker_num_);
+        }
+
         // handle thread interruption
         bool interruption_requested() const
         {
@@ -590,6 +637,8 @@ namespace hpx { namespace threads
             backtrace_(nullptr),
 #endif
             priority_(init_data.priority),
+            deadline_(init_data.deadline),
+            last_worker_num_(-1),
             requested_interrupt_(false),
             enabled_interrupt_(true),
             ran_exit_funcs_(false),
@@ -597,7 +646,9 @@ namespace hpx { namespace threads
             stacksize_(init_data.stacksize),
             coroutine_(std::move(init_data.func),
                 thread_id_type(this_()), init_data.stacksize),
-            queue_(queue)
+            queue_(queue),
+            registry_prev_(nullptr),
+            registry_next_(nullptr)
         {
             LTM_(debug) << "thread::thread(" << this << "), description("
                         << get_description() << ")";
@@ -649,6 +700,8 @@ namespace hpx { namespace threads
             backtrace_ = nullptr;
 #endif
             priority_ = init_data.priority;
+            deadline_ = init_data.deadline;
+            last_worker_num_ = -1;
             requested_interrupt_ = false;
             enabled_interrupt_ = true;
             ran_exit_funcs_ = false;
@@ -712,6 +765,8 @@ namespace hpx { namespace threads
 
         ///////////////////////////////////////////////////////////////////////
         thread_priority priority_;
+        std::uint64_t deadline_;
+        schedule_hint_type last_worker_num_;
 
         bool requested_interrupt_;
         bool enabled_interrupt_;
@@ -728,6 +783,11 @@ namespace hpx { namespace threads
 
         coroutine_type coroutine_;
         void* queue_;
+
+        // intrusive hooks linking all threads owned by queue_ (these are
+        // protected by the mutex of the queue)
+        thread_data* registry_prev_;
+        thread_data* registry_next_;
     };
 }}
 
@@ -100,6 +100,18 @@ namespace hpx { namespace threads
     /// current thread (or zero if the current thread is not a HPX thread).
     HPX_API_EXPORT std::size_t get_self_stacksize();
 
+    /// The function \a get_self_affinity_hint returns a scheduling hint which
+    /// places new work onto the worker thread the current thread is running
+    /// on, as long as that worker thread is not overloaded (or an empty hint
+    /// if the current thread is not a HPX thread).
+    HPX_API_EXPORT thread_schedule_hint get_self_affinity_hint();
+
+    /// The function \a get_self_default_affinity_hint returns the hint
+    /// returned by \a get_self_affinity_hint if affinity hints are enabled
+    /// for the scheduler running the current thread (see
+    /// hpx.scheduler.affinity_hints), and an empty hint otherwise.
+    HPX_API_EXPORT thread_schedule_hint get_self_default_affinity_hint();
+
     /// The function \a get_parent_locality_id returns the id of the locality of
     /// the current thread's parent (or zero if the current thread is not a
     /// HPX thread).
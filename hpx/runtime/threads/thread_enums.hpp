@@ -134,6 +134,10 @@ namespace hpx { namespace threads
         thread_stacksize_huge = 4,          ///< use very large stack size
 
         thread_stacksize_current = 5,      ///< use size of current thread's stack
+        thread_stacksize_nostack = 6,      ///< run to completion on the stack
+                                           ///< of the worker thread, threads
+                                           ///< created with this 'stack size'
+                                           ///< can't be suspended
 
         thread_stacksize_default = thread_stacksize_small,  ///< use default stack size
         thread_stacksize_minimal = thread_stacksize_small,  ///< use minimally stack size
@@ -153,6 +157,8 @@ namespace hpx { namespace threads
         thread_schedule_hint_mode_none = 0,
         thread_schedule_hint_mode_thread = 1,
         thread_schedule_hint_mode_numa = 2,
+        thread_schedule_hint_mode_affinity = 3,  ///< prefer the given worker
+                                                 ///< unless it is overloaded
     };
 
     ///////////////////////////////////////////////////////////////////////////
@@ -47,6 +47,7 @@ namespace hpx { namespace threads
             priority(thread_priority_normal),
             schedulehint(),
             stacksize(get_default_stack_size()),
+            deadline(0),
             scheduler_base(nullptr)
         {}
 
@@ -70,6 +71,7 @@ namespace hpx { namespace threads
             priority(rhs.priority),
             schedulehint(rhs.schedulehint),
             stacksize(rhs.stacksize),
+            deadline(rhs.deadline),
             scheduler_base(rhs.scheduler_base)
         {
             if (stacksize == 0)
@@ -101,6 +103,7 @@ namespace hpx { namespace threads
             priority(priority_), schedulehint(os_thread),
             stacksize(stacksize_ == std::ptrdiff_t(-1) ?
                 get_default_stack_size() : stacksize_),
+            deadline(0),
             scheduler_base(scheduler_base_)
         {
             if (stacksize == 0)
@@ -130,6 +133,11 @@ namespace hpx { namespace threads
         thread_schedule_hint schedulehint;
         std::ptrdiff_t stacksize;
 
+        // absolute point in time (as returned by
+        // util::high_resolution_clock::now()) this thread should have been
+        // run at, zero if the thread has no deadline
+        std::uint64_t deadline;
+
         policies::scheduler_base* scheduler_base;
     };
 }}
@@ -269,6 +269,8 @@ namespace hpx { namespace threads
 
         virtual std::int64_t get_num_stolen_from_pending(
             std::size_t /*thread_num*/, bool /*reset*/) { return 0; }
+        virtual std::int64_t get_num_stolen_from_pending_batches(
+            std::size_t /*thread_num*/, bool /*reset*/) { return 0; }
         virtual std::int64_t get_num_stolen_to_pending(
             std::size_t /*thread_num*/, bool /*reset*/) { return 0; }
         virtual std::int64_t get_num_stolen_from_staged(
@@ -277,6 +279,26 @@ namespace hpx { namespace threads
             std::size_t /*thread_num*/, bool /*reset*/) { return 0; }
 #endif
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        virtual std::int64_t get_idle_park_count(
+            std::size_t /*thread_num*/, bool /*reset*/) { return 0; }
+        virtual std::int64_t get_idle_wakeup_count(
+            std::size_t /*thread_num*/, bool /*reset*/) { return 0; }
+        virtual std::int64_t get_average_idle_wake_latency(
+            std::size_t /*thread_num*/, bool /*reset*/) { return 0; }
+#endif
+
+        virtual std::int64_t get_thread_cache_hits(
+            std::size_t /*thread_num*/, bool /*reset*/) { return 0; }
+        virtual std::int64_t get_thread_cache_misses(
+            std::size_t /*thread_num*/, bool /*reset*/) { return 0; }
+        virtual std::int64_t get_num_deadline_misses(
+            std::size_t /*thread_num*/, bool /*reset*/) { return 0; }
+        virtual std::int64_t get_affinity_hits(
+            std::size_t /*thread_num*/, bool /*reset*/) { return 0; }
+        virtual std::int64_t get_affinity_misses(
+            std::size_t /*thread_num*/, bool /*reset*/) { return 0; }
+
         virtual std::int64_t get_thread_count(thread_state_enum /*state*/,
             thread_priority /*priority*/, std::size_t /*num_thread*/,
             bool /*reset*/) { return 0; }
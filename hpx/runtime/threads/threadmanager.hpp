@@ -409,11 +409,24 @@ namespace hpx { namespace threads
         std::int64_t get_num_pending_misses(bool reset);
         std::int64_t get_num_pending_accesses(bool reset);
         std::int64_t get_num_stolen_from_pending(bool reset);
+        std::int64_t get_num_stolen_from_pending_batches(bool reset);
         std::int64_t get_num_stolen_from_staged(bool reset);
         std::int64_t get_num_stolen_to_pending(bool reset);
         std::int64_t get_num_stolen_to_staged(bool reset);
 #endif
 
+        std::int64_t get_thread_cache_hits(bool reset);
+        std::int64_t get_thread_cache_misses(bool reset);
+        std::int64_t get_num_deadline_misses(bool reset);
+        std::int64_t get_affinity_hits(bool reset);
+        std::int64_t get_affinity_misses(bool reset);
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        std::int64_t get_idle_park_count(bool reset);
+        std::int64_t get_idle_wakeup_count(bool reset);
+        std::int64_t get_average_idle_wake_latency(bool reset);
+#endif
+
 private:
         mutable mutex_type mtx_; // mutex protecting the members
 
@@ -168,6 +168,19 @@ namespace hpx { namespace threads
         mask_cref_type get_core_affinity_mask(std::size_t num_thread,
             error_code& ec = throws) const;
 
+        /// \brief Return a bit mask where each set bit corresponds to a
+        ///        processing unit sharing the cache of the given level (2 or
+        ///        3) with the processing unit the given thread is running on.
+        ///        If no such cache exists, this returns the core affinity
+        ///        mask (for level 2) or the NUMA domain affinity mask (for
+        ///        level 3).
+        ///
+        /// \param ec         [in,out] this represents the error status on exit,
+        ///                   if this is pre-initialized to \a hpx#throws
+        ///                   the function will throw on error instead.
+        mask_cref_type get_cache_affinity_mask(std::size_t num_thread,
+            std::size_t level, error_code& ec = throws) const;
+
         /// \brief Return a bit mask where each set bit corresponds to a
         ///        processing unit available to the given thread.
         ///
@@ -293,6 +306,10 @@ namespace hpx { namespace threads
         mask_type init_core_affinity_mask_from_core(
             std::size_t num_core, mask_cref_type default_mask = mask_type()
             ) const;
+        mask_type init_cache_affinity_mask(
+            std::size_t num_thread, std::size_t level,
+            mask_cref_type default_mask = mask_type()
+            ) const;
         mask_type init_thread_affinity_mask(std::size_t num_thread) const;
         mask_type init_thread_affinity_mask(
             std::size_t num_core
@@ -387,6 +404,8 @@ namespace hpx { namespace threads
         std::vector<mask_type> socket_affinity_masks_;
         std::vector<mask_type> numa_node_affinity_masks_;
         std::vector<mask_type> core_affinity_masks_;
+        std::vector<mask_type> l2_cache_affinity_masks_;
+        std::vector<mask_type> l3_cache_affinity_masks_;
         std::vector<mask_type> thread_affinity_masks_;
 
         struct tls_tag {};
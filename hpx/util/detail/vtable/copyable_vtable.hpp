@@ -22,7 +22,7 @@ namespace hpx { namespace util { namespace detail
             {
                 new (v) T(vtable::get<T>(src));
             } else {
-                *v = new T(vtable::get<T>(src));
+                *v = vtable::heap_construct<T>(vtable::get<T>(src));
             }
         }
         void (*copy)(void**, void* const*);
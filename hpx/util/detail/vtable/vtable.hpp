@@ -9,6 +9,7 @@
 #define HPX_UTIL_DETAIL_VTABLE_VTABLE_HPP
 
 #include <hpx/config.hpp>
+#include <hpx/util/pooled_allocator.hpp>
 
 #include <cstddef>
 #include <memory>
@@ -68,6 +69,47 @@ namespace hpx { namespace util { namespace detail
             }
         }
 
+        // Function objects which don't fit into the embedded storage are
+        // allocated from the per-worker pools (see pooled_allocator).
+        template <typename T, typename ... Ts>
+        static T* heap_construct_impl(std::true_type, Ts&&... ts)
+        {
+            void* p = pooled_allocate(sizeof(T));
+            try {
+                return ::new (p) T(std::forward<Ts>(ts)...);
+            }
+            catch (...) {
+                pooled_deallocate(p, sizeof(T));
+                throw;
+            }
+        }
+
+        template <typename T, typename ... Ts>
+        static T* heap_construct_impl(std::false_type, Ts&&... ts)
+        {
+            return new T(std::forward<Ts>(ts)...);
+        }
+
+        template <typename T, typename ... Ts>
+        HPX_FORCEINLINE static T* heap_construct(Ts&&... ts)
+        {
+            return heap_construct_impl<T>(is_pool_allocatable<T>(),
+                std::forward<Ts>(ts)...);
+        }
+
+        template <typename T>
+        static void heap_delete(T* p, std::true_type)
+        {
+            p->~T();
+            pooled_deallocate(p, sizeof(T));
+        }
+
+        template <typename T>
+        static void heap_delete(T* p, std::false_type)
+        {
+            delete p;
+        }
+
         template <typename T>
         HPX_FORCEINLINE static void default_construct(void** v)
         {
@@ -75,7 +117,7 @@ namespace hpx { namespace util { namespace detail
             {
                 ::new (static_cast<void*>(v)) T; //-V206
             } else {
-                *v = new T;
+                *v = heap_construct<T>();
             }
         }
 
@@ -86,7 +128,7 @@ namespace hpx { namespace util { namespace detail
             {
                 ::new (static_cast<void*>(v)) T(std::forward<Arg>(arg)); //-V206
             } else {
-                *v = new T(std::forward<Arg>(arg));
+                *v = heap_construct<T>(std::forward<Arg>(arg));
             }
         }
 
@@ -118,7 +160,7 @@ namespace hpx { namespace util { namespace detail
             {
                 _destruct<T>(v);
             } else {
-                delete &get<T>(v);
+                heap_delete(&get<T>(v), is_pool_allocatable<T>());
             }
         }
         void (*delete_)(void**);
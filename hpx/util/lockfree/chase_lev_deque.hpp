@@ -0,0 +1,210 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Algorithms from "Dynamic Circular Work-Stealing Deque"
+//  by D. Chase and Y. Lev
+//  Link: http://dl.acm.org/citation.cfm?id=1073974
+//
+//  Memory orderings as given in "Correct and Efficient Work-Stealing for Weak
+//  Memory Models" by N. M. Le, A. Pop, A. Cohen and F. Zappa Nardelli
+//  Link: http://dl.acm.org/citation.cfm?id=2442524
+//
+//  C++ implementation - Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//  Disclaimer: Not a Boost library.
+//
+//  The deque has exactly one owner which is allowed to call push() and pop().
+//  Any other thread may only call steal(). Neither push() nor pop() perform an
+//  atomic read-modify-write operation, except when pop() races with a thief for
+//  the very last element in the deque. Only thieves contend with each other.
+////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(HPX_UTIL_LOCKFREE_CHASE_LEV_DEQUE_HPP)
+#define HPX_UTIL_LOCKFREE_CHASE_LEV_DEQUE_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/util/assert.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace boost { namespace lockfree
+{
+
+// The "top" and "bottom" terminology is used to stay consistent with the
+// papers this code is based on. The owner works on the bottom end of the
+// deque, thieves remove elements from its top.
+template <typename T>
+struct chase_lev_deque
+{
+private:
+    static_assert(std::is_trivially_copyable<T>::value,
+        "chase_lev_deque requires trivially copyable elements");
+
+    HPX_NON_COPYABLE(chase_lev_deque);
+
+    typedef std::int64_t index_type;
+
+    // circular array holding the elements, its size is always a power of 2
+    struct circular_array
+    {
+        explicit circular_array(std::size_t size)
+          : mask_(size - 1), data_(new std::atomic<T>[size])
+        {
+            HPX_ASSERT(size != 0 && (size & mask_) == 0);
+        }
+
+        std::size_t size() const
+        {
+            return mask_ + 1;
+        }
+
+        T get(index_type i) const
+        {
+            return data_[std::size_t(i) & mask_].load(std::memory_order_relaxed);
+        }
+
+        void put(index_type i, T const& val)
+        {
+            data_[std::size_t(i) & mask_].store(val, std::memory_order_relaxed);
+        }
+
+        circular_array* grow(index_type bottom, index_type top) const
+        {
+            circular_array* a = new circular_array(2 * size());
+            for (index_type i = top; i != bottom; ++i)
+                a->put(i, get(i));
+            return a;
+        }
+
+        std::size_t const mask_;
+        std::unique_ptr<std::atomic<T>[]> data_;
+    };
+
+    static std::size_t round_up_to_power_of_2(std::size_t size)
+    {
+        std::size_t result = 2;
+        while (result < size)
+            result <<= 1;
+        return result;
+    }
+
+public:
+    typedef T value_type;
+
+    explicit chase_lev_deque(std::size_t initial_size = 128)
+      : top_(0), bottom_(0),
+        array_(new circular_array(round_up_to_power_of_2(initial_size)))
+    {}
+
+    ~chase_lev_deque()
+    {
+        delete array_.load(std::memory_order_relaxed);
+    }
+
+    // Add an element to the bottom of the deque, may be called by the owner
+    // only.
+    void push(T const& val)
+    {
+        index_type b = bottom_.load(std::memory_order_relaxed);
+        index_type t = top_.load(std::memory_order_acquire);
+        circular_array* a = array_.load(std::memory_order_relaxed);
+
+        if (b - t > index_type(a->size()) - 1)
+        {
+            // The old array may still be accessed by concurrent thieves, we
+            // keep it alive until the deque is destroyed.
+            circular_array* new_a = a->grow(b, t);
+            retired_.emplace_back(a);
+            array_.store(new_a, std::memory_order_release);
+            a = new_a;
+        }
+
+        a->put(b, val);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom_.store(b + 1, std::memory_order_relaxed);
+    }
+
+    // Remove an element from the bottom of the deque, may be called by the
+    // owner only.
+    bool pop(T& val)
+    {
+        index_type b = bottom_.load(std::memory_order_relaxed) - 1;
+        circular_array* a = array_.load(std::memory_order_relaxed);
+        bottom_.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        index_type t = top_.load(std::memory_order_relaxed);
+
+        if (t > b)
+        {
+            // the deque was empty
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        val = a->get(b);
+        if (t == b)
+        {
+            // this is the last element, we have to compete with thieves
+            bool result = top_.compare_exchange_strong(t, t + 1,
+                std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            return result;
+        }
+        return true;
+    }
+
+    // Remove an element from the top of the deque, may be called by any
+    // thread.
+    bool steal(T& val)
+    {
+        index_type t = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        index_type b = bottom_.load(std::memory_order_acquire);
+
+        if (t >= b)
+            return false;       // the deque is empty
+
+        circular_array* a = array_.load(std::memory_order_acquire);
+        val = a->get(t);
+
+        // fails if we lost the race against the owner or another thief
+        return top_.compare_exchange_strong(t, t + 1,
+            std::memory_order_seq_cst, std::memory_order_relaxed);
+    }
+
+    bool empty() const
+    {
+        index_type b = bottom_.load(std::memory_order_relaxed);
+        index_type t = top_.load(std::memory_order_relaxed);
+        return b <= t;
+    }
+
+    std::size_t size() const
+    {
+        index_type b = bottom_.load(std::memory_order_relaxed);
+        index_type t = top_.load(std::memory_order_relaxed);
+        return b > t ? std::size_t(b - t) : 0;
+    }
+
+private:
+    // top_ is modified by thieves, bottom_ by the owner only, keep them on
+    // separate cache lines
+    std::atomic<index_type> top_;
+    char pad0_[64 - sizeof(std::atomic<index_type>)];
+    std::atomic<index_type> bottom_;
+    char pad1_[64 - sizeof(std::atomic<index_type>)];
+    std::atomic<circular_array*> array_;
+
+    // arrays replaced during growing, accessed by the owner only
+    std::vector<std::unique_ptr<circular_array> > retired_;
+};
+
+}}
+
+#endif
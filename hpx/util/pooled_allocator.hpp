@@ -0,0 +1,158 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_UTIL_POOLED_ALLOCATOR_HPP)
+#define HPX_UTIL_POOLED_ALLOCATOR_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/util/internal_allocator.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace util
+{
+    namespace detail
+    {
+#if defined(HPX_HAVE_POOLED_ALLOCATOR)
+        // Allocate memory blocks from a pool which is private to the calling
+        // (OS-) thread. Blocks are grouped into size classes, blocks which
+        // are larger than the largest size class are directly allocated
+        // using the internal allocator. Blocks may be released by a thread
+        // different from the one which allocated them.
+        HPX_EXPORT void* pooled_allocate(std::size_t size);
+        HPX_EXPORT void pooled_deallocate(void* p, std::size_t size) noexcept;
+#else
+        inline void* pooled_allocate(std::size_t size)
+        {
+            return internal_allocator<char>().allocate(size);
+        }
+        inline void pooled_deallocate(void* p, std::size_t size) noexcept
+        {
+            internal_allocator<char>().deallocate(static_cast<char*>(p), size);
+        }
+#endif
+
+        // Blocks handed out by pooled_allocate are suitably aligned for
+        // objects with fundamental alignment requirements only.
+        template <typename T>
+        struct is_pool_allocatable
+          : std::integral_constant<bool,
+                std::alignment_of<T>::value <=
+                    std::alignment_of<std::max_align_t>::value>
+        {};
+    }
+
+#if defined(HPX_HAVE_POOLED_ALLOCATOR)
+    /// Return the number of allocations which were served from the per-worker
+    /// pools (or which had to fall back to the internal allocator).
+    HPX_EXPORT std::int64_t get_pooled_allocation_count(bool reset);
+    HPX_EXPORT std::int64_t get_pooled_allocation_misses(bool reset);
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    // An allocator which uses per-worker size-class pools for its memory.
+    // This is used for the shared states of futures and continuations.
+    template <typename T = int>
+    struct pooled_allocator
+    {
+        typedef T value_type;
+        typedef T* pointer;
+        typedef const T* const_pointer;
+        typedef T& reference;
+        typedef T const& const_reference;
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+
+        template <typename U>
+        struct rebind
+        {
+            typedef pooled_allocator<U> other;
+        };
+
+        typedef std::true_type is_always_equal;
+        typedef std::true_type propagate_on_container_move_assignment;
+
+        pooled_allocator() = default;
+
+        template <typename U>
+        pooled_allocator(pooled_allocator<U> const&) noexcept
+        {
+        }
+
+        pointer allocate(size_type n)
+        {
+            return allocate(n, detail::is_pool_allocatable<T>());
+        }
+
+        void deallocate(pointer p, size_type n) noexcept
+        {
+            deallocate(p, n, detail::is_pool_allocatable<T>());
+        }
+
+        size_type max_size() const noexcept
+        {
+            return (std::numeric_limits<size_type>::max)() / sizeof(T);
+        }
+
+        template <typename U, typename ... Args>
+        void construct(U* p, Args &&... args)
+        {
+            ::new((void *)p) U(std::forward<Args>(args)...);
+        }
+
+        template <typename U>
+        void destroy(U* p)
+        {
+            p->~U();
+        }
+
+    private:
+        // over-aligned types are not handled by the pools
+        pointer allocate(size_type n, std::true_type)
+        {
+            return static_cast<pointer>(
+                detail::pooled_allocate(n * sizeof(T)));
+        }
+        pointer allocate(size_type n, std::false_type)
+        {
+            return internal_allocator<T>().allocate(n);
+        }
+
+        void deallocate(pointer p, size_type n, std::true_type) noexcept
+        {
+            detail::pooled_deallocate(p, n * sizeof(T));
+        }
+        void deallocate(pointer p, size_type n, std::false_type) noexcept
+        {
+            internal_allocator<T>().deallocate(p, n);
+        }
+    };
+
+    template <typename T, typename U>
+    HPX_CONSTEXPR
+    bool operator==(pooled_allocator<T> const&, pooled_allocator<U> const&)
+    {
+        return true;
+    }
+
+    template <typename T, typename U>
+    HPX_CONSTEXPR
+    bool operator!=(pooled_allocator<T> const&, pooled_allocator<U> const&)
+    {
+        return false;
+    }
+}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
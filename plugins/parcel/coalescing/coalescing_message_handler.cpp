@@ -24,9 +24,12 @@
 #include <boost/lexical_cast.hpp>
 #include <boost/accumulators/accumulators.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <map>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <utility>
@@ -42,7 +45,12 @@ namespace hpx { namespace traits
     //      ...
     //      num_messages = 50
     //      interval = 100
+    //      adaptive = 0
     //
+    // If adaptive is set, interval is the latency budget (in microseconds)
+    // for delivering a parcel instead of a fixed coalescing window, and
+    // parcels of different actions sent to the same destination are
+    // coalesced into the same messages.
     template <>
     struct plugin_config_data<hpx::plugins::parcel::coalescing_message_handler>
     {
@@ -50,7 +58,8 @@ namespace hpx { namespace traits
         {
             return "num_messages = 50\n"
                    "interval = 100\n"
-                   "allow_background_flush = 1";
+                   "allow_background_flush = 1\n"
+                   "adaptive = 0";
         }
     };
 }}
@@ -86,6 +95,56 @@ namespace hpx { namespace plugins { namespace parcel
                 "1");
             return !value.empty() && value[0] != '0';
         }
+
+        bool get_adaptive()
+        {
+            std::string value = hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.adaptive", "0");
+            return !value.empty() && value[0] != '0';
+        }
+
+        // the buffers of all actions sending to the same destination are
+        // shared in adaptive mode
+        std::shared_ptr<destination_buffer> get_destination_buffer(
+            parcelset::locality const& dest, std::size_t max_messages)
+        {
+            typedef lcos::local::spinlock mutex_type;
+
+            static mutex_type mtx;
+            static std::map<
+                    parcelset::locality, std::weak_ptr<destination_buffer>
+                > buffers;
+
+            std::lock_guard<mutex_type> l(mtx);
+
+            auto it = buffers.find(dest);
+            if (it != buffers.end())
+            {
+                std::shared_ptr<destination_buffer> buffer = it->second.lock();
+                if (buffer)
+                    return buffer;
+            }
+
+            // drop the entries of the destinations nobody sends to anymore
+            for (it = buffers.begin(); it != buffers.end(); /**/)
+            {
+                if (it->second.expired())
+                    it = buffers.erase(it);
+                else
+                    ++it;
+            }
+
+            std::shared_ptr<destination_buffer> buffer =
+                std::make_shared<destination_buffer>(max_messages);
+            buffers[dest] = buffer;
+            return buffer;
+        }
+
+        // exponential moving average giving new samples a weight of 1/8
+        std::int64_t moving_average(std::int64_t average, std::int64_t sample)
+        {
+            return average + (sample - average) / 8;
+        }
     }
 
     void coalescing_message_handler::update_num_messages()
@@ -99,6 +158,26 @@ namespace hpx { namespace plugins { namespace parcel
     {
         std::lock_guard<mutex_type> l(mtx_);
         interval_ = detail::get_interval(interval_);
+        update_window();
+    }
+
+    // Leave the part of the latency budget not needed for sending the
+    // message for coalescing, but never less than a quarter of it.
+    void coalescing_message_handler::update_window()
+    {
+        std::int64_t budget = std::int64_t(interval_) * 1000;
+        window_ = (std::max)(budget - send_overhead_, budget / 4);
+    }
+
+    void coalescing_message_handler::update_send_overhead(
+        std::int64_t flushed_at)
+    {
+        std::int64_t now = util::high_resolution_clock::now();
+
+        std::lock_guard<mutex_type> l(mtx_);
+        send_overhead_ =
+            detail::moving_average(send_overhead_, now - flushed_at);
+        update_window();
     }
 
     coalescing_message_handler::coalescing_message_handler(
@@ -107,7 +186,6 @@ namespace hpx { namespace plugins { namespace parcel
       : pp_(pp),
         num_coalesced_parcels_(detail::get_num_messages(num)),
         interval_(detail::get_interval(interval)),
-        buffer_(num_coalesced_parcels_),
         timer_(
             util::bind_back(&coalescing_message_handler::timer_flush, this_()),
             util::bind_back(&coalescing_message_handler::flush_terminate, this_()),
@@ -115,6 +193,9 @@ namespace hpx { namespace plugins { namespace parcel
         stopped_(false),
         allow_background_flush_(detail::get_background_flush()),
         action_name_(action_name),
+        adaptive_(detail::get_adaptive()),
+        window_(0),
+        send_overhead_(0),
         num_parcels_(0), reset_num_parcels_(0),
             reset_num_parcels_per_message_parcels_(0),
         num_messages_(0), reset_num_messages_(0),
@@ -126,6 +207,14 @@ namespace hpx { namespace plugins { namespace parcel
         histogram_max_boundary_(-1),
         histogram_num_buckets_(-1)
     {
+        // the destination is known only once the first parcel is sent
+        if (!adaptive_)
+        {
+            buffer_ = std::make_shared<detail::destination_buffer>(
+                num_coalesced_parcels_);
+        }
+        update_window();
+
         // register performance counter functions
         coalescing_counter_registry::instance().register_action(action_name,
             util::bind_front(&coalescing_message_handler::get_parcels_count, this),
@@ -162,16 +251,54 @@ namespace hpx { namespace plugins { namespace parcel
         if (time_between_parcels_)
             (*time_between_parcels_)(time_since_last_parcel);
 
-        std::chrono::microseconds interval(interval_);
+        if (!buffer_)
+            buffer_ = detail::get_destination_buffer(dest, num_coalesced_parcels_);
+
+        // the buffer is shared with the handlers of other actions only in
+        // adaptive mode, otherwise it is protected by mtx_ already
+        std::unique_lock<mutex_type> bl(buffer_->mtx_, std::defer_lock);
+        if (adaptive_)
+            bl.lock();
 
-        // just send parcel if the coalescing was stopped or the buffer is
-        // empty and time since last parcel is larger than coalescing interval.
-        if (stopped_ ||
-            (buffer_.empty() &&
-                std::chrono::nanoseconds(time_since_last_parcel) > interval
-           ))
+        std::chrono::nanoseconds interval = std::chrono::microseconds(interval_);
+        bool send_now = stopped_;
+        if (adaptive_)
+        {
+            // Parcels are buffered only if the next parcel for this
+            // destination is expected to arrive within the window. Long
+            // pauses are capped to not stall the adaption once traffic
+            // picks up again.
+            detail::destination_buffer& b = *buffer_;
+            if (b.last_parcel_time_ != 0)
+            {
+                std::int64_t sample = (std::min)(
+                    parcel_time - b.last_parcel_time_, 2 * window_);
+                b.time_between_parcels_ = b.time_between_parcels_ < 0 ?
+                    sample :
+                    detail::moving_average(b.time_between_parcels_, sample);
+            }
+            b.last_parcel_time_ = parcel_time;
+
+            interval = std::chrono::nanoseconds(window_);
+            send_now = send_now || (b.buffer_.empty() &&
+                (b.time_between_parcels_ < 0 ||
+                    b.time_between_parcels_ >= window_));
+        }
+        else
+        {
+            // just send parcel if the buffer is empty and time since last
+            // parcel is larger than coalescing interval.
+            send_now = send_now || (buffer_->buffer_.empty() &&
+                std::chrono::nanoseconds(time_since_last_parcel) > interval);
+        }
+
+        // just send parcel if the coalescing was stopped or if waiting for
+        // more parcels does not pay off
+        if (send_now)
         {
             ++num_messages_;
+            if (bl.owns_lock())
+                bl.unlock();
             l.unlock();
 
             // this instance should not buffer parcels anymore
@@ -180,7 +307,22 @@ namespace hpx { namespace plugins { namespace parcel
         }
 
         detail::message_buffer::message_buffer_append_state s =
-            buffer_.append(dest, std::move(p), std::move(f));
+            buffer_->buffer_.append(dest, std::move(p), std::move(f));
+
+        if (s == detail::message_buffer::first_message)
+            buffer_->opened_at_ = parcel_time;
+
+        // don't wait for the next parcel if it is not expected to arrive
+        // before the window closes
+        if (adaptive_ && s != detail::message_buffer::buffer_now_full &&
+            parcel_time - buffer_->opened_at_ +
+                buffer_->time_between_parcels_ > window_)
+        {
+            s = detail::message_buffer::buffer_now_full;
+        }
+
+        if (bl.owns_lock())
+            bl.unlock();
 
         switch(s) {
         case detail::message_buffer::first_message:
@@ -190,7 +332,8 @@ namespace hpx { namespace plugins { namespace parcel
             break;
 
         case detail::message_buffer::normal:
-            // start deadline timer to flush buffer
+            // start deadline timer to flush buffer, the timer is already
+            // running if this instance has started the buffer
             l.unlock();
             timer_.start(interval);
             break;
@@ -214,12 +357,9 @@ namespace hpx { namespace plugins { namespace parcel
     {
         // adjust timer if needed
         std::unique_lock<mutex_type> l(mtx_);
-        if (!buffer_.empty())
-        {
-            flush_locked(l,
-                parcelset::policies::message_handler::flush_mode_timer,
-                false, false);
-        }
+        flush_locked(l,
+            parcelset::policies::message_handler::flush_mode_timer,
+            false, false);
 
         // do not restart timer for now, will be restarted on next parcel
         return false;
@@ -268,13 +408,31 @@ namespace hpx { namespace plugins { namespace parcel
             timer_.stop();              // interrupt timer
         }
 
-        if (buffer_.empty())
+        if (!buffer_)
             return false;
 
         detail::message_buffer buff (num_coalesced_parcels_);
-        std::swap(buff, buffer_);
+        {
+            std::unique_lock<mutex_type> bl(buffer_->mtx_, std::defer_lock);
+            if (adaptive_)
+                bl.lock();
+
+            if (buffer_->buffer_.empty())
+                return false;
+
+            std::swap(buff, buffer_->buffer_);
+        }
 
         ++num_messages_;
+
+        // measure the time it takes to send the message
+        if (adaptive_)
+        {
+            buff.on_first_sent(util::bind(
+                &coalescing_message_handler::update_send_overhead, this,
+                util::high_resolution_clock::now()));
+        }
+
         l.unlock();
 
         HPX_ASSERT(nullptr != pp_);
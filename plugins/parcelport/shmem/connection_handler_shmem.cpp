@@ -0,0 +1,294 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/plugins/parcelport/shmem/connection_handler.hpp>
+#include <hpx/plugins/parcelport/shmem/inbox.hpp>
+#include <hpx/plugins/parcelport/shmem/locality.hpp>
+#include <hpx/plugins/parcelport/shmem/receiver.hpp>
+#include <hpx/plugins/parcelport/shmem/sender.hpp>
+#include <hpx/runtime/parcelset/locality.hpp>
+#include <hpx/runtime/threads/thread_helpers.hpp>
+#include <hpx/throw_exception.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/bind.hpp>
+#include <hpx/util/detail/yield_k.hpp>
+#include <hpx/util/runtime_configuration.hpp>
+#include <hpx/util/safe_lexical_cast.hpp>
+
+#include <boost/asio/ip/host_name.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <unistd.h>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    std::uint64_t next_segment_id(sender * s)
+    {
+        return s->next_segment_id();
+    }
+
+    void add_connection(sender * s, std::shared_ptr<sender_connection> const& ptr)
+    {
+        s->add(ptr);
+    }
+
+    namespace
+    {
+        // number of idle rounds before the I/O thread goes to sleep
+        std::size_t const spin_count = 64;
+
+        // senders ring the doorbell, this only bounds the time it takes
+        // to notice that the parcelport has been stopped
+        std::chrono::milliseconds const max_sleep(10);
+
+        // the inbox of a locality might not have been created yet, it is
+        // looked up again after this time
+        std::chrono::milliseconds const open_retry_interval(100);
+
+        // stopping the parcelport gives up on the pending messages once no
+        // destination has consumed anything from its ring for this long
+        std::chrono::seconds const max_stall(5);
+
+        std::int32_t this_pid()
+        {
+            return static_cast<std::int32_t>(::getpid());
+        }
+
+        parcelset::locality parcelport_address()
+        {
+            return parcelset::locality(
+                locality(boost::asio::ip::host_name(), this_pid()));
+        }
+    }
+
+    connection_handler::connection_handler(
+        util::runtime_configuration const& ini,
+        util::function_nonser<void(std::size_t, char const*)> const&
+            on_start_thread,
+        util::function_nonser<void(std::size_t, char const*)> const&
+            on_stop_thread)
+      : base_type(ini, parcelport_address(), on_start_thread, on_stop_thread)
+      , num_slots_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel.shmem.num_slots", std::size_t(64)))
+      , ring_size_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel.shmem.ring_size", std::size_t(262144)))
+      , zero_copy_threshold_(hpx::util::get_entry_as<std::uint64_t>(
+            ini, "hpx.parcel.shmem.zero_copy_threshold", std::uint64_t(65536)))
+      , running_(false)
+      , receiver_(*this, inbox_)
+    {
+        if (here_.type() != std::string("shmem")) {
+            HPX_THROW_EXCEPTION(network_error, "shmem::parcelport::parcelport",
+                "this parcelport was instantiated to represent an unexpected "
+                "locality type: " + std::string(here_.type()));
+        }
+
+        if (num_slots_ == 0 || ring_size_ == 0) {
+            HPX_THROW_EXCEPTION(bad_parameter, "shmem::parcelport::parcelport",
+                "hpx.parcel.shmem.num_slots and hpx.parcel.shmem.ring_size "
+                "have to be non-zero");
+        }
+
+        // a threshold of zero disables handing over chunks in segments
+        if (zero_copy_threshold_ == 0)
+            zero_copy_threshold_ = (std::numeric_limits<std::uint64_t>::max)();
+    }
+
+    connection_handler::~connection_handler()
+    {
+        HPX_ASSERT(!running_);
+    }
+
+    bool connection_handler::do_run()
+    {
+        inbox_.create(this_pid(), num_slots_, ring_size_);
+        receiver_.run();
+        running_ = true;
+
+        // The HPX worker threads poll the inbox as part of their background
+        // work. In addition, one I/O thread keeps polling while there is
+        // traffic and sleeps on the doorbell of the inbox otherwise.
+        io_service_pool_.get_io_service(0).post(
+            util::bind(&connection_handler::io_service_work, this));
+
+        return true;
+    }
+
+    void connection_handler::do_stop()
+    {
+        // finish writing the messages still pending, connections to
+        // terminated localities are failed by the sender, messages to
+        // localities which stopped draining their rings are given up on
+        std::chrono::steady_clock::time_point last_progress =
+            std::chrono::steady_clock::now();
+        while (sender_.has_pending())
+        {
+            if (sender_.background_work())
+            {
+                last_progress = std::chrono::steady_clock::now();
+                continue;
+            }
+
+            if (std::chrono::steady_clock::now() - last_progress > max_stall)
+            {
+                sender_.abort_pending(error_code(network_error,
+                    "the destination of the shmem connection did not receive "
+                    "the message before the parcelport was stopped",
+                    lightweight));
+                break;
+            }
+
+            if (threads::get_self_ptr())
+                hpx::this_thread::suspend(hpx::threads::pending,
+                    "shmem::connection_handler::do_stop");
+            else
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        running_ = false;
+        inbox_.notify();
+
+        // no other locality may connect from now on
+        inbox_.unlink();
+    }
+
+    std::string connection_handler::get_locality_name() const
+    {
+        return boost::asio::ip::host_name();
+    }
+
+    bool connection_handler::can_connect(parcelset::locality const& l,
+        bool use_alternative_parcelport)
+    {
+        if (!use_alternative_parcelport || !running_)
+            return false;
+
+        locality const& there = l.get<locality>();
+        return there.host() == here_.get<locality>().host() &&
+            get_inbox(there) != nullptr;
+    }
+
+    std::shared_ptr<sender_connection> connection_handler::create_connection(
+        parcelset::locality const& l, error_code& ec)
+    {
+        std::shared_ptr<inbox> there = get_inbox(l.get<locality>());
+        if (!there)
+        {
+            std::ostringstream strm;
+            strm << "unable to map the inbox of: " << l;
+
+            HPX_THROWS_IF(ec, network_error,
+                "shmem::connection_handler::create_connection", strm.str());
+            return std::shared_ptr<sender_connection>();
+        }
+
+        std::size_t slot = there->connect(this_pid());
+        if (slot == inbox::npos)
+        {
+            std::ostringstream strm;
+            strm << "all slots of the inbox of " << l << " are in use, "
+                    "consider increasing hpx.parcel.shmem.num_slots";
+
+            HPX_THROWS_IF(ec, network_error,
+                "shmem::connection_handler::create_connection", strm.str());
+            return std::shared_ptr<sender_connection>();
+        }
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return std::make_shared<sender_connection>(&sender_, there, slot,
+            this_pid(), zero_copy_threshold_, l, this);
+    }
+
+    parcelset::locality connection_handler::agas_locality(
+        util::runtime_configuration const&) const
+    {
+        // this parcelport is never used for bootstrapping
+        return parcelset::locality(locality());
+    }
+
+    parcelset::locality connection_handler::create_locality() const
+    {
+        return parcelset::locality(locality());
+    }
+
+    bool connection_handler::background_work(std::size_t num_thread)
+    {
+        if (!running_)
+            return false;
+
+        bool has_work = sender_.background_work();
+        has_work = receiver_.background_work(num_thread) || has_work;
+        return has_work;
+    }
+
+    // The inboxes of other localities are mapped once. A locality might
+    // not have created its inbox yet, failures are therefore retried after
+    // a while, those localities are reached through other parcelports in
+    // the meantime.
+    std::shared_ptr<inbox> connection_handler::get_inbox(locality const& l)
+    {
+        std::lock_guard<mutex_type> lk(inboxes_mtx_);
+
+        auto const now = std::chrono::steady_clock::now();
+
+        inbox_entry& entry = inboxes_[l.pid()];
+        if (entry.inbox_ || now < entry.retry_)
+            return entry.inbox_;
+
+        std::shared_ptr<inbox> there = std::make_shared<inbox>();
+        if (there->open(l.pid()))
+            entry.inbox_ = std::move(there);
+        else
+            entry.retry_ = now + open_retry_interval;
+
+        return entry.inbox_;
+    }
+
+    void connection_handler::io_service_work()
+    {
+        std::size_t k = 0;
+        while (running_)
+        {
+            if (background_work(std::size_t(-1)))
+            {
+                k = 0;
+                continue;
+            }
+
+            if (++k < spin_count)
+            {
+                util::detail::yield_k(k,
+                    "hpx::parcelset::policies::shmem::connection_handler::"
+                        "io_service_work");
+                continue;
+            }
+
+            // nothing arrived for a while, sleep until a sender rings the
+            // doorbell
+            std::uint32_t const doorbell = inbox_.prepare_wait();
+            if (!background_work(std::size_t(-1)) && running_)
+                inbox_.wait(doorbell, max_sleep);
+            inbox_.finish_wait();
+
+            k = 0;
+        }
+    }
+}}}}
+
+#endif
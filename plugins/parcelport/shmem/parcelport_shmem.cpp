@@ -0,0 +1,54 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/traits/plugin_config_data.hpp>
+
+#include <hpx/plugins/parcelport/shmem/connection_handler.hpp>
+#include <hpx/plugins/parcelport_factory.hpp>
+
+namespace hpx { namespace traits
+{
+    // Inject additional configuration data into the factory registry for this
+    // type. This information ends up in the system wide configuration database
+    // under the plugin specific section:
+    //
+    //      [hpx.parcel.shmem]
+    //      ...
+    //      priority = 1000
+    //
+    // The shared memory parcelport is preferred over all other parcelports
+    // for localities on the same host.
+    template <>
+    struct plugin_config_data<hpx::parcelset::policies::shmem::connection_handler>
+    {
+        static char const* priority()
+        {
+            return "1000";
+        }
+
+        static void init(int *argc, char ***argv, util::command_line_handling &cfg)
+        {
+        }
+
+        static char const* call()
+        {
+            return
+                "num_slots = ${HPX_PARCEL_SHMEM_NUM_SLOTS:64}\n"
+                "ring_size = ${HPX_PARCEL_SHMEM_RING_SIZE:262144}\n"
+                "zero_copy_threshold = "
+                    "${HPX_PARCEL_SHMEM_ZERO_COPY_THRESHOLD:65536}\n"
+                ;
+        }
+    };
+}}
+
+HPX_REGISTER_PARCELPORT(
+    hpx::parcelset::policies::shmem::connection_handler,
+    shmem);
+
+#endif
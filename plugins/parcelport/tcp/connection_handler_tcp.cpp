@@ -14,6 +14,7 @@
 #include <hpx/exception_list.hpp>
 #include <hpx/lcos/future.hpp>
 #include <hpx/plugins/parcelport/tcp/connection_handler.hpp>
+#include <hpx/plugins/parcelport/tcp/io_uring.hpp>
 #include <hpx/plugins/parcelport/tcp/receiver.hpp>
 #include <hpx/plugins/parcelport/tcp/sender.hpp>
 #include <hpx/runtime/parcelset/locality.hpp>
@@ -21,6 +22,7 @@
 #include <hpx/util/assert.hpp>
 #include <hpx/util/bind.hpp>
 #include <hpx/util/runtime_configuration.hpp>
+#include <hpx/util/safe_lexical_cast.hpp>
 
 #include <boost/io/ios_state.hpp>
 #include <boost/asio/ip/tcp.hpp>
@@ -68,6 +70,16 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
             on_stop_thread)
       : base_type(ini, parcelport_address(ini), on_start_thread, on_stop_thread)
       , acceptor_(nullptr)
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+      , enable_io_uring_(hpx::util::get_entry_as<int>(
+            ini, "hpx.parcel.tcp.io_uring", 1) != 0)
+      , io_uring_entries_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel.tcp.io_uring_entries", std::size_t(256)))
+      , io_uring_buffers_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel.tcp.io_uring_buffers", std::size_t(64)))
+      , io_uring_buffer_size_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel.tcp.io_uring_buffer_size", std::size_t(16384)))
+#endif
     {
         if (here_.type() != std::string("tcp")) {
             HPX_THROW_EXCEPTION(network_error, "tcp::parcelport::parcelport",
@@ -83,8 +95,39 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
     bool connection_handler::do_run()
     {
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        // The first I/O thread is dedicated to submitting the reads and
+        // writes of all connections to the kernel, the others handle the
+        // accepting of connections.
+        if (enable_io_uring_)
+        {
+            if (io_service_pool_.size() < 2)
+            {
+                LPT_(warning) << "tcp::connection_handler: io_uring requires "
+                    "at least two I/O threads (hpx.parcel.tcp.io_pool_size), "
+                    "falling back to asynchronous sockets";
+            }
+            else
+            {
+                uring_.reset(new io_uring_service);
+                if (uring_->open(io_uring_entries_, io_uring_buffers_,
+                        io_uring_buffer_size_))
+                {
+                    io_service_pool_.get_io_service(0).post(
+                        util::bind(&io_uring_service::run, uring_.get()));
+                }
+                else
+                {
+                    LPT_(warning) << "tcp::connection_handler: io_uring is "
+                        "not available, falling back to asynchronous sockets";
+                    uring_.reset();
+                }
+            }
+        }
+#endif
+
         using boost::asio::ip::tcp;
-        boost::asio::io_service& io_service = io_service_pool_.get_io_service();
+        boost::asio::io_service& io_service = get_io_service();
         if (nullptr == acceptor_)
             acceptor_ = new tcp::acceptor(io_service);
 
@@ -98,7 +141,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         {
             try {
                 std::shared_ptr<receiver> receiver_conn(
-                    new receiver(io_service, get_max_inbound_message_size(), *this));
+                    new receiver(io_service, get_max_inbound_message_size(),
+                        *this, get_io_uring()));
 
                 tcp::endpoint ep = *it;
                 acceptor_->open(ep.protocol());
@@ -147,16 +191,74 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
             delete acceptor_;
             acceptor_ = nullptr;
         }
+
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        // operations still in flight are dropped once the io_uring instance
+        // is destroyed
+        if (uring_)
+            uring_->stop();
+#endif
+    }
+
+    boost::asio::io_service& connection_handler::get_io_service()
+    {
+        boost::asio::io_service& io_service = io_service_pool_.get_io_service();
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        // the first I/O thread is busy submitting operations to io_uring
+        if (uring_ && &io_service == &io_service_pool_.get_io_service(0))
+            return io_service_pool_.get_io_service();
+#endif
+        return io_service;
+    }
+
+    io_uring_service* connection_handler::get_io_uring() const
+    {
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        return uring_.get();
+#else
+        return nullptr;
+#endif
+    }
+
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+    bool connection_handler::has_io_statistics() const
+    {
+        return enable_io_uring_;
+    }
+
+    std::int64_t connection_handler::get_io_statistics(
+        io_statistics_type t, bool reset)
+    {
+        if (!uring_)
+            return 0;
+
+        switch (t) {
+        case io_syscalls:
+            return uring_->get_syscall_count(reset);
+
+        case io_operations:
+            return uring_->get_operation_count(reset);
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(bad_parameter,
+            "tcp::connection_handler::get_io_statistics",
+            "invalid io statistics type");
+        return 0;
     }
+#endif
 
     std::shared_ptr<sender> connection_handler::create_connection(
         parcelset::locality const& l, error_code& ec)
     {
-        boost::asio::io_service& io_service = io_service_pool_.get_io_service();
+        boost::asio::io_service& io_service = get_io_service();
 
         // The parcel gets serialized inside the connection constructor, no
         // need to keep the original parcel alive after this call returned.
-        std::shared_ptr<sender> sender_connection(new sender(io_service, l, this));
+        std::shared_ptr<sender> sender_connection(
+            new sender(io_service, l, this, get_io_uring()));
 
         // Connect to the target locality, retry if needed
         boost::system::error_code error = boost::asio::error::try_again;
@@ -288,9 +390,9 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
             // handle this incoming connection
             std::shared_ptr<receiver> c(receiver_conn);
 
-            boost::asio::io_service& io_service = io_service_pool_.get_io_service();
+            boost::asio::io_service& io_service = get_io_service();
             receiver_conn.reset(new receiver(io_service, get_max_inbound_message_size(),
-                *this));
+                *this, get_io_uring()));
             acceptor_->async_accept(receiver_conn->socket(),
                 util::bind(&connection_handler::handle_accept,
                     this,
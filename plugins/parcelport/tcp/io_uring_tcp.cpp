@@ -0,0 +1,772 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_TCP) && \
+    defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+#include <hpx/plugins/parcelport/tcp/io_uring.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/logging.hpp>
+
+#include <boost/asio/error.hpp>
+#include <boost/system/error_code.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <linux/io_uring.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace hpx { namespace parcelset { namespace policies { namespace tcp
+{
+    namespace
+    {
+        // liburing is not required, the few system calls needed are issued
+        // directly
+        int io_uring_setup(unsigned entries, io_uring_params* p)
+        {
+            return static_cast<int>(::syscall(__NR_io_uring_setup, entries, p));
+        }
+
+        int io_uring_enter(int fd, unsigned to_submit, unsigned min_complete,
+            unsigned flags)
+        {
+            return static_cast<int>(::syscall(__NR_io_uring_enter, fd,
+                to_submit, min_complete, flags, nullptr, 0));
+        }
+
+        int io_uring_register(int fd, unsigned opcode, void const* arg,
+            unsigned nr_args)
+        {
+            return static_cast<int>(
+                ::syscall(__NR_io_uring_register, fd, opcode, arg, nr_args));
+        }
+
+        // the user data of the operation reading from the eventfd and of
+        // the requests canceling operations
+        std::uint64_t const wakeup_user_data = 0;
+        std::uint64_t const cancel_user_data = 1;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct io_uring_service::operation
+    {
+        std::uint8_t opcode_;
+        int fd_;
+
+        // the buffers still to be transferred (readv/writev), completely
+        // transferred buffers are skipped
+        std::vector<iovec> buffers_;
+        std::size_t first_;
+
+        // the part of a registered buffer still to be transferred
+        // (read_fixed/write_fixed)
+        char* data_;
+        std::size_t size_;
+        int index_;
+
+        // complete the operation after the first successful transfer
+        bool some_;
+
+        std::size_t transferred_;
+        handler_type handler_;
+
+        bool done() const
+        {
+            if (opcode_ == IORING_OP_READ_FIXED ||
+                opcode_ == IORING_OP_WRITE_FIXED)
+            {
+                return size_ == 0;
+            }
+            return first_ == buffers_.size();
+        }
+
+        void skip_empty_buffers()
+        {
+            while (first_ != buffers_.size() && buffers_[first_].iov_len == 0)
+                ++first_;
+        }
+
+        void consume(std::size_t bytes)
+        {
+            transferred_ += bytes;
+            if (opcode_ == IORING_OP_READ_FIXED ||
+                opcode_ == IORING_OP_WRITE_FIXED)
+            {
+                HPX_ASSERT(bytes <= size_);
+                data_ += bytes;
+                size_ -= bytes;
+                return;
+            }
+
+            while (bytes != 0)
+            {
+                HPX_ASSERT(first_ != buffers_.size());
+                iovec& b = buffers_[first_];
+                if (bytes < b.iov_len)
+                {
+                    b.iov_base = static_cast<char*>(b.iov_base) + bytes;
+                    b.iov_len -= bytes;
+                    break;
+                }
+                bytes -= b.iov_len;
+                ++first_;
+            }
+            skip_empty_buffers();
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    io_uring_service::io_uring_service()
+      : ring_fd_(-1)
+      , event_fd_(-1)
+      , ring_(MAP_FAILED)
+      , ring_size_(0)
+      , sqes_(nullptr)
+      , sqes_size_(0)
+      , sq_head_(nullptr)
+      , sq_tail_(nullptr)
+      , sq_array_(nullptr)
+      , sq_mask_(0)
+      , sq_entries_(0)
+      , cq_head_(nullptr)
+      , cq_tail_(nullptr)
+      , cqes_(nullptr)
+      , cq_mask_(0)
+      , cq_entries_(0)
+      , sleeping_(false)
+      , aborted_(false)
+      , wakeup_armed_(false)
+      , wakeup_value_(0)
+      , stopped_(false)
+      , buffers_(nullptr)
+      , num_buffers_(0)
+      , buffer_size_(0)
+      , syscalls_(0)
+      , operations_(0)
+    {
+        wakeup_buffer_.iov_base = &wakeup_value_;
+        wakeup_buffer_.iov_len = sizeof(wakeup_value_);
+    }
+
+    io_uring_service::~io_uring_service()
+    {
+        close();
+    }
+
+    bool io_uring_service::open(std::size_t entries, std::size_t num_buffers,
+        std::size_t buffer_size)
+    {
+        HPX_ASSERT(ring_fd_ == -1);
+
+        io_uring_params p;
+        std::memset(&p, 0, sizeof(p));
+
+        ring_fd_ = io_uring_setup(static_cast<unsigned>(entries), &p);
+        if (ring_fd_ < 0)
+        {
+            LPT_(info) << "io_uring_service: io_uring_setup failed: "
+                       << std::strerror(errno);
+            ring_fd_ = -1;
+            return false;
+        }
+
+        // We rely on the kernel polling sockets internally instead of
+        // handing blocking reads to its worker threads, and on completions
+        // never being dropped.
+        unsigned const required_features = IORING_FEAT_SINGLE_MMAP |
+            IORING_FEAT_NODROP | IORING_FEAT_FAST_POLL;
+        if ((p.features & required_features) != required_features)
+        {
+            LPT_(info) << "io_uring_service: the kernel does not support "
+                          "all required io_uring features";
+            close();
+            return false;
+        }
+
+        // the submission and completion rings share a single mapping
+        ring_size_ = (std::max)(
+            p.sq_off.array + p.sq_entries * sizeof(unsigned),
+            p.cq_off.cqes + p.cq_entries * sizeof(io_uring_cqe));
+        ring_ = ::mmap(nullptr, ring_size_, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING);
+        if (ring_ == MAP_FAILED)
+        {
+            close();
+            return false;
+        }
+
+        sqes_size_ = p.sq_entries * sizeof(io_uring_sqe);
+        void* sqes = ::mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES);
+        if (sqes == MAP_FAILED)
+        {
+            close();
+            return false;
+        }
+        sqes_ = static_cast<io_uring_sqe*>(sqes);
+
+        char* base = static_cast<char*>(ring_);
+        sq_head_ = reinterpret_cast<std::atomic<unsigned>*>(base + p.sq_off.head);
+        sq_tail_ = reinterpret_cast<std::atomic<unsigned>*>(base + p.sq_off.tail);
+        sq_array_ = reinterpret_cast<unsigned*>(base + p.sq_off.array);
+        sq_mask_ = *reinterpret_cast<unsigned*>(base + p.sq_off.ring_mask);
+        sq_entries_ = p.sq_entries;
+
+        cq_head_ = reinterpret_cast<std::atomic<unsigned>*>(base + p.cq_off.head);
+        cq_tail_ = reinterpret_cast<std::atomic<unsigned>*>(base + p.cq_off.tail);
+        cqes_ = reinterpret_cast<io_uring_cqe*>(base + p.cq_off.cqes);
+        cq_mask_ = *reinterpret_cast<unsigned*>(base + p.cq_off.ring_mask);
+        cq_entries_ = p.cq_entries;
+
+        event_fd_ = ::eventfd(0, EFD_CLOEXEC);
+        if (event_fd_ < 0)
+        {
+            event_fd_ = -1;
+            close();
+            return false;
+        }
+
+        register_buffers(num_buffers, buffer_size);
+        return true;
+    }
+
+    void io_uring_service::register_buffers(std::size_t num_buffers,
+        std::size_t buffer_size)
+    {
+        if (num_buffers == 0 || buffer_size == 0)
+            return;
+
+        void* buffers = ::mmap(nullptr, num_buffers * buffer_size,
+            PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (buffers == MAP_FAILED)
+            return;
+
+        std::vector<iovec> iov(num_buffers);
+        for (std::size_t i = 0; i != num_buffers; ++i)
+        {
+            iov[i].iov_base = static_cast<char*>(buffers) + i * buffer_size;
+            iov[i].iov_len = buffer_size;
+        }
+
+        // registering might fail because of the locked memory limit, all
+        // operations fall back to plain readv/writev in this case
+        if (io_uring_register(ring_fd_, IORING_REGISTER_BUFFERS, iov.data(),
+                static_cast<unsigned>(num_buffers)) < 0)
+        {
+            LPT_(info) << "io_uring_service: registering buffers failed: "
+                       << std::strerror(errno);
+            ::munmap(buffers, num_buffers * buffer_size);
+            return;
+        }
+
+        buffers_ = static_cast<char*>(buffers);
+        num_buffers_ = num_buffers;
+        buffer_size_ = buffer_size;
+        free_buffers_.reserve(num_buffers);
+        for (std::size_t i = num_buffers; i != 0; --i)
+            free_buffers_.push_back(static_cast<int>(i - 1));
+    }
+
+    void io_uring_service::close()
+    {
+        // operations which did not complete are failed, the ring goes away
+        // anyway, so operations submitted to it are not canceled first
+        abort_operations(false);
+
+        if (buffers_ != nullptr)
+        {
+            ::munmap(buffers_, num_buffers_ * buffer_size_);
+            buffers_ = nullptr;
+            free_buffers_.clear();
+        }
+
+        if (sqes_ != nullptr)
+        {
+            ::munmap(sqes_, sqes_size_);
+            sqes_ = nullptr;
+        }
+        if (ring_ != MAP_FAILED)
+        {
+            ::munmap(ring_, ring_size_);
+            ring_ = MAP_FAILED;
+        }
+        if (event_fd_ != -1)
+        {
+            ::close(event_fd_);
+            event_fd_ = -1;
+        }
+        if (ring_fd_ != -1)
+        {
+            ::close(ring_fd_);
+            ring_fd_ = -1;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool io_uring_service::acquire_buffer(buffer& b)
+    {
+        HPX_ASSERT(b.data_ == nullptr);
+
+        std::lock_guard<mutex_type> l(buffers_mtx_);
+        if (free_buffers_.empty())
+            return false;
+
+        b.index_ = free_buffers_.back();
+        free_buffers_.pop_back();
+
+        b.data_ = buffers_ + b.index_ * buffer_size_;
+        b.size_ = buffer_size_;
+        return true;
+    }
+
+    void io_uring_service::release_buffer(buffer& b)
+    {
+        HPX_ASSERT(b.index_ >= 0);
+        {
+            std::lock_guard<mutex_type> l(buffers_mtx_);
+            free_buffers_.push_back(b.index_);
+        }
+        b = buffer();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void io_uring_service::async_write(int fd, std::vector<iovec>&& buffers,
+        handler_type&& handler)
+    {
+        std::unique_ptr<operation> op(new operation);
+        op->opcode_ = IORING_OP_WRITEV;
+        op->fd_ = fd;
+        op->buffers_ = std::move(buffers);
+        op->first_ = 0;
+        op->skip_empty_buffers();
+        op->some_ = false;
+        op->transferred_ = 0;
+        op->handler_ = std::move(handler);
+        enqueue(op.release());
+    }
+
+    void io_uring_service::async_read(int fd, std::vector<iovec>&& buffers,
+        handler_type&& handler)
+    {
+        std::unique_ptr<operation> op(new operation);
+        op->opcode_ = IORING_OP_READV;
+        op->fd_ = fd;
+        op->buffers_ = std::move(buffers);
+        op->first_ = 0;
+        op->skip_empty_buffers();
+        op->some_ = false;
+        op->transferred_ = 0;
+        op->handler_ = std::move(handler);
+        enqueue(op.release());
+    }
+
+    void io_uring_service::async_write_fixed(int fd, buffer const& b,
+        std::size_t size, handler_type&& handler)
+    {
+        HPX_ASSERT(b.index_ >= 0 && size <= b.size_);
+
+        std::unique_ptr<operation> op(new operation);
+        op->opcode_ = IORING_OP_WRITE_FIXED;
+        op->fd_ = fd;
+        op->data_ = b.data_;
+        op->size_ = size;
+        op->index_ = b.index_;
+        op->some_ = false;
+        op->transferred_ = 0;
+        op->handler_ = std::move(handler);
+        enqueue(op.release());
+    }
+
+    void io_uring_service::async_read_some(int fd, buffer const& b,
+        std::size_t offset, handler_type&& handler)
+    {
+        HPX_ASSERT(offset < b.size_);
+
+        std::unique_ptr<operation> op(new operation);
+        op->fd_ = fd;
+        if (b.index_ >= 0)
+        {
+            op->opcode_ = IORING_OP_READ_FIXED;
+            op->data_ = b.data_ + offset;
+            op->size_ = b.size_ - offset;
+            op->index_ = b.index_;
+        }
+        else
+        {
+            iovec iov;
+            iov.iov_base = b.data_ + offset;
+            iov.iov_len = b.size_ - offset;
+
+            op->opcode_ = IORING_OP_READV;
+            op->buffers_.push_back(iov);
+            op->first_ = 0;
+        }
+        op->some_ = true;
+        op->transferred_ = 0;
+        op->handler_ = std::move(handler);
+        enqueue(op.release());
+    }
+
+    void io_uring_service::enqueue(operation* op)
+    {
+        bool wakeup = false;
+        {
+            std::unique_lock<mutex_type> l(mtx_);
+            if (aborted_)
+            {
+                // run() has exited, nobody would submit the operation
+                l.unlock();
+                abort(op);
+                return;
+            }
+            pending_.push_back(op);
+            std::swap(wakeup, sleeping_);
+        }
+
+        // the thread executing run() waits for completions, the read from
+        // the eventfd completes once we have written to it
+        if (wakeup)
+        {
+            std::uint64_t value = 1;
+            ++syscalls_;
+            if (::write(event_fd_, &value, sizeof(value)) < 0)
+            {
+                LPT_(error) << "io_uring_service: waking up the submission "
+                               "thread failed: " << std::strerror(errno);
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void io_uring_service::prepare(io_uring_sqe& sqe, operation* op)
+    {
+        std::memset(&sqe, 0, sizeof(sqe));
+        sqe.fd = op->fd_;
+        sqe.user_data = reinterpret_cast<std::uint64_t>(op);
+
+        if (op->done())
+        {
+            // nothing to transfer, the operation completes right away
+            sqe.opcode = IORING_OP_NOP;
+            sqe.fd = -1;
+        }
+        else if (op->opcode_ == IORING_OP_READ_FIXED ||
+            op->opcode_ == IORING_OP_WRITE_FIXED)
+        {
+            sqe.opcode = op->opcode_;
+            sqe.addr = reinterpret_cast<std::uint64_t>(op->data_);
+            sqe.len = static_cast<std::uint32_t>(op->size_);
+            sqe.buf_index = static_cast<std::uint16_t>(op->index_);
+        }
+        else
+        {
+            sqe.opcode = op->opcode_;
+            sqe.addr = reinterpret_cast<std::uint64_t>(&op->buffers_[op->first_]);
+            sqe.len = static_cast<std::uint32_t>(
+                op->buffers_.size() - op->first_);
+        }
+    }
+
+    // Move as many pending operations as possible to the submission queue,
+    // returns the number of entries the kernel has not consumed yet,
+    // exhausted is set if operations are left pending because the
+    // submission queue is full. The number of operations in flight is not
+    // bounded by the size of the completion queue, the kernel keeps the
+    // completions which don't fit (IORING_FEAT_NODROP). Otherwise reads
+    // waiting on idle connections could keep writes from being submitted.
+    unsigned io_uring_service::fill_submission_queue(bool& exhausted)
+    {
+        unsigned const head = sq_head_->load(std::memory_order_acquire);
+        unsigned tail = sq_tail_->load(std::memory_order_relaxed);
+
+        // make sure the thread executing run() can be woken up
+        if (!wakeup_armed_ && tail - head != sq_entries_)
+        {
+            unsigned index = tail & sq_mask_;
+            io_uring_sqe& sqe = sqes_[index];
+
+            std::memset(&sqe, 0, sizeof(sqe));
+            sqe.opcode = IORING_OP_READV;
+            sqe.fd = event_fd_;
+            sqe.addr = reinterpret_cast<std::uint64_t>(&wakeup_buffer_);
+            sqe.len = 1;
+            sqe.user_data = wakeup_user_data;
+
+            sq_array_[index] = index;
+            ++tail;
+            wakeup_armed_ = true;
+        }
+
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            while (!pending_.empty() && tail - head != sq_entries_)
+            {
+                operation* op = pending_.front();
+                pending_.pop_front();
+
+                unsigned index = tail & sq_mask_;
+                prepare(sqes_[index], op);
+                sq_array_[index] = index;
+
+                active_.insert(op);
+                ++tail;
+            }
+
+            exhausted = !pending_.empty();
+        }
+
+        sq_tail_->store(tail, std::memory_order_release);
+
+        // entries left over by an earlier (partial) submission are
+        // submitted again
+        return tail - head;
+    }
+
+    bool io_uring_service::has_completions() const
+    {
+        return cq_head_->load(std::memory_order_relaxed) !=
+            cq_tail_->load(std::memory_order_acquire);
+    }
+
+    void io_uring_service::reap_completions()
+    {
+        unsigned head = cq_head_->load(std::memory_order_relaxed);
+        while (head != cq_tail_->load(std::memory_order_acquire))
+        {
+            io_uring_cqe const& cqe = cqes_[head & cq_mask_];
+            std::uint64_t const user_data = cqe.user_data;
+            int const result = cqe.res;
+
+            // hand the entry back to the kernel before running the handler
+            cq_head_->store(++head, std::memory_order_release);
+
+            if (user_data == wakeup_user_data)
+            {
+                wakeup_armed_ = false;
+                continue;
+            }
+            if (user_data == cancel_user_data)
+                continue;
+
+            operation* op = reinterpret_cast<operation*>(user_data);
+            active_.erase(op);
+            complete(op, result);
+        }
+    }
+
+    void io_uring_service::complete(operation* op, int result)
+    {
+        if (result == -EAGAIN || result == -EINTR)
+        {
+            // try again
+            enqueue(op);
+            return;
+        }
+
+        boost::system::error_code ec;
+        if (result < 0)
+        {
+            ec = boost::system::error_code(
+                -result, boost::system::system_category());
+        }
+        else if (!op->done())
+        {
+            op->consume(static_cast<std::size_t>(result));
+            if (result == 0)
+            {
+                ec = boost::asio::error::make_error_code(
+                    boost::asio::error::eof);
+            }
+            else if (!op->some_ && !op->done())
+            {
+                // short transfer, continue with the remaining data
+                enqueue(op);
+                return;
+            }
+        }
+
+        ++operations_;
+
+        std::unique_ptr<operation> p(op);
+        p->handler_(ec, p->transferred_);
+    }
+
+    void io_uring_service::abort(operation* op)
+    {
+        std::unique_ptr<operation> p(op);
+        p->handler_(boost::asio::error::make_error_code(
+            boost::asio::error::operation_aborted), p->transferred_);
+    }
+
+    // Cancel the operations submitted to the kernel and wait for them to
+    // complete, returns false if the ring can't be used anymore. Operations
+    // which complete before they are canceled invoke their handlers as
+    // usual, the others complete with operation_aborted.
+    bool io_uring_service::cancel_active()
+    {
+        // the operations are only used to identify the requests to cancel,
+        // they might complete (and be deleted) in the meantime
+        std::vector<operation*> const ops(active_.begin(), active_.end());
+        std::size_t next = 0;
+
+        while (!active_.empty())
+        {
+            unsigned const head = sq_head_->load(std::memory_order_acquire);
+            unsigned tail = sq_tail_->load(std::memory_order_relaxed);
+            while (next != ops.size() && tail - head != sq_entries_)
+            {
+                unsigned index = tail & sq_mask_;
+                io_uring_sqe& sqe = sqes_[index];
+
+                std::memset(&sqe, 0, sizeof(sqe));
+                sqe.opcode = IORING_OP_ASYNC_CANCEL;
+                sqe.fd = -1;
+                sqe.addr = reinterpret_cast<std::uint64_t>(ops[next++]);
+                sqe.user_data = cancel_user_data;
+
+                sq_array_[index] = index;
+                ++tail;
+            }
+            sq_tail_->store(tail, std::memory_order_release);
+
+            ++syscalls_;
+            int result = io_uring_enter(ring_fd_, tail - head, 1,
+                IORING_ENTER_GETEVENTS);
+            if (result < 0 && errno != EINTR && errno != EAGAIN &&
+                errno != EBUSY)
+            {
+                LPT_(error) << "io_uring_service: canceling the active "
+                               "operations failed: " << std::strerror(errno);
+                return false;
+            }
+
+            reap_completions();
+        }
+        return true;
+    }
+
+    // Complete all operations which have not completed yet with
+    // operation_aborted, operations started from now on fail right away.
+    void io_uring_service::abort_operations(bool cancel)
+    {
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            aborted_ = true;
+        }
+
+        // the operations submitted to the kernel still refer to their
+        // buffers, they are canceled first if the ring is still usable
+        if (cancel && ring_fd_ != -1)
+            cancel_active();
+
+        std::deque<operation*> pending;
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            std::swap(pending, pending_);
+        }
+        for (operation* op : pending)
+            abort(op);
+
+        std::unordered_set<operation*> active;
+        std::swap(active, active_);
+        for (operation* op : active)
+            abort(op);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void io_uring_service::run()
+    {
+        HPX_ASSERT(ring_fd_ != -1);
+
+        bool failed = false;
+        while (!stopped_)
+        {
+            bool exhausted = false;
+            unsigned const to_submit = fill_submission_queue(exhausted);
+
+            // wait for completions only if there is nothing else to do, the
+            // operations left pending because the submission queue was full
+            // are submitted once the kernel has consumed its entries
+            unsigned wait_nr = 0;
+            if (!has_completions() && !exhausted)
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                if (pending_.empty() && !stopped_)
+                {
+                    sleeping_ = true;
+                    wait_nr = 1;
+                }
+            }
+
+            if (to_submit != 0 || wait_nr != 0)
+            {
+                // this also flushes the completions which did not fit into
+                // the completion queue
+                ++syscalls_;
+                int result = io_uring_enter(ring_fd_, to_submit, wait_nr,
+                    IORING_ENTER_GETEVENTS);
+                if (result < 0 && errno != EINTR && errno != EAGAIN &&
+                    errno != EBUSY)
+                {
+                    LPT_(error) << "io_uring_service: io_uring_enter failed: "
+                                << std::strerror(errno);
+                    failed = true;
+                    break;
+                }
+            }
+
+            if (wait_nr != 0)
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                sleeping_ = false;
+            }
+
+            reap_completions();
+        }
+
+        // nobody would submit operations or reap their completions anymore
+        abort_operations(!failed);
+    }
+
+    void io_uring_service::stop()
+    {
+        stopped_ = true;
+
+        std::uint64_t value = 1;
+        ++syscalls_;
+        if (::write(event_fd_, &value, sizeof(value)) < 0)
+        {
+            LPT_(error) << "io_uring_service: waking up the submission "
+                           "thread failed: " << std::strerror(errno);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::int64_t io_uring_service::get_syscall_count(bool reset)
+    {
+        return reset ? syscalls_.exchange(0) : syscalls_.load();
+    }
+
+    std::int64_t io_uring_service::get_operation_count(bool reset)
+    {
+        return reset ? operations_.exchange(0) : operations_.load();
+    }
+}}}}
+
+#endif
@@ -35,7 +35,15 @@ namespace hpx { namespace traits
         }
         static char const* call()
         {
-            return "";
+            return
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+                "io_uring = ${HPX_PARCEL_TCP_IO_URING:1}\n"
+                "io_uring_entries = ${HPX_PARCEL_TCP_IO_URING_ENTRIES:256}\n"
+                "io_uring_buffers = ${HPX_PARCEL_TCP_IO_URING_BUFFERS:64}\n"
+                "io_uring_buffer_size = "
+                    "${HPX_PARCEL_TCP_IO_URING_BUFFER_SIZE:16384}\n"
+#endif
+                "";
         }
     };
 }}
@@ -20,6 +20,7 @@
 
 #include <boost/intrusive_ptr.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <exception>
 #include <functional>
@@ -31,19 +32,35 @@ namespace hpx { namespace lcos { namespace detail
     future_data_refcnt_base::~future_data_refcnt_base() = default;
 
     ///////////////////////////////////////////////////////////////////////////
-    struct handle_continuation_recursion_count
+    bool can_run_inline_continuation()
     {
-        handle_continuation_recursion_count()
-          : count_(threads::get_continuation_recursion_count())
+        // continuations are never run inline on non-HPX threads
+        if (hpx::threads::get_self_ptr() == nullptr)
+            return false;
+
+#if defined(HPX_HAVE_THREADS_GET_STACK_POINTER)
+        if (!this_thread::has_sufficient_stack_space())
+            return false;
+#endif
+        return threads::get_continuation_recursion_count() <
+            HPX_CONTINUATION_MAX_INLINE_DEPTH;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // announce a thread as (potentially) suspended in future_data_base::wait
+    struct handle_waiter_count
+    {
+        explicit handle_waiter_count(std::atomic<std::size_t>& count)
+          : count_(count)
         {
             ++count_;
         }
-        ~handle_continuation_recursion_count()
+        ~handle_waiter_count()
         {
             --count_;
         }
 
-        std::size_t& count_;
+        std::atomic<std::size_t>& count_;
     };
 
     ///////////////////////////////////////////////////////////////////////////
@@ -85,7 +102,9 @@ namespace hpx { namespace lcos { namespace detail
     ///////////////////////////////////////////////////////////////////////////
     future_data_base<traits::detail::future_data_void>::
         ~future_data_base()
-    {}
+    {
+        reset_on_completed();
+    }
 
     static util::unused_type unused_;
 
@@ -179,6 +198,40 @@ namespace hpx { namespace lcos { namespace detail
         return true;
     }
 
+    bool future_data_base<traits::detail::future_data_void>::
+        run_on_completed(completed_callback_node*&& head,
+        std::exception_ptr& ptr)
+    {
+        completed_callback_node* node = head;
+        head = nullptr;
+
+        try {
+            while (node != nullptr)
+            {
+                completed_callback_node* next = node->next_;
+                completed_callback_type func = std::move(node->callback_);
+                release_node(node);
+                node = next;
+
+                hpx::util::annotate_function annotate(func);
+                func();
+            }
+        }
+        catch (...) {
+            // the remaining continuations are not invoked anymore
+            while (node != nullptr)
+            {
+                completed_callback_node* next = node->next_;
+                release_node(node);
+                node = next;
+            }
+
+            ptr = std::current_exception();
+            return false;
+        }
+        return true;
+    }
+
     // make sure continuation invocation does not recurse deeper than
     // allowed
     template <typename Callback>
@@ -256,22 +309,126 @@ namespace hpx { namespace lcos { namespace detail
         {
             // invoke the callback (continuation) function right away
             handle_on_completed(std::move(data_sink));
+            return;
         }
-        else
+
+        // push the new continuation onto the stack of registered
+        // continuations unless the future has become ready in the meantime
+        completed_callback_node* node = make_node(std::move(data_sink));
+
+        completed_callback_node* head =
+            on_completed_.load(std::memory_order_acquire);
+        do
         {
-            std::unique_lock<mutex_type> l(mtx_);
-            if (is_ready())
+            if (head == completed_marker())
             {
-                l.unlock();
+                // the continuations have been invoked already, invoke this
+                // one directly
+                completed_callback_type f = std::move(node->callback_);
+                release_node(node);
+
+                handle_on_completed(std::move(f));
+                return;
+            }
+            node->next_ = head;
+        }
+        while (!on_completed_.compare_exchange_weak(head, node,
+            std::memory_order_release, std::memory_order_acquire));
+    }
 
-                // invoke the callback (continuation) function
-                handle_on_completed(std::move(data_sink));
+    void future_data_base<traits::detail::future_data_void>::handle_ready()
+    {
+        // handle all threads waiting for the future to become ready, the
+        // lock is taken only if a thread has announced that it is (about to
+        // be) suspended in wait()
+        if (waiters_.load() != 0)
+        {
+            // Note: we use notify_one repeatedly instead of notify_all as we
+            //       know: a) that most of the time we have at most one thread
+            //       waiting on the future (most futures are not shared), and
+            //       b) our implementation of condition_variable::notify_one
+            //       relinquishes the lock before resuming the waiting thread
+            //       which avoids suspension of this thread when it tries to
+            //       re-lock the mutex while exiting from condition_variable::wait
+            std::unique_lock<mutex_type> l(mtx_);
+            while (cond_.notify_one(std::move(l), threads::thread_priority_boost))
+            {
+                l = std::unique_lock<mutex_type>(mtx_);
             }
-            else
+
+            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
+            //       it unlocked when returning.
+        }
+
+        // detach the registered continuations, any continuation registered
+        // from now on will be invoked directly by set_on_completed
+        completed_callback_node* head =
+            on_completed_.exchange(completed_marker(), std::memory_order_acq_rel);
+        if (head == nullptr)
+            return;
+
+        HPX_ASSERT(head != completed_marker());
+
+        // the stack holds the continuations in reverse order of
+        // registration, reverse it in place
+        completed_callback_node* first = nullptr;
+        while (head != nullptr)
+        {
+            completed_callback_node* next = head->next_;
+            head->next_ = first;
+            first = head;
+            head = next;
+        }
+
+        // invoke the callback (continuation) functions
+        handle_on_completed(std::move(first));
+    }
+
+    void future_data_base<traits::detail::future_data_void>::
+        reset_on_completed()
+    {
+        // no synchronization is required as this is called only if there is
+        // no concurrent writer or reader
+        completed_callback_node* head =
+            on_completed_.exchange(nullptr, std::memory_order_acquire);
+        if (head != completed_marker())
+        {
+            while (head != nullptr)
             {
-                on_completed_.push_back(std::move(data_sink));
+                completed_callback_node* next = head->next_;
+                release_node(head);
+                head = next;
             }
         }
+
+        first_node_used_.store(false, std::memory_order_relaxed);
+    }
+
+    // The first continuation is stored in the inline node, only further
+    // continuations are allocated.
+    future_data_base<traits::detail::future_data_void>::completed_callback_node*
+    future_data_base<traits::detail::future_data_void>::make_node(
+        completed_callback_type && f)
+    {
+        if (!first_node_used_.load(std::memory_order_relaxed) &&
+            !first_node_used_.exchange(true, std::memory_order_acquire))
+        {
+            first_node_.callback_ = std::move(f);
+            first_node_.next_ = nullptr;
+            return &first_node_;
+        }
+        return new completed_callback_node(std::move(f));
+    }
+
+    void future_data_base<traits::detail::future_data_void>::release_node(
+        completed_callback_node* node)
+    {
+        if (node == &first_node_)
+        {
+            first_node_.callback_.reset();
+            return;
+        }
+        delete node;
     }
 
     future_data_base<traits::detail::future_data_void>::state
@@ -281,8 +438,11 @@ namespace hpx { namespace lcos { namespace detail
         state s = state_.load(std::memory_order_acquire);
         if (s == empty)
         {
+            // announce this thread as a waiter before re-checking the state,
+            // this pairs with the check of waiters_ in handle_ready()
             std::unique_lock<mutex_type> l(mtx_);
-            s = state_.load(std::memory_order_relaxed);
+            handle_waiter_count cnt(waiters_);
+            s = state_.load();
             if (s == empty)
             {
                 cond_.wait(l, "future_data_base::wait", ec);
@@ -301,8 +461,11 @@ namespace hpx { namespace lcos { namespace detail
         // block if this entry is empty
         if (state_.load(std::memory_order_acquire) == empty)
         {
+            // announce this thread as a waiter before re-checking the state,
+            // this pairs with the check of waiters_ in handle_ready()
             std::unique_lock<mutex_type> l(mtx_);
-            if (state_.load(std::memory_order_relaxed) == empty)
+            handle_waiter_count cnt(waiters_);
+            if (state_.load() == empty)
             {
                 threads::thread_state_ex_enum const reason =
                     cond_.wait_until(l, abs_time,
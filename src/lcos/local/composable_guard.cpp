@@ -32,11 +32,17 @@ namespace hpx { namespace lcos { namespace local
             guard_atomic next;
             detail::guard_function run;
             bool const single_guard;
+            std::size_t const max_combined;
 
             guard_task()
-              : next(nullptr), run(nothing), single_guard(true) {}
+              : next(nullptr), run(nothing), single_guard(true),
+                max_combined(std::size_t(-1)) {}
             guard_task(bool sg)
-              : next(nullptr), run(nothing), single_guard(sg) {}
+              : next(nullptr), run(nothing), single_guard(sg),
+                max_combined(std::size_t(-1)) {}
+            guard_task(std::size_t max_combined_)
+              : next(nullptr), run(nothing), single_guard(true),
+                max_combined(max_combined_) {}
         };
 
         void free(guard_task* task)
@@ -165,52 +171,73 @@ namespace hpx { namespace lcos { namespace local
 
     void run_guarded(guard& guard, detail::guard_function task)
     {
-        detail::guard_task* tptr = new detail::guard_task();
+        detail::guard_task* tptr = new detail::guard_task(guard.max_combined);
         tptr->run = std::move(task);
         run_guarded(guard, tptr);
     }
 
-    // This class exists so that a destructor is
-    // used to perform cleanup. By using a destructor
-    // we ensure the code works even if exceptions are
-    // thrown.
-    struct run_composable_cleanup
-    {
-        detail::guard_task* task;
-        run_composable_cleanup(detail::guard_task* task_) : task(task_) {}
-        ~run_composable_cleanup() {
-            detail::guard_task* zero = nullptr;
-            // If single_guard is false, then this is one of the
-            // setup tasks for a multi-guarded task. By not setting
-            // the next field, we halt processing on items queued
-            // to this guard.
-            HPX_ASSERT(task != nullptr);
-            task->check_();
-            if (!task->next.compare_exchange_strong(zero, task)) {
-                HPX_ASSERT(zero != nullptr);
-                run_composable(zero);
-                free(task);
-            }
-        }
-    };
-
     using hpx::lcos::local::detail::guard_task;
     guard_task *empty = new guard_task;
 
+    // Mark the given task as finished. Returns the next task queued on the
+    // same guard, if any, which is now responsible for releasing the guard.
+    static detail::guard_task* finish_task(detail::guard_task* task)
+    {
+        detail::guard_task* zero = nullptr;
+        HPX_ASSERT(task != nullptr && task->single_guard);
+        task->check_();
+        if (task->next.compare_exchange_strong(zero, task))
+            return nullptr;
+
+        HPX_ASSERT(zero != nullptr);
+        free(task);
+        return zero == empty ? nullptr : zero;
+    }
+
     static void run_composable(detail::guard_task* task)
     {
         if(task == empty)
             return;
         HPX_ASSERT(task != nullptr);
-        task->check_();
-        if (task->single_guard) {
-            run_composable_cleanup rcc(task);
-            task->run();
-        } else {
-            task->run();
-            // Note that by this point in the execution
-            // the task data structure has probably
-            // been deleted.
+
+        // Run the tasks queued on this guard one after the other on the
+        // current thread (flat combining), but at most max_combined of them
+        // in addition to the first one.
+        std::size_t const max_combined = task->max_combined;
+        std::size_t count = 0;
+        while (true)
+        {
+            task->check_();
+            if (!task->single_guard) {
+                task->run();
+                // Note that by this point in the execution
+                // the task data structure has probably
+                // been deleted.
+                return;
+            }
+
+            try {
+                task->run();
+            }
+            catch (...) {
+                // let a new thread continue with the queued tasks
+                detail::guard_task* next = finish_task(task);
+                if (next != nullptr)
+                    hpx::apply(&run_composable, next);
+                throw;
+            }
+
+            task = finish_task(task);
+            if (task == nullptr)
+                return;
+
+            if (count == max_combined) {
+                // release the current thread, a new thread continues
+                // with the queued tasks
+                hpx::apply(&run_composable, task);
+                return;
+            }
+            ++count;
         }
     }
 
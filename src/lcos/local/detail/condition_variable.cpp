@@ -8,8 +8,10 @@
 
 #include <hpx/error_code.hpp>
 #include <hpx/throw_exception.hpp>
+#include <hpx/lcos/local/mcs_spinlock.hpp>
 #include <hpx/lcos/local/no_mutex.hpp>
 #include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/lcos/local/ticket_spinlock.hpp>
 #include <hpx/runtime/threads/thread_data_fwd.hpp>
 #include <hpx/runtime/threads/thread_helpers.hpp>
 #include <hpx/util/assert.hpp>
@@ -40,20 +42,22 @@ namespace hpx { namespace lcos { namespace local { namespace detail
 
             local::no_mutex no_mtx;
             std::unique_lock<local::no_mutex> lock(no_mtx);
-            abort_all<local::no_mutex>(std::move(lock));
+            abort_all(std::move(lock));
         }
     }
 
+    template <typename Mutex>
     bool condition_variable::empty(
-        std::unique_lock<mutex_type> const& lock) const
+        std::unique_lock<Mutex> const& lock) const
     {
         HPX_ASSERT(lock.owns_lock());
 
         return queue_.empty();
     }
 
+    template <typename Mutex>
     std::size_t condition_variable::size(
-        std::unique_lock<mutex_type> const& lock) const
+        std::unique_lock<Mutex> const& lock) const
     {
         HPX_ASSERT(lock.owns_lock());
 
@@ -62,8 +66,9 @@ namespace hpx { namespace lcos { namespace local { namespace detail
 
     // Return false if no more threads are waiting (returns true if queue
     // is non-empty).
+    template <typename Mutex>
     bool condition_variable::notify_one(
-        std::unique_lock<mutex_type> lock, threads::thread_priority priority,
+        std::unique_lock<Mutex> lock, threads::thread_priority priority,
         error_code& ec)
     {
         HPX_ASSERT(lock.owns_lock());
@@ -101,8 +106,9 @@ namespace hpx { namespace lcos { namespace local { namespace detail
         return false;
     }
 
+    template <typename Mutex>
     void condition_variable::notify_all(
-        std::unique_lock<mutex_type> lock, threads::thread_priority priority,
+        std::unique_lock<Mutex> lock, threads::thread_priority priority,
         error_code& ec)
     {
         HPX_ASSERT(lock.owns_lock());
@@ -137,7 +143,7 @@ namespace hpx { namespace lcos { namespace local { namespace detail
 
                 error_code local_ec;
                 {
-                    util::ignore_while_checking<std::unique_lock<mutex_type> > il(&lock);
+                    util::ignore_while_checking<std::unique_lock<Mutex> > il(&lock);
                     threads::set_thread_state(id,
                         threads::pending, threads::wait_signaled, priority, local_ec);
                 }
@@ -166,15 +172,9 @@ namespace hpx { namespace lcos { namespace local { namespace detail
             ec = make_success_code();
     }
 
-    void condition_variable::abort_all(std::unique_lock<mutex_type> lock)
-    {
-        HPX_ASSERT(lock.owns_lock());
-
-        abort_all<mutex_type>(std::move(lock));
-    }
-
+    template <typename Mutex>
     threads::thread_state_ex_enum condition_variable::wait(
-        std::unique_lock<mutex_type>& lock,
+        std::unique_lock<Mutex>& lock,
         char const* description, error_code& ec)
     {
         HPX_ASSERT(threads::get_self_ptr() != nullptr);
@@ -188,7 +188,7 @@ namespace hpx { namespace lcos { namespace local { namespace detail
         threads::thread_state_ex_enum reason = threads::wait_unknown;
         {
             // yield this thread
-            util::unlock_guard<std::unique_lock<mutex_type> > ul(lock);
+            util::unlock_guard<std::unique_lock<Mutex> > ul(lock);
             reason = this_thread::suspend(threads::suspended, description, ec);
             if (ec) return threads::wait_unknown;
         }
@@ -197,8 +197,9 @@ namespace hpx { namespace lcos { namespace local { namespace detail
             threads::wait_timeout : reason;
     }
 
+    template <typename Mutex>
     threads::thread_state_ex_enum condition_variable::wait_until(
-        std::unique_lock<mutex_type>& lock,
+        std::unique_lock<Mutex>& lock,
         util::steady_time_point const& abs_time,
         char const* description, error_code& ec)
     {
@@ -213,7 +214,7 @@ namespace hpx { namespace lcos { namespace local { namespace detail
         threads::thread_state_ex_enum reason = threads::wait_unknown;
         {
             // yield this thread
-            util::unlock_guard<std::unique_lock<mutex_type> > ul(lock);
+            util::unlock_guard<std::unique_lock<Mutex> > ul(lock);
             reason = this_thread::suspend(abs_time, description, ec);
             if (ec) return threads::wait_unknown;
         }
@@ -225,6 +226,8 @@ namespace hpx { namespace lcos { namespace local { namespace detail
     template <typename Mutex>
     void condition_variable::abort_all(std::unique_lock<Mutex> lock)
     {
+        HPX_ASSERT(lock.owns_lock());
+
         // new threads might have been added while we were notifying
         while(!queue_.empty())
         {
@@ -282,8 +285,9 @@ namespace hpx { namespace lcos { namespace local { namespace detail
     }
 
     // re-add the remaining items to the original queue
+    template <typename Mutex>
     void condition_variable::prepend_entries(
-        std::unique_lock<mutex_type>& lock, queue_type& queue)
+        std::unique_lock<Mutex>& lock, queue_type& queue)
     {
         HPX_ASSERT(lock.owns_lock());
 
@@ -291,4 +295,28 @@ namespace hpx { namespace lcos { namespace local { namespace detail
         queue.splice(queue.end(), queue_);
         queue_.swap(queue);
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+#define HPX_CONDITION_VARIABLE_INSTANTIATE(Mutex)                             \
+    template bool condition_variable::empty(                                  \
+        std::unique_lock<Mutex> const&) const;                                \
+    template std::size_t condition_variable::size(                            \
+        std::unique_lock<Mutex> const&) const;                                \
+    template bool condition_variable::notify_one(std::unique_lock<Mutex>,     \
+        threads::thread_priority, error_code&);                               \
+    template void condition_variable::notify_all(std::unique_lock<Mutex>,     \
+        threads::thread_priority, error_code&);                               \
+    template void condition_variable::abort_all(std::unique_lock<Mutex>);     \
+    template threads::thread_state_ex_enum condition_variable::wait(          \
+        std::unique_lock<Mutex>&, char const*, error_code&);                  \
+    template threads::thread_state_ex_enum condition_variable::wait_until(    \
+        std::unique_lock<Mutex>&, util::steady_time_point const&,             \
+        char const*, error_code&);                                            \
+    /**/
+
+    HPX_CONDITION_VARIABLE_INSTANTIATE(lcos::local::spinlock)
+    HPX_CONDITION_VARIABLE_INSTANTIATE(lcos::local::ticket_spinlock)
+    HPX_CONDITION_VARIABLE_INSTANTIATE(lcos::local::mcs_spinlock)
+
+#undef HPX_CONDITION_VARIABLE_INSTANTIATE
 }}}}
@@ -0,0 +1,118 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/lcos/local/scalable_shared_mutex.hpp>
+
+#include <hpx/lcos/local/detail/condition_variable.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/runtime/threads/topology.hpp>
+#include <hpx/util/assert.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+
+namespace hpx { namespace lcos { namespace local
+{
+    ///////////////////////////////////////////////////////////////////////////
+    scalable_shared_mutex::scalable_shared_mutex()
+      : num_slots_(threads::hardware_concurrency() + 1),
+        slots_(new reader_slot[num_slots_]),
+        writer_(false)
+    {}
+
+    scalable_shared_mutex::~scalable_shared_mutex()
+    {
+        HPX_ASSERT(!writer_.load() && count_readers() == 0);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void scalable_shared_mutex::lock()
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+
+        // only one writer at a time
+        while (writer_.load())
+        {
+            writers_cond_.wait(l, "scalable_shared_mutex::lock");
+        }
+
+        // block new readers, then wait for the active ones to leave
+        writer_.store(true);
+        while (count_readers() != 0)
+        {
+            readers_done_cond_.wait(l, "scalable_shared_mutex::lock");
+        }
+    }
+
+    bool scalable_shared_mutex::try_lock()
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+        if (writer_.load())
+            return false;
+
+        writer_.store(true);
+        if (count_readers() != 0)
+        {
+            // readers which have seen the flag in the meantime are blocked
+            // on mtx_ and will re-check it
+            writer_.store(false);
+            return false;
+        }
+        return true;
+    }
+
+    void scalable_shared_mutex::unlock()
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+        HPX_ASSERT(writer_.load());
+        writer_.store(false);
+
+        // pending writers are preferred over waiting readers
+        if (!writers_cond_.empty(l))
+        {
+            writers_cond_.notify_one(std::move(l));
+            return;
+        }
+        readers_cond_.notify_all(std::move(l));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void scalable_shared_mutex::lock_shared_slow()
+    {
+        while (true)
+        {
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+                while (writer_.load())
+                {
+                    readers_cond_.wait(l, "scalable_shared_mutex::lock_shared");
+                }
+            }
+
+            if (try_lock_shared())
+                return;
+        }
+    }
+
+    // A reader has left while a writer is active or pending, let the writer
+    // re-check the reader counters.
+    void scalable_shared_mutex::notify_writer()
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+        readers_done_cond_.notify_one(std::move(l));
+    }
+
+    std::int64_t scalable_shared_mutex::count_readers() const
+    {
+        std::int64_t count = 0;
+        for (std::size_t i = 0; i != num_slots_; ++i)
+        {
+            count += slots_[i].count_.load();
+        }
+        return count;
+    }
+}}}
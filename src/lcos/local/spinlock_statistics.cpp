@@ -0,0 +1,197 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_SPINLOCK_COUNTERS)
+#include <hpx/lcos/local/detail/spinlock_statistics.hpp>
+
+#include <hpx/error_code.hpp>
+#include <hpx/performance_counters/counter_creators.hpp>
+#include <hpx/performance_counters/counters.hpp>
+#include <hpx/performance_counters/manage_counter_type.hpp>
+#include <hpx/runtime/naming/name.hpp>
+#include <hpx/throw_exception.hpp>
+#include <hpx/util/bind.hpp>
+#include <hpx/util/bind_front.hpp>
+#include <hpx/util/function.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace hpx { namespace lcos { namespace local { namespace detail
+{
+    namespace
+    {
+        // The registry is protected by a std::mutex as it is used by the
+        // spinlocks themselves.
+        struct spinlock_registry
+        {
+            typedef std::map<
+                    std::string, std::unique_ptr<spinlock_statistics>
+                > map_type;
+
+            std::mutex mtx_;
+            map_type statistics_;
+        };
+
+        spinlock_registry& get_registry()
+        {
+            static spinlock_registry registry;
+            return registry;
+        }
+
+        std::int64_t accumulate(std::string const& desc, bool reset,
+            std::atomic<std::int64_t> spinlock_statistics::* value)
+        {
+            spinlock_registry& registry = get_registry();
+            std::lock_guard<std::mutex> l(registry.mtx_);
+
+            std::int64_t result = 0;
+            for (auto& entry : registry.statistics_)
+            {
+                if (!desc.empty() && entry.first != desc)
+                    continue;
+
+                std::atomic<std::int64_t>& v = (*entry.second).*value;
+                result += reset ? v.exchange(0) : v.load();
+            }
+            return result;
+        }
+    }
+
+    spinlock_statistics* get_spinlock_statistics(char const* desc)
+    {
+        // most spinlocks are created with a string literal as description,
+        // remember the last lookup to avoid locking the registry
+        static HPX_NATIVE_TLS char const* last_desc = nullptr;
+        static HPX_NATIVE_TLS spinlock_statistics* last_statistics = nullptr;
+
+        if (desc == last_desc)
+            return last_statistics;
+
+        spinlock_registry& registry = get_registry();
+        std::lock_guard<std::mutex> l(registry.mtx_);
+
+        std::unique_ptr<spinlock_statistics>& statistics =
+            registry.statistics_[desc];
+        if (!statistics)
+            statistics.reset(new spinlock_statistics);
+
+        last_desc = desc;
+        last_statistics = statistics.get();
+        return last_statistics;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace
+    {
+        // Accumulated values for the spinlocks with the given description,
+        // or for all spinlocks if the description is empty.
+        std::int64_t get_spinlock_acquisitions(std::string const& desc,
+            bool reset)
+        {
+            return accumulate(desc, reset,
+                &spinlock_statistics::acquisitions_);
+        }
+
+        std::int64_t get_spinlock_contentions(std::string const& desc,
+            bool reset)
+        {
+            return accumulate(desc, reset,
+                &spinlock_statistics::contentions_);
+        }
+
+        std::int64_t get_spinlock_spin_time(std::string const& desc,
+            bool reset)
+        {
+            return accumulate(desc, reset,
+                &spinlock_statistics::spin_time_);
+        }
+
+        // the (optional) counter parameter selects the spinlock description
+        naming::gid_type spinlock_counter_creator(
+            performance_counters::counter_info const& info,
+            error_code& ec,
+            std::int64_t (*get_value)(std::string const&, bool))
+        {
+            // verify the validity of the counter instance name
+            performance_counters::counter_path_elements paths;
+            performance_counters::get_counter_path_elements(
+                info.fullname_, paths, ec);
+            if (ec) return naming::invalid_gid;
+
+            if (paths.parentinstance_is_basename_) {
+                HPX_THROWS_IF(ec, bad_parameter, "spinlock_counter_creator",
+                    "invalid counter instance parent name: " +
+                        paths.parentinstancename_);
+                return naming::invalid_gid;
+            }
+
+            if (paths.instancename_ != "total" || paths.instanceindex_ != -1)
+            {
+                HPX_THROWS_IF(ec, bad_parameter, "spinlock_counter_creator",
+                    "invalid counter instance name: " + paths.instancename_);
+                return naming::invalid_gid;
+            }
+
+            util::function_nonser<std::int64_t(bool)> f =
+                util::bind_front(get_value, paths.parameters_);
+            return performance_counters::detail::create_raw_counter(
+                info, std::move(f), ec);
+        }
+    }
+
+    void register_spinlock_counter_types()
+    {
+        using util::placeholders::_1;
+        using util::placeholders::_2;
+
+        performance_counters::generic_counter_type_data const counter_types[] =
+        {
+            { "/lcos/spinlock/count/acquisitions",
+              performance_counters::counter_raw,
+              "returns the number of times a spinlock was acquired on this "
+              "locality (the spinlock description can be specified as the "
+              "counter parameter)",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&spinlock_counter_creator, _1, _2,
+                  &get_spinlock_acquisitions),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { "/lcos/spinlock/count/contentions",
+              performance_counters::counter_raw,
+              "returns the number of times a spinlock could not be acquired "
+              "immediately on this locality (the spinlock description can be "
+              "specified as the counter parameter)",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&spinlock_counter_creator, _1, _2,
+                  &get_spinlock_contentions),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { "/lcos/spinlock/time/spin",
+              performance_counters::counter_raw,
+              "returns the overall time spent waiting for spinlocks on this "
+              "locality (the spinlock description can be specified as the "
+              "counter parameter)",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&spinlock_counter_creator, _1, _2,
+                  &get_spinlock_spin_time),
+              &performance_counters::locality_counter_discoverer,
+              "ns"
+            }
+        };
+        performance_counters::install_counter_types(
+            counter_types, sizeof(counter_types)/sizeof(counter_types[0]));
+    }
+}}}}
+#endif
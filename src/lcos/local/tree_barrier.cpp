@@ -0,0 +1,206 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/lcos/local/tree_barrier.hpp>
+
+#include <hpx/runtime/threads/topology.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/detail/yield_k.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstddef>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace lcos { namespace local
+{
+    namespace
+    {
+        // larger groups are split into several tree levels
+        std::size_t const max_fan_in = 8;
+        std::size_t const default_fan_in = 4;
+
+        // number of times a thread checks for its release before suspending
+        std::size_t const spin_count = 32;
+
+        void add_fan_in(std::vector<std::size_t>& fan_ins, std::size_t fan_in)
+        {
+            while (fan_in > max_fan_in)
+            {
+                fan_ins.push_back(max_fan_in);
+                fan_in = (fan_in + max_fan_in - 1) / max_fan_in;
+            }
+            if (fan_in > 1)
+                fan_ins.push_back(fan_in);
+        }
+
+        std::vector<std::size_t> topology_fan_ins()
+        {
+            threads::topology const& topo = threads::get_topology();
+
+            std::size_t const sockets =
+                (std::max)(topo.get_number_of_sockets(), std::size_t(1));
+            std::size_t const numa_nodes =
+                (std::max)(topo.get_number_of_numa_nodes(), sockets);
+            std::size_t const cores =
+                (std::max)(topo.get_number_of_cores(), numa_nodes);
+            std::size_t const pus =
+                (std::max)(topo.get_number_of_pus(), cores);
+
+            std::vector<std::size_t> fan_ins;
+            add_fan_in(fan_ins, pus / cores);
+            add_fan_in(fan_ins, cores / numa_nodes);
+            add_fan_in(fan_ins, numa_nodes / sockets);
+            add_fan_in(fan_ins, sockets);
+            return fan_ins;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    tree_barrier::tree_barrier(std::size_t number_of_threads)
+      : number_of_threads_(number_of_threads),
+        leaf_fan_in_(0),
+        num_nodes_(0)
+    {
+        init(topology_fan_ins());
+    }
+
+    tree_barrier::tree_barrier(std::size_t number_of_threads,
+            std::size_t fan_in)
+      : number_of_threads_(number_of_threads),
+        leaf_fan_in_(0),
+        num_nodes_(0)
+    {
+        std::vector<std::size_t> fan_ins;
+        add_fan_in(fan_ins, fan_in);
+        init(fan_ins);
+    }
+
+    tree_barrier::~tree_barrier()
+    {
+        // make sure no thread is still busy releasing a node
+        for (std::size_t i = 0; i != num_nodes_; ++i)
+        {
+            std::lock_guard<mutex_type> l(nodes_[i].mtx_);
+        }
+    }
+
+    // Build the tree bottom up, the leaves come first. Levels for which no
+    // fan-in was given use the default fan-in.
+    void tree_barrier::init(std::vector<std::size_t> const& fan_ins)
+    {
+        HPX_ASSERT(number_of_threads_ != 0);
+
+        std::vector<std::size_t> expected;
+        std::vector<std::size_t> parents;
+
+        std::size_t level = 0;
+        std::size_t level_begin = 0;
+        std::size_t count = number_of_threads_;
+        do {
+            std::size_t const fan_in =
+                level < fan_ins.size() ? fan_ins[level] : default_fan_in;
+            std::size_t const num_nodes = (count + fan_in - 1) / fan_in;
+            std::size_t const next_level_begin = expected.size();
+
+            if (level == 0)
+            {
+                leaf_fan_in_ = fan_in;
+            }
+            else
+            {
+                for (std::size_t i = 0; i != count; ++i)
+                    parents[level_begin + i] = next_level_begin + i / fan_in;
+            }
+
+            for (std::size_t i = 0; i != num_nodes; ++i)
+            {
+                expected.push_back((std::min)(fan_in, count - i * fan_in));
+                parents.push_back(npos);
+            }
+
+            level_begin = next_level_begin;
+            count = num_nodes;
+            ++level;
+        } while (count != 1);
+
+        num_nodes_ = expected.size();
+        nodes_.reset(new node[num_nodes_]);
+        for (std::size_t i = 0; i != num_nodes_; ++i)
+        {
+            nodes_[i].expected_ = expected[i];
+            nodes_[i].parent_ = parents[i];
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void tree_barrier::wait(std::size_t rank)
+    {
+        HPX_ASSERT(rank < number_of_threads_);
+
+        // nodes completed by this thread, at most one per tree level
+        std::size_t completed[CHAR_BIT * sizeof(std::size_t)];
+        std::size_t num_completed = 0;
+
+        std::size_t current = rank / leaf_fan_in_;
+        while (true)
+        {
+            node& n = nodes_[current];
+
+            // the generation can't change before this thread has arrived
+            std::size_t const generation =
+                n.generation_.load(std::memory_order_acquire);
+
+            if (n.arrived_.fetch_add(1, std::memory_order_acq_rel) + 1 !=
+                n.expected_)
+            {
+                wait_for_release(n, generation);
+                break;
+            }
+
+            // last to arrive, reset the node for the next round and
+            // proceed to the parent
+            n.arrived_.store(0, std::memory_order_relaxed);
+            completed[num_completed++] = current;
+
+            if (n.parent_ == npos)
+                break;
+            current = n.parent_;
+        }
+
+        // release the nodes completed by this thread, top down
+        while (num_completed != 0)
+        {
+            release(nodes_[completed[--num_completed]]);
+        }
+    }
+
+    void tree_barrier::wait_for_release(node& n, std::size_t generation)
+    {
+        for (std::size_t k = 0; k != spin_count; ++k)
+        {
+            if (n.generation_.load(std::memory_order_acquire) != generation)
+                return;
+            util::detail::yield_k(k, "hpx::lcos::local::tree_barrier::wait");
+        }
+
+        std::unique_lock<mutex_type> l(n.mtx_);
+        while (n.generation_.load(std::memory_order_acquire) == generation)
+        {
+            n.cond_.wait(l, "hpx::lcos::local::tree_barrier::wait");
+        }
+    }
+
+    void tree_barrier::release(node& n)
+    {
+        std::unique_lock<mutex_type> l(n.mtx_);
+        n.generation_.fetch_add(1, std::memory_order_release);
+        n.cond_.notify_all(std::move(l));
+    }
+}}}
@@ -7,6 +7,7 @@
 #include <hpx/config.hpp>
 #include <hpx/compat/mutex.hpp>
 #include <hpx/exception.hpp>
+#include <hpx/lcos/local/detail/spinlock_statistics.hpp>
 #include <hpx/performance_counters/counter_creators.hpp>
 #include <hpx/performance_counters/counters.hpp>
 #include <hpx/performance_counters/manage_counter_type.hpp>
@@ -28,10 +29,13 @@
 #include <hpx/state.hpp>
 #include <hpx/util/assert.hpp>
 #include <hpx/util/backtrace.hpp>
+#include <hpx/util/bind.hpp>
 #include <hpx/util/command_line_handling.hpp>
 #include <hpx/util/debugging.hpp>
+#include <hpx/util/function.hpp>
 #include <hpx/util/high_resolution_clock.hpp>
 #include <hpx/util/logging.hpp>
+#include <hpx/util/pooled_allocator.hpp>
 #include <hpx/util/query_counters.hpp>
 #include <hpx/util/static_reinit.hpp>
 #include <hpx/util/thread_mapper.hpp>
@@ -671,6 +675,50 @@ namespace hpx
         performance_counters::install_counter_types(
             arithmetic_counter_types,
             sizeof(arithmetic_counter_types)/sizeof(arithmetic_counter_types[0]));
+
+#if defined(HPX_HAVE_POOLED_ALLOCATOR)
+        using util::placeholders::_1;
+        using util::placeholders::_2;
+
+        util::function_nonser<std::int64_t(bool)> pooled_allocations(
+            &util::get_pooled_allocation_count);
+        util::function_nonser<std::int64_t(bool)> pooled_allocation_misses(
+            &util::get_pooled_allocation_misses);
+
+        performance_counters::generic_counter_type_data const
+            allocator_counter_types[] =
+        {
+            { "/runtime/count/pooled-allocations",
+              performance_counters::counter_raw,
+              "returns the number of allocations of shared states, "
+              "continuations and function objects which were served from "
+              "the per-worker pools on this locality",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, pooled_allocations, _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { "/runtime/count/pooled-allocation-misses",
+              performance_counters::counter_raw,
+              "returns the number of allocations of shared states, "
+              "continuations and function objects which could not be served "
+              "from the per-worker pools on this locality",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, pooled_allocation_misses, _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            }
+        };
+        performance_counters::install_counter_types(
+            allocator_counter_types,
+            sizeof(allocator_counter_types)/sizeof(allocator_counter_types[0]));
+#endif
+
+#if defined(HPX_HAVE_SPINLOCK_COUNTERS)
+        lcos::local::detail::register_spinlock_counter_types();
+#endif
     }
 
     std::uint32_t runtime::assign_cores(std::string const& locality_basename,
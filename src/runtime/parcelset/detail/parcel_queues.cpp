@@ -0,0 +1,401 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/parcelset/detail/parcel_queues.hpp>
+#include <hpx/runtime/get_worker_thread_num.hpp>
+#include <hpx/runtime/threads/topology.hpp>
+#include <hpx/util/allocator_deleter.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/pooled_allocator.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    struct destination_queue::node
+    {
+        node(parcel&& p, parcel_write_handler_type&& f)
+          : p_(std::move(p)), f_(std::move(f)), next_(nullptr)
+        {}
+
+        parcel p_;
+        parcel_write_handler_type f_;
+        node* next_;
+    };
+
+    // the nodes are allocated from the per-worker pools
+    destination_queue::node* destination_queue::create_node(
+        parcel&& p, parcel_write_handler_type&& f)
+    {
+        typedef util::pooled_allocator<node> allocator_type;
+        typedef std::allocator_traits<allocator_type> traits;
+        typedef std::unique_ptr<node,
+                util::allocator_deleter<allocator_type>
+            > unique_ptr;
+
+        allocator_type alloc;
+        unique_ptr n(traits::allocate(alloc, 1),
+            util::allocator_deleter<allocator_type>{alloc});
+        traits::construct(alloc, n.get(), std::move(p), std::move(f));
+        return n.release();
+    }
+
+    void destination_queue::destroy_node(node* n)
+    {
+        typedef util::pooled_allocator<node> allocator_type;
+        typedef std::allocator_traits<allocator_type> traits;
+
+        allocator_type alloc;
+        traits::destroy(alloc, n);
+        traits::deallocate(alloc, n, 1);
+    }
+
+    destination_queue::destination_queue(locality const& dest)
+      : head_(nullptr), size_(0), taken_(nullptr), ready_(false),
+        next_ready_(nullptr), dest_(dest)
+    {}
+
+    destination_queue::~destination_queue()
+    {
+        for (node* n : {head_.load(), taken_.load()})
+        {
+            while (n != nullptr)
+            {
+                node* next = n->next_;
+                destroy_node(n);
+                n = next;
+            }
+        }
+    }
+
+    // The queue is a stack of nodes, the parcels are brought into the order
+    // they were enqueued in only while dequeuing them. As nodes are never
+    // removed one by one, pushing them is not prone to the ABA problem.
+    void destination_queue::push(node* first, node* last, std::size_t count)
+    {
+        // account for the parcels first, the count never falls below the
+        // number of queued parcels
+        size_ += static_cast<std::int64_t>(count);
+
+        node* head = head_.load(std::memory_order_relaxed);
+        do {
+            last->next_ = head;
+        } while (!head_.compare_exchange_weak(head, first));
+    }
+
+    // restore the order the parcels of the given stack were enqueued in
+    destination_queue::node* destination_queue::reverse(node* n,
+        std::size_t& count)
+    {
+        node* first = nullptr;
+        while (n != nullptr)
+        {
+            node* next = n->next_;
+            n->next_ = first;
+            first = n;
+            n = next;
+            ++count;
+        }
+        return first;
+    }
+
+    void destination_queue::enqueue(parcel&& p, parcel_write_handler_type&& f)
+    {
+        node* n = create_node(std::move(p), std::move(f));
+        push(n, n, 1);
+    }
+
+    void destination_queue::enqueue(std::vector<parcel>&& parcels,
+        std::vector<parcel_write_handler_type>&& handlers)
+    {
+        HPX_ASSERT(parcels.size() == handlers.size());
+        if (parcels.empty())
+            return;
+
+        // link the nodes up front, they are pushed all at once and stay
+        // together
+        node* first = nullptr;
+        node* last = nullptr;
+        for (std::size_t i = 0; i != parcels.size(); ++i)
+        {
+            node* n = create_node(std::move(parcels[i]), std::move(handlers[i]));
+            n->next_ = first;
+            first = n;
+            if (last == nullptr)
+                last = n;
+        }
+
+        push(first, last, parcels.size());
+
+        parcels.clear();
+        handlers.clear();
+    }
+
+    bool destination_queue::dequeue(std::vector<parcel>& parcels,
+        std::vector<parcel_write_handler_type>& handlers)
+    {
+        // the parcels taken off the stack earlier are older than the ones
+        // still on it, both have to be taken at once
+        node* first = nullptr;
+        node* n = nullptr;
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            first = taken_.exchange(nullptr);
+            n = head_.exchange(nullptr);
+        }
+
+        if (first == nullptr && n == nullptr)
+            return false;
+
+        std::size_t count = 0;
+        node* last = nullptr;
+        for (node* t = first; t != nullptr; t = t->next_)
+        {
+            last = t;
+            ++count;
+        }
+
+        n = reverse(n, count);
+        if (last != nullptr)
+            last->next_ = n;
+        else
+            first = n;
+
+        parcels.reserve(parcels.size() + count);
+        handlers.reserve(handlers.size() + count);
+
+        while (first != nullptr)
+        {
+            parcels.push_back(std::move(first->p_));
+            handlers.push_back(std::move(first->f_));
+
+            node* next = first->next_;
+            destroy_node(first);
+            first = next;
+        }
+
+        size_ -= static_cast<std::int64_t>(count);
+        return true;
+    }
+
+    bool destination_queue::dequeue(parcel& p, parcel_write_handler_type& f)
+    {
+        node* n = nullptr;
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+
+            // take the parcels off the stack only once the ones taken
+            // earlier have been dequeued
+            n = taken_.load(std::memory_order_relaxed);
+            if (n == nullptr)
+            {
+                std::size_t count = 0;
+                n = reverse(head_.exchange(nullptr), count);
+                if (n == nullptr)
+                    return false;
+            }
+            taken_.store(n->next_);
+        }
+
+        p = std::move(n->p_);
+        f = std::move(n->f_);
+        destroy_node(n);
+
+        --size_;
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    parcel_queues::parcel_queues()
+      : num_slots_(threads::hardware_concurrency() + 1),
+        slots_(new reader_slot[num_slots_]),
+        map_(new map_type),
+        has_retired_(false),
+        ready_(nullptr)
+    {}
+
+    parcel_queues::~parcel_queues()
+    {
+        HPX_ASSERT(count_readers() == 0);
+        delete map_.load();
+    }
+
+    parcel_queues::reader_slot& parcel_queues::get_slot() const
+    {
+        // threads not managed by HPX share the last slot
+        std::size_t const num_thread = hpx::get_worker_thread_num();
+        if (num_thread == std::size_t(-1))
+            return slots_[num_slots_ - 1];
+        return slots_[num_thread % (num_slots_ - 1)];
+    }
+
+    std::int64_t parcel_queues::count_readers() const
+    {
+        std::int64_t count = 0;
+        for (std::size_t i = 0; i != num_slots_; ++i)
+        {
+            count += slots_[i].count_.load();
+        }
+        return count;
+    }
+
+    // A reader announces itself before loading the map, a writer replacing
+    // the map therefore sees all readers which might still access the old
+    // one. Readers do not suspend while accessing the map.
+    destination_queue* parcel_queues::find(locality const& dest) const
+    {
+        reader_slot& slot = get_slot();
+        ++slot.count_;
+
+        map_type const* m = map_.load();
+        map_type::const_iterator it = m->find(dest);
+        destination_queue* q = (it != m->end()) ? it->second : nullptr;
+
+        --slot.count_;
+
+        if (has_retired_.load(std::memory_order_relaxed))
+            release_retired();
+
+        return q;
+    }
+
+    void parcel_queues::release_retired() const
+    {
+        // don't wait for another thread adding a destination
+        std::unique_lock<mutex_type> l(mtx_, std::try_to_lock);
+        if (l)
+            release_retired_locked();
+    }
+
+    void parcel_queues::release_retired_locked() const
+    {
+        if (!retired_.empty() && count_readers() == 0)
+        {
+            retired_.clear();
+            has_retired_.store(false);
+        }
+    }
+
+    destination_queue& parcel_queues::get(locality const& dest)
+    {
+        if (destination_queue* q = find(dest))
+            return *q;
+
+        std::lock_guard<mutex_type> l(mtx_);
+
+        // somebody else might have added this destination in the meantime
+        map_type const* current = map_.load();
+        map_type::const_iterator it = current->find(dest);
+        if (it != current->end())
+            return *it->second;
+
+        queues_.emplace_back(new destination_queue(dest));
+        destination_queue& q = *queues_.back();
+
+        std::unique_ptr<map_type> m(new map_type(*current));
+        m->emplace(dest, &q);
+        map_.store(m.release());
+
+        // release the maps replaced earlier if nobody can access them,
+        // otherwise this is retried while looking up destinations
+        retired_.emplace_back(current);
+        has_retired_.store(true);
+        release_retired_locked();
+
+        return q;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void parcel_queues::set_ready(destination_queue& q)
+    {
+        if (q.ready_.exchange(true))
+            return;
+
+        destination_queue* head = ready_.load(std::memory_order_relaxed);
+        do {
+            q.next_ready_ = head;
+        } while (!ready_.compare_exchange_weak(head, &q));
+    }
+
+    void parcel_queues::take_ready(std::vector<destination_queue*>& destinations)
+    {
+        destination_queue* q = ready_.exchange(nullptr);
+
+        // the queues can't be linked into the list again before their flag
+        // is reset
+        std::size_t const first = destinations.size();
+        while (q != nullptr)
+        {
+            destinations.push_back(q);
+            q = q->next_ready_;
+        }
+
+        for (std::size_t i = first; i != destinations.size(); ++i)
+        {
+            destinations[i]->ready_.store(false);
+        }
+
+        // this is called from the background work, which is a good time
+        // to release replaced maps
+        if (has_retired_.load(std::memory_order_relaxed))
+            release_retired();
+    }
+
+    bool parcel_queues::dequeue_any(locality& dest, parcel& p,
+        parcel_write_handler_type& f)
+    {
+        // the queues themselves stay alive as long as this object
+        std::vector<destination_queue*> queues;
+        {
+            reader_slot& slot = get_slot();
+            ++slot.count_;
+
+            map_type const* m = map_.load();
+            queues.reserve(m->size());
+            for (map_type::value_type const& v : *m)
+            {
+                if (!v.second->empty())
+                    queues.push_back(v.second);
+            }
+
+            --slot.count_;
+        }
+
+        for (destination_queue* q : queues)
+        {
+            if (q->dequeue(p, f))
+            {
+                dest = q->destination();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::int64_t parcel_queues::size() const
+    {
+        reader_slot& slot = get_slot();
+        ++slot.count_;
+
+        std::int64_t count = 0;
+        map_type const* m = map_.load();
+        for (map_type::value_type const& v : *m)
+        {
+            count += v.second->size();
+        }
+
+        --slot.count_;
+        return count;
+    }
+}}}
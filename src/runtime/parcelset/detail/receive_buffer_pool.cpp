@@ -0,0 +1,91 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/parcelset/detail/receive_buffer_pool.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/static.hpp>
+
+#include <cstddef>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace detail
+{
+    receive_buffer_pool::receive_buffer_pool()
+      : retained_size_(0)
+    {}
+
+    receive_buffer_pool& receive_buffer_pool::instance()
+    {
+        util::static_<receive_buffer_pool, tag> pool;
+        return pool.get();
+    }
+
+    std::vector<char> receive_buffer_pool::get(std::size_t size)
+    {
+        std::vector<char> buffer;
+        if (size <= max_buffer_size)
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+
+            // use the smallest of the buffers the data fits into
+            std::size_t best = buffers_.size();
+            for (std::size_t i = 0; i != buffers_.size(); ++i)
+            {
+                std::size_t const capacity = buffers_[i].capacity();
+                if (capacity >= size && (best == buffers_.size() ||
+                        capacity < buffers_[best].capacity()))
+                {
+                    best = i;
+                }
+            }
+
+            if (best != buffers_.size())
+            {
+                HPX_ASSERT(retained_size_ >= buffers_[best].capacity());
+                retained_size_ -= buffers_[best].capacity();
+
+                buffer = std::move(buffers_[best]);
+                if (best != buffers_.size() - 1)
+                    buffers_[best] = std::move(buffers_.back());
+                buffers_.pop_back();
+            }
+        }
+
+        buffer.resize(size);
+        return buffer;
+    }
+
+    void receive_buffer_pool::release(std::vector<char>&& buffer)
+    {
+        std::size_t const capacity = buffer.capacity();
+        if (capacity == 0 || capacity > max_buffer_size)
+            return;
+
+        buffer.clear();
+
+        std::vector<char> dropped;
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            if (retained_size_ + capacity > max_retained_size)
+            {
+                // the memory is released outside of the lock
+                dropped = std::move(buffer);
+                return;
+            }
+
+            retained_size_ += capacity;
+            buffers_.push_back(std::move(buffer));
+        }
+    }
+
+    std::size_t receive_buffer_pool::retained_size() const
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return retained_size_;
+    }
+}}}
@@ -981,6 +981,16 @@ namespace hpx { namespace parcelset
         return pp ? pp->get_connection_cache_statistics(stat_type, reset) : 0;
     }
 
+    // I/O statistics
+    std::int64_t parcelhandler::get_io_statistics(
+        std::string const& pp_type,
+        parcelport::io_statistics_type stat_type, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_io_statistics(stat_type, reset) : 0;
+    }
+
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
     // same as above, just separated data for each action
     // number of parcels sent
@@ -1048,6 +1058,8 @@ namespace hpx { namespace parcelset
         {
             register_counter_types(pp.second->type());
             register_connection_cache_counter_types(pp.second->type());
+            if (pp.second->has_io_statistics())
+                register_io_counter_types(pp.second->type());
         }
 
         using util::placeholders::_1;
@@ -1515,6 +1527,55 @@ namespace hpx { namespace parcelset
 #endif
     }
 
+    // register connection specific performance counters related to the
+    // system calls issued by the parcelport
+    void parcelhandler::register_io_counter_types(std::string const& pp_type)
+    {
+        using hpx::util::placeholders::_1;
+        using hpx::util::placeholders::_2;
+
+#if defined(HPX_HAVE_NETWORKING)
+        util::function_nonser<std::int64_t(bool)> io_syscalls(
+            util::bind_front(&parcelhandler::get_io_statistics,
+                this, pp_type, parcelport::io_syscalls));
+        util::function_nonser<std::int64_t(bool)> io_operations(
+            util::bind_front(&parcelhandler::get_io_statistics,
+                this, pp_type, parcelport::io_operations));
+
+        performance_counters::generic_counter_type_data const io_types[] =
+        {
+            { hpx::util::format(
+                  "/parcelport/count/{}/io-syscalls", pp_type),
+              performance_counters::counter_raw,
+              hpx::util::format(
+                  "returns the number of system calls issued for sending and "
+                  "receiving data for the {} connection type on the "
+                  "referenced locality", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(io_syscalls), _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { hpx::util::format(
+                  "/parcelport/count/{}/io-operations", pp_type),
+              performance_counters::counter_raw,
+              hpx::util::format(
+                  "returns the number of completed read and write operations "
+                  "for the {} connection type on the referenced locality",
+                  pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(io_operations), _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            }
+        };
+        performance_counters::install_counter_types(io_types,
+            sizeof(io_types)/sizeof(io_types[0]));
+#endif
+    }
+
     std::vector<plugins::parcelport_factory_base *> &
     parcelhandler::get_parcelport_factories()
     {
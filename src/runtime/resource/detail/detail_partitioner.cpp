@@ -157,6 +157,12 @@ namespace hpx { namespace resource { namespace detail
         case resource::shared_priority:
             sched = "shared_priority";
             break;
+        case resource::deadline:
+            sched = "deadline";
+            break;
+        case resource::local_priority_chase_lev:
+            sched = "local_priority_chase_lev";
+            break;
         }
 
         os << "\"" << sched << "\" is running on PUs : \n";
@@ -442,6 +448,15 @@ namespace hpx { namespace resource { namespace detail
         {
             default_scheduler = scheduling_policy::shared_priority;
         }
+        else if (0 == std::string("deadline").find(cfg_.queuing_))
+        {
+            default_scheduler = scheduling_policy::deadline;
+        }
+        else if (0 == std::string("local-priority-chase-lev").find(
+            cfg_.queuing_))
+        {
+            default_scheduler = scheduling_policy::local_priority_chase_lev;
+        }
         else
         {
             throw hpx::detail::command_line_error(
@@ -108,4 +108,50 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
         // should not get here, never
         HPX_ASSERT(this->m_state == super_type::ctx_running);
     }
+
+    void coroutine_impl::invoke_stackless()
+    {
+        HPX_ASSERT(m_stackless && this->is_ready());
+
+#if defined(HPX_HAVE_THREAD_PHASE_INFORMATION)
+        ++this->m_phase;
+#endif
+        this->m_state = super_type::ctx_running;
+
+        typedef super_type::context_exit_status context_exit_status;
+        context_exit_status status = super_type::ctx_exited_return;
+
+        std::exception_ptr tinfo;
+        try
+        {
+            result_type result_last(
+                thread_state_enum::terminated, invalid_thread_id);
+
+            {
+                coroutine_self* old_self = coroutine_self::get_self();
+                coroutine_self self(this, old_self);
+                reset_self_on_exit on_exit(&self, old_self);
+
+                result_last = m_fun(*this->args());
+                HPX_ASSERT(result_last.first == thread_state_enum::terminated);
+            }
+
+            this->bind_result(result_last);
+        }
+        catch (...) {
+            status = super_type::ctx_exited_abnormally;
+            tinfo = std::current_exception();
+        }
+
+        this->reset();
+
+        // there is no other side to switch to, simply mark the context as
+        // exited (see do_return)
+        this->m_type_info = std::move(tinfo);
+        this->m_state = super_type::ctx_exited;
+        this->m_exit_status = status;
+
+        if (status == super_type::ctx_exited_abnormally)
+            std::rethrow_exception(this->m_type_info);
+    }
 }}}}
@@ -0,0 +1,310 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/threads/coroutines/detail/stack_pool.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#if defined(HPX_HAVE_UNISTD_H)
+#include <unistd.h>
+#endif
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) \
+ && _POSIX_MAPPED_FILES > 0
+#define HPX_HAVE_COROUTINE_STACK_POOL
+#endif
+
+#if defined(HPX_HAVE_COROUTINE_STACK_POOL)
+#include <hpx/runtime/threads/coroutines/detail/posix_utility.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/spinlock.hpp>
+
+#include <sys/mman.h>
+#if defined(__linux) || defined(linux) || defined(__linux__)
+#include <sys/syscall.h>
+#endif
+#endif
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace hpx { namespace threads { namespace coroutines { namespace detail
+{
+namespace posix
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // this global variable is set by the runtime configuration
+    HPX_EXPORT std::atomic<std::size_t> stack_pool_size(256);
+
+#if defined(HPX_HAVE_COROUTINE_STACK_POOL)
+    namespace
+    {
+        ///////////////////////////////////////////////////////////////////////
+        std::size_t const max_numa_domains = 8;
+        std::size_t const max_size_classes = 4;
+
+        std::atomic<std::int64_t> pool_hits(0);
+        std::atomic<std::int64_t> pool_misses(0);
+        std::atomic<std::int64_t> pool_resident_bytes(0);
+
+        // the NUMA domain of the current OS-thread as set by
+        // stack_pool_set_numa_domain, -1 if unknown
+        HPX_NATIVE_TLS int numa_node = -1;
+
+        // The free list of stacks is linked through the last word of each
+        // stack, which lives in the (always committed) topmost page.
+        void*& next_stack(void* stack, std::size_t size)
+        {
+            return *(static_cast<void**>(stack) + size / sizeof(void*) - 1);
+        }
+
+        struct stack_free_list
+        {
+            stack_free_list()
+              : head_(nullptr), count_(0)
+            {}
+
+            util::spinlock mtx_;
+            void* head_;
+            std::size_t count_;
+
+            // avoid false sharing between neighboring free lists
+            char pad_[64];
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        class stack_pool
+        {
+        public:
+            stack_pool()
+            {
+                for (std::atomic<std::size_t>& s : sizes_)
+                    s.store(0, std::memory_order_relaxed);
+            }
+
+            ~stack_pool()
+            {
+                // stacks released after this point are unmapped directly
+                stack_pool_size.store(0, std::memory_order_relaxed);
+
+                for (std::size_t d = 0; d != max_numa_domains; ++d)
+                {
+                    for (std::size_t c = 0; c != max_size_classes; ++c)
+                    {
+                        std::size_t size = sizes_[c].load();
+                        void* stack = free_lists_[d][c].head_;
+                        while (stack != nullptr)
+                        {
+                            void* next = next_stack(stack, size);
+                            unmap_stack(stack, size);
+                            stack = next;
+                        }
+                    }
+                }
+            }
+
+            void* allocate(std::size_t size)
+            {
+                stack_free_list* l = get_free_list(size, false);
+                if (l == nullptr)
+                {
+                    ++pool_misses;
+                    return nullptr;
+                }
+
+                void* stack = nullptr;
+                {
+                    std::lock_guard<util::spinlock> lk(l->mtx_);
+                    if (l->head_ != nullptr)
+                    {
+                        stack = l->head_;
+                        l->head_ = next_stack(stack, size);
+                        --l->count_;
+                    }
+                }
+
+                if (stack == nullptr)
+                {
+                    ++pool_misses;
+                    return nullptr;
+                }
+
+                ++pool_hits;
+                pool_resident_bytes -= EXEC_PAGESIZE;
+                return stack;
+            }
+
+            bool deallocate(void* stack, std::size_t size)
+            {
+                std::size_t const max_count =
+                    stack_pool_size.load(std::memory_order_relaxed);
+                if (max_count == 0 || size <= EXEC_PAGESIZE)
+                    return false;
+
+                stack_free_list* l = get_free_list(size, true);
+                if (l == nullptr)
+                    return false;
+
+                // Give back all pages touched beyond the topmost one, the
+                // address space stays reserved.
+                if (reset_stack(stack, size))
+                    release_pages(stack, size - EXEC_PAGESIZE);
+
+                {
+                    std::lock_guard<util::spinlock> lk(l->mtx_);
+                    if (l->count_ >= max_count)
+                        return false;
+
+                    next_stack(stack, size) = l->head_;
+                    l->head_ = stack;
+                    ++l->count_;
+                }
+
+                pool_resident_bytes += EXEC_PAGESIZE;
+                return true;
+            }
+
+        private:
+            static void release_pages(void* addr, std::size_t size)
+            {
+#if defined(MADV_FREE)
+                if (::madvise(addr, size, MADV_FREE) == 0)
+                    return;
+#endif
+                ::madvise(addr, size, MADV_DONTNEED);
+            }
+
+            // Return whether the watermark placed by watermark_stack() at
+            // the bottom of the topmost page was overwritten.
+            static bool reset_stack(void* stack, std::size_t size)
+            {
+                void** watermark = static_cast<void**>(stack) +
+                    ((size - EXEC_PAGESIZE) / sizeof(void*));
+                return reinterpret_cast<void*>(0xDEADBEEFDEADBEEFull) !=
+                    *watermark;
+            }
+
+            // Find the free list for the current NUMA domain and the given
+            // stack size, optionally creating a new size class.
+            stack_free_list* get_free_list(std::size_t size, bool create)
+            {
+                std::size_t domain = get_numa_domain() % max_numa_domains;
+                for (std::size_t c = 0; c != max_size_classes; ++c)
+                {
+                    std::size_t s = sizes_[c].load(std::memory_order_acquire);
+                    if (s == size)
+                        return &free_lists_[domain][c];
+
+                    if (s == 0)
+                    {
+                        if (!create)
+                            return nullptr;
+
+                        if (sizes_[c].compare_exchange_strong(s, size) ||
+                            s == size)
+                        {
+                            return &free_lists_[domain][c];
+                        }
+                    }
+                }
+                return nullptr;     // too many different stack sizes
+            }
+
+            static std::size_t get_numa_domain()
+            {
+                // bound OS-threads don't migrate between NUMA domains, all
+                // others are asked for their current domain every time
+                if (numa_node >= 0)
+                    return static_cast<std::size_t>(numa_node);
+
+#if (defined(__linux) || defined(linux) || defined(__linux__)) && \
+    defined(SYS_getcpu)
+                unsigned cpu = 0, node = 0;
+                if (::syscall(SYS_getcpu, &cpu, &node, nullptr) == 0)
+                    return static_cast<std::size_t>(node);
+#endif
+                return 0;
+            }
+
+            std::atomic<std::size_t> sizes_[max_size_classes];
+            stack_free_list free_lists_[max_numa_domains][max_size_classes];
+        };
+
+        stack_pool& get_stack_pool()
+        {
+            static stack_pool pool;
+            return pool;
+        }
+    }
+
+    void stack_pool_set_numa_domain(std::size_t domain)
+    {
+        numa_node = (domain == std::size_t(-1)) ?
+            -1 : static_cast<int>(domain);
+    }
+
+    void* stack_pool_allocate(std::size_t size)
+    {
+        if (stack_pool_size.load(std::memory_order_relaxed) == 0)
+            return nullptr;
+        return get_stack_pool().allocate(size);
+    }
+
+    bool stack_pool_deallocate(void* stack, std::size_t size)
+    {
+        if (stack_pool_size.load(std::memory_order_relaxed) == 0)
+            return false;
+        return get_stack_pool().deallocate(stack, size);
+    }
+
+    std::int64_t get_stack_pool_hit_count(bool reset)
+    {
+        return util::get_and_reset_value(pool_hits, reset);
+    }
+
+    std::int64_t get_stack_pool_miss_count(bool reset)
+    {
+        return util::get_and_reset_value(pool_misses, reset);
+    }
+
+    std::int64_t get_stack_pool_resident_bytes(bool)
+    {
+        return pool_resident_bytes.load();
+    }
+#else
+    void stack_pool_set_numa_domain(std::size_t)
+    {
+    }
+
+    void* stack_pool_allocate(std::size_t)
+    {
+        return nullptr;
+    }
+
+    bool stack_pool_deallocate(void*, std::size_t)
+    {
+        return false;
+    }
+
+    std::int64_t get_stack_pool_hit_count(bool)
+    {
+        return 0;
+    }
+
+    std::int64_t get_stack_pool_miss_count(bool)
+    {
+        return 0;
+    }
+
+    std::int64_t get_stack_pool_resident_bytes(bool)
+    {
+        return 0;
+    }
+#endif
+}
+}}}}
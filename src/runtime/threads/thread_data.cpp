@@ -11,6 +11,7 @@
 #include <hpx/exception.hpp>
 #include <hpx/throw_exception.hpp>
 #include <hpx/runtime/naming/address.hpp>
+#include <hpx/runtime/threads/policies/scheduler_base.hpp>
 #include <hpx/util/assert.hpp>
 #include <hpx/util/function.hpp>
 #include <hpx/util/register_locks.hpp>
@@ -161,7 +162,28 @@ namespace hpx { namespace threads
     std::size_t get_self_stacksize()
     {
         thread_id_type id = get_self_id();
-        return id ? id->get_stack_size() : 0;
+        if (!id)
+            return 0;
+
+        // threads derived from a stackless thread get a stack of their own
+        std::ptrdiff_t stacksize = id->get_stack_size();
+        if (stacksize == thread_stacksize_nostack)
+            return get_stack_size(thread_stacksize_small);
+        return stacksize;
+    }
+
+    thread_schedule_hint get_self_affinity_hint()
+    {
+        thread_id_type id = get_self_id();
+        return id ? id->get_affinity_hint() : thread_schedule_hint();
+    }
+
+    thread_schedule_hint get_self_default_affinity_hint()
+    {
+        thread_id_type id = get_self_id();
+        if (!id || !id->get_scheduler_base()->use_affinity_hints())
+            return thread_schedule_hint();
+        return id->get_affinity_hint();
     }
 
 #ifndef HPX_HAVE_THREAD_PARENT_REFERENCE
@@ -33,6 +33,7 @@
 #include <limits>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <utility>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -90,8 +91,15 @@ namespace hpx { namespace threads
     /// The get_stack_size function is part of the thread related API. It
     std::ptrdiff_t get_stack_size(thread_id_type const& id, error_code& ec)
     {
-        return id ? id->get_stack_size() :
-            static_cast<std::ptrdiff_t>(thread_stacksize_unknown);
+        if (!id)
+            return static_cast<std::ptrdiff_t>(thread_stacksize_unknown);
+
+        // stackless threads run on the stack of their worker thread, report
+        // the size of the smallest stack instead of the internal marker
+        std::ptrdiff_t stacksize = id->get_stack_size();
+        if (stacksize == thread_stacksize_nostack)
+            return threads::get_stack_size(thread_stacksize_small);
+        return stacksize;
     }
 
     void interrupt_thread(thread_id_type const& id, bool flag, error_code& ec)
@@ -463,6 +471,39 @@ namespace hpx { namespace this_thread
             error_code& ec_;
         };
 #endif
+
+        // A stackless thread can't hand its worker thread back to the
+        // scheduler. Yielding it is turned into yielding the OS-thread,
+        // anything which relies on somebody else resuming it is rejected.
+        threads::thread_state_ex_enum suspend_stackless(
+            threads::thread_state_enum state,
+            threads::thread_id_type const& nextid,
+            util::thread_description const& description, error_code& ec)
+        {
+            if (state != threads::pending && state != threads::pending_boost)
+            {
+                std::ostringstream strm;
+                strm << "a stackless HPX-thread (created with "
+                        "thread_stacksize_nostack) can't wait ("
+                     << description << "), use a thread stack size other "
+                        "than nostack for threads which may block";
+                HPX_THROWS_IF(ec, invalid_status, "this_thread::suspend",
+                    strm.str());
+                return threads::wait_unknown;
+            }
+
+            if (nextid)
+            {
+                nextid->get_scheduler_base()->schedule_thread(
+                    nextid.get(), threads::thread_schedule_hint());
+            }
+            std::this_thread::yield();
+
+            if (&ec != &throws)
+                ec = make_success_code();
+
+            return threads::wait_signaled;
+        }
     }
 
     /// The function \a suspend will return control to the thread manager
@@ -484,6 +525,11 @@ namespace hpx { namespace this_thread
         threads::interruption_point(id, ec);
         if (ec) return threads::wait_unknown;
 
+        // stackless threads run on the stack of the worker thread and can't
+        // be suspended
+        if (HPX_UNLIKELY(self.is_stackless()))
+            return detail::suspend_stackless(state, nextid, description, ec);
+
         threads::thread_state_ex_enum statex = threads::wait_unknown;
 
         {
@@ -546,6 +592,23 @@ namespace hpx { namespace this_thread
         threads::interruption_point(id, ec);
         if (ec) return threads::wait_unknown;
 
+        // stackless threads run on the stack of the worker thread, they
+        // block the worker thread while waiting instead of being suspended
+        if (HPX_UNLIKELY(self.is_stackless()))
+        {
+            if (nextid)
+            {
+                nextid->get_scheduler_base()->schedule_thread(
+                    nextid.get(), threads::thread_schedule_hint());
+            }
+            std::this_thread::sleep_until(abs_time.value());
+
+            if (&ec != &throws)
+                ec = make_success_code();
+
+            return threads::wait_timeout;
+        }
+
         // let the thread manager do other things while waiting
         threads::thread_state_ex_enum statex = threads::wait_unknown;
 
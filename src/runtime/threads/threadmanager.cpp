@@ -20,6 +20,7 @@
 #include <hpx/runtime/actions/continuation.hpp>
 #include <hpx/runtime/resource/detail/partitioner.hpp>
 #include <hpx/runtime/thread_pool_helpers.hpp>
+#include <hpx/runtime/threads/coroutines/detail/stack_pool.hpp>
 #include <hpx/runtime/threads/detail/scheduled_thread_pool.hpp>
 #include <hpx/runtime/threads/detail/set_thread_state.hpp>
 #include <hpx/runtime/threads/executors/current_executor.hpp>
@@ -252,6 +253,9 @@ namespace hpx { namespace threads
         if (size == thread_stacksize_unknown)
             return "unknown";
 
+        if (size == thread_stacksize_nostack)
+            return "nostack";
+
         util::runtime_configuration const& rtcfg = hpx::get_config();
         if (rtcfg.get_stack_size(thread_stacksize_small) == size)
             size = thread_stacksize_small;
@@ -606,6 +610,74 @@ namespace hpx { namespace threads
 #endif
                 break;
             }
+
+            case resource::deadline:
+            {
+#if defined(HPX_HAVE_DEADLINE_SCHEDULER)
+                // set parameters for scheduler and pool instantiation and
+                // perform compatibility checks
+                hpx::detail::ensure_high_priority_compatibility(cfg_.vm_);
+                std::string affinity_desc;
+                std::size_t numa_sensitive =
+                    hpx::detail::get_affinity_description(cfg_, affinity_desc);
+
+                // instantiate the scheduler
+                typedef hpx::threads::policies::deadline_queue_scheduler<>
+                    local_sched_type;
+                local_sched_type::init_parameter_type init(num_threads_in_pool,
+                    1000, numa_sensitive, "core-deadline_queue_scheduler");
+                std::unique_ptr<local_sched_type> sched(
+                    new local_sched_type(init));
+
+                // instantiate the pool
+                std::unique_ptr<thread_pool_base> pool(
+                    new hpx::threads::detail::scheduled_thread_pool<
+                            local_sched_type
+                        >(std::move(sched),
+                        notifier_, i, name.c_str(), scheduler_mode,
+                        thread_offset));
+                pools_.push_back(std::move(pool));
+#else
+                throw hpx::detail::command_line_error(
+                    "Command line option --hpx:queuing=deadline "
+                    "is not configured in this build. Please rebuild with "
+                    "'cmake -DHPX_WITH_THREAD_SCHEDULERS=deadline'.");
+#endif
+                break;
+            }
+
+            case resource::local_priority_chase_lev:
+            {
+                // set parameters for scheduler and pool instantiation and
+                // perform compatibility checks
+                std::size_t num_high_priority_queues =
+                    hpx::detail::get_num_high_priority_queues(
+                        cfg_, rp.get_num_threads(name));
+                std::string affinity_desc;
+                std::size_t numa_sensitive =
+                    hpx::detail::get_affinity_description(cfg_, affinity_desc);
+
+                // instantiate the scheduler
+                typedef hpx::threads::policies::local_priority_queue_scheduler<
+                    compat::mutex, hpx::threads::policies::lockfree_chase_lev>
+                    local_sched_type;
+                local_sched_type::init_parameter_type init(num_threads_in_pool,
+                    num_high_priority_queues, 1000, numa_sensitive,
+                    "core-local_priority_queue_scheduler");
+                std::unique_ptr<local_sched_type> sched(
+                    new local_sched_type(init));
+
+                // instantiate the pool
+                std::unique_ptr<thread_pool_base> pool(
+                    new hpx::threads::detail::scheduled_thread_pool<
+                            local_sched_type
+                        >(std::move(sched),
+                        notifier_, i, name.c_str(), scheduler_mode,
+                        thread_offset));
+                pools_.push_back(std::move(pool));
+
+                break;
+            }
             }
 
             // update the thread_offset for the next pool
@@ -993,6 +1065,15 @@ namespace hpx { namespace threads
         return result;
     }
 
+    std::int64_t threadmanager::get_num_stolen_from_pending_batches(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_stolen_from_pending_batches(
+                all_threads, reset);
+        return result;
+    }
+
     std::int64_t threadmanager::get_num_stolen_from_staged(bool reset)
     {
         std::int64_t result = 0;
@@ -1018,6 +1099,81 @@ namespace hpx { namespace threads
     }
 #endif
 
+    std::int64_t threadmanager::get_thread_cache_hits(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_thread_cache_hits(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_thread_cache_misses(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_thread_cache_misses(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_deadline_misses(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_deadline_misses(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_affinity_hits(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_affinity_hits(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_affinity_misses(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_affinity_misses(all_threads, reset);
+        return result;
+    }
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+    std::int64_t threadmanager::get_idle_park_count(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_idle_park_count(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_idle_wakeup_count(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_idle_wakeup_count(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_average_idle_wake_latency(bool reset)
+    {
+        std::int64_t result = 0;
+        std::int64_t count = 0;
+        for (auto const& pool_iter : pools_)
+        {
+            std::int64_t latency =
+                pool_iter->get_average_idle_wake_latency(all_threads, reset);
+            if (latency != 0)
+            {
+                result += latency;
+                ++count;
+            }
+        }
+        return count == 0 ? 0 : result / count;
+    }
+#endif
+
     ///////////////////////////////////////////////////////////////////////////
     // counter creator and discovery functions
 
@@ -1375,6 +1531,20 @@ namespace hpx { namespace threads
                 util::bind_front(
                     &coroutine_type::impl_type::get_stack_unbind_count),
                 util::function_nonser<std::uint64_t(bool)>(), "", 0},
+#endif
+#if !defined(HPX_WINDOWS)
+            // /threads{locality#%d/total}/count/stack-pool-hits
+            {"count/stack-pool-hits",
+                &coroutines::detail::posix::get_stack_pool_hit_count,
+                util::function_nonser<std::uint64_t(bool)>(), "", 0},
+            // /threads{locality#%d/total}/count/stack-pool-misses
+            {"count/stack-pool-misses",
+                &coroutines::detail::posix::get_stack_pool_miss_count,
+                util::function_nonser<std::uint64_t(bool)>(), "", 0},
+            // /threads{locality#%d/total}/count/stack-pool-resident-bytes
+            {"count/stack-pool-resident-bytes",
+                &coroutines::detail::posix::get_stack_pool_resident_bytes,
+                util::function_nonser<std::uint64_t(bool)>(), "", 0},
 #endif
         };
         std::size_t const data_size = sizeof(data)/sizeof(data[0]);
@@ -1644,6 +1814,28 @@ namespace hpx { namespace threads
                 "operations performed for the referenced locality",
                 HPX_PERFORMANCE_COUNTER_V1, counts_creator,
                 &performance_counters::locality_counter_discoverer, ""},
+#endif
+#if !defined(HPX_WINDOWS)
+            {"/threads/count/stack-pool-hits",
+                performance_counters::counter_raw,
+                "returns the total number of HPX-thread stacks which were "
+                "taken from the stack pool for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &performance_counters::locality_counter_discoverer, ""},
+            {"/threads/count/stack-pool-misses",
+                performance_counters::counter_raw,
+                "returns the total number of HPX-thread stacks which had to "
+                "be newly allocated as the stack pool was empty for the "
+                "referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &performance_counters::locality_counter_discoverer, ""},
+            {"/threads/count/stack-pool-resident-bytes",
+                performance_counters::counter_raw,
+                "returns the current number of bytes of resident memory "
+                "held by the stacks kept in the stack pool for the "
+                "referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &performance_counters::locality_counter_discoverer, ""},
 #endif
             {"/threads/count/objects", performance_counters::counter_raw,
                 "returns the overall number of created HPX-thread objects for "
@@ -1683,6 +1875,18 @@ namespace hpx { namespace threads
                     &thread_pool_base::get_num_stolen_from_pending),
                 &performance_counters::locality_pool_thread_counter_discoverer,
                 ""},
+            {"/threads/count/stolen-from-pending-batches",
+                performance_counters::counter_raw,
+                "returns the overall number of steal operations performed by "
+                "neighboring schedulers on the pending queue of this scheduler "
+                "for the referenced locality (each operation may steal more "
+                "than one HPX-thread)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&threadmanager::locality_pool_thread_counter_creator,
+                    this, &threadmanager::get_num_stolen_from_pending_batches,
+                    &thread_pool_base::get_num_stolen_from_pending_batches),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
             {"/threads/count/stolen-from-staged",
                 performance_counters::counter_raw,
                 "returns the overall number of task descriptions stolen by "
@@ -1716,6 +1920,95 @@ namespace hpx { namespace threads
                     &thread_pool_base::get_num_stolen_to_staged),
                 &performance_counters::locality_pool_thread_counter_discoverer,
                 ""},
+#endif
+            {"/threads/count/thread-cache-hits",
+                performance_counters::counter_raw,
+                "returns the overall number of HPX-thread objects which were "
+                "reused from the per-worker thread caches for the referenced "
+                "locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&threadmanager::locality_pool_thread_counter_creator,
+                    this, &threadmanager::get_thread_cache_hits,
+                    &thread_pool_base::get_thread_cache_hits),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
+            {"/threads/count/thread-cache-misses",
+                performance_counters::counter_raw,
+                "returns the overall number of HPX-thread objects which could "
+                "not be taken from the per-worker thread caches for the "
+                "referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&threadmanager::locality_pool_thread_counter_creator,
+                    this, &threadmanager::get_thread_cache_misses,
+                    &thread_pool_base::get_thread_cache_misses),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
+            {"/threads/count/deadline-misses",
+                performance_counters::counter_raw,
+                "returns the overall number of HPX-threads which were started "
+                "only after their deadline had passed for the referenced "
+                "locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&threadmanager::locality_pool_thread_counter_creator,
+                    this, &threadmanager::get_num_deadline_misses,
+                    &thread_pool_base::get_num_deadline_misses),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
+            {"/threads/count/affinity-hits",
+                performance_counters::counter_raw,
+                "returns the overall number of HPX-threads which were scheduled "
+                "onto the worker thread they (or their producer) ran on before "
+                "for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&threadmanager::locality_pool_thread_counter_creator,
+                    this, &threadmanager::get_affinity_hits,
+                    &thread_pool_base::get_affinity_hits),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
+            {"/threads/count/affinity-misses",
+                performance_counters::counter_raw,
+                "returns the overall number of HPX-threads which could not be "
+                "scheduled onto the worker thread they (or their producer) ran "
+                "on before as that worker thread was overloaded for the "
+                "referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&threadmanager::locality_pool_thread_counter_creator,
+                    this, &threadmanager::get_affinity_misses,
+                    &thread_pool_base::get_affinity_misses),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+            {"/threads/count/idle-parks",
+                performance_counters::counter_raw,
+                "returns the overall number of times worker threads were parked "
+                "after running out of work for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&threadmanager::locality_pool_thread_counter_creator,
+                    this, &threadmanager::get_idle_park_count,
+                    &thread_pool_base::get_idle_park_count),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
+            {"/threads/count/idle-wakeups",
+                performance_counters::counter_raw,
+                "returns the overall number of times parked worker threads were "
+                "woken up because of new work for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&threadmanager::locality_pool_thread_counter_creator,
+                    this, &threadmanager::get_idle_wakeup_count,
+                    &thread_pool_base::get_idle_wakeup_count),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
+            {"/threads/time/idle-wake-latency",
+                performance_counters::counter_raw,
+                "returns the average time between waking up a parked worker "
+                "thread and the worker thread running again for the referenced "
+                "locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&threadmanager::locality_pool_thread_counter_creator,
+                    this, &threadmanager::get_average_idle_wake_latency,
+                    &thread_pool_base::get_average_idle_wake_latency),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                "ns"},
 #endif
             // scheduler utilization
             {"/scheduler/utilization/instantaneous",
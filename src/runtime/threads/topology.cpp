@@ -126,6 +126,25 @@ namespace hpx { namespace threads { namespace detail
 #endif
         return node;
     }
+
+    bool is_cache_obj(hwloc_obj_t obj, std::size_t level) noexcept
+    {
+#if HWLOC_API_VERSION >= 0x00020000
+        switch (level)
+        {
+        case 2:
+            return obj->type == HWLOC_OBJ_L2CACHE;
+        case 3:
+            return obj->type == HWLOC_OBJ_L3CACHE;
+        default:
+            break;
+        }
+        return false;
+#else
+        return obj->type == HWLOC_OBJ_CACHE &&
+            obj->attr->cache.depth == static_cast<unsigned>(level);
+#endif
+    }
 }}}
 
 namespace hpx { namespace threads
@@ -250,6 +269,8 @@ namespace hpx { namespace threads
         socket_affinity_masks_.reserve(num_of_pus_);
         numa_node_affinity_masks_.reserve(num_of_pus_);
         core_affinity_masks_.reserve(num_of_pus_);
+        l2_cache_affinity_masks_.reserve(num_of_pus_);
+        l3_cache_affinity_masks_.reserve(num_of_pus_);
         thread_affinity_masks_.reserve(num_of_pus_);
 
         for (std::size_t i = 0; i < num_of_pus_; ++i)
@@ -267,6 +288,14 @@ namespace hpx { namespace threads
             core_affinity_masks_.push_back(init_core_affinity_mask(i));
         }
 
+        for (std::size_t i = 0; i < num_of_pus_; ++i)
+        {
+            l2_cache_affinity_masks_.push_back(
+                init_cache_affinity_mask(i, 2, core_affinity_masks_[i]));
+            l3_cache_affinity_masks_.push_back(
+                init_cache_affinity_mask(i, 3, numa_node_affinity_masks_[i]));
+        }
+
         for (std::size_t i = 0; i < num_of_pus_; ++i)
         {
             thread_affinity_masks_.push_back(init_thread_affinity_mask(i));
@@ -299,6 +328,10 @@ namespace hpx { namespace threads
         detail::write_to_log_mask("socket_affinity_mask", socket_affinity_masks_);
         detail::write_to_log_mask("numa_node_affinity_mask", numa_node_affinity_masks_);
         detail::write_to_log_mask("core_affinity_mask", core_affinity_masks_);
+        detail::write_to_log_mask("l2_cache_affinity_mask",
+            l2_cache_affinity_masks_);
+        detail::write_to_log_mask("l3_cache_affinity_mask",
+            l3_cache_affinity_masks_);
         detail::write_to_log_mask("thread_affinity_mask", thread_affinity_masks_);
     }
 
@@ -420,6 +453,49 @@ namespace hpx { namespace threads
         return empty_mask;
     }
 
+    mask_cref_type topology::get_cache_affinity_mask(
+        std::size_t num_thread
+      , std::size_t level
+      , error_code& ec
+        ) const
+    { // {{{
+        std::vector<mask_type> const* masks = nullptr;
+        switch (level)
+        {
+        case 2:
+            masks = &l2_cache_affinity_masks_;
+            break;
+
+        case 3:
+            masks = &l3_cache_affinity_masks_;
+            break;
+
+        default:
+            HPX_THROWS_IF(ec, bad_parameter
+              , "hpx::threads::topology::get_cache_affinity_mask"
+              , hpx::util::format(
+                    "cache level %1% is not supported", level));
+            return empty_mask;
+        }
+
+        std::size_t num_pu = num_thread % num_of_pus_;
+
+        if (num_pu < masks->size())
+        {
+            if (&ec != &throws)
+                ec = make_success_code();
+
+            return (*masks)[num_pu];
+        }
+
+        HPX_THROWS_IF(ec, bad_parameter
+          , "hpx::threads::topology::get_cache_affinity_mask"
+          , hpx::util::format(
+                "thread number %1% is out of range",
+                num_thread));
+        return empty_mask;
+    } // }}}
+
     mask_cref_type topology::get_thread_affinity_mask(
         std::size_t num_thread
       , error_code& ec
@@ -1079,6 +1155,40 @@ namespace hpx { namespace threads
         return default_mask;
     } // }}}
 
+    mask_type topology::init_cache_affinity_mask(
+        std::size_t num_thread, std::size_t level, mask_cref_type default_mask
+        ) const
+    { // {{{
+        if (std::size_t(-1) == num_thread)
+            return default_mask;
+
+        std::size_t num_pu = (num_thread + pu_offset) % num_of_pus_;
+
+        hwloc_obj_t obj = nullptr;
+
+        {
+            std::unique_lock<hpx::util::spinlock> lk(topo_mtx);
+            obj = hwloc_get_obj_by_type(topo, HWLOC_OBJ_PU,
+                static_cast<unsigned>(num_pu));
+        }
+
+        // walk up the tree until we find a cache of the requested level
+        while (obj)
+        {
+            if (detail::is_cache_obj(obj, level))
+            {
+                mask_type cache_affinity_mask = mask_type();
+                resize(cache_affinity_mask, get_number_of_pus());
+
+                extract_node_mask(obj, cache_affinity_mask);
+                return cache_affinity_mask;
+            }
+            obj = obj->parent;
+        }
+
+        return default_mask;
+    } // }}}
+
     mask_type topology::init_thread_affinity_mask(
         std::size_t num_thread
         ) const
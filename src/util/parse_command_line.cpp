@@ -446,8 +446,9 @@ namespace hpx { namespace util
                 ("hpx:queuing", value<std::string>(),
                   "the queue scheduling policy to use, options are "
                   "'local', 'local-priority-fifo','local-priority-lifo', "
-                  "'abp-priority-fifo', 'abp-priority-lifo', 'static', and "
-                  "'static-priority' (default: 'local-priority'; "
+                  "'local-priority-chase-lev', 'abp-priority-fifo', "
+                  "'abp-priority-lifo', 'static', 'static-priority', and "
+                  "'deadline' (default: 'local-priority'; "
                   "all option values can be abbreviated)")
                 ("hpx:high-priority-threads", value<std::size_t>(),
                   "the number of operating system threads maintaining a high "
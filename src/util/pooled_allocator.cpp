@@ -0,0 +1,353 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_POOLED_ALLOCATOR)
+#include <hpx/util/get_and_reset_value.hpp>
+#include <hpx/util/internal_allocator.hpp>
+#include <hpx/util/pooled_allocator.hpp>
+#include <hpx/util/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace hpx { namespace util { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    namespace
+    {
+        // blocks are grouped into size classes of multiples of this size
+        HPX_CONSTEXPR_OR_CONST std::size_t pool_granularity = 64;
+        HPX_CONSTEXPR_OR_CONST std::size_t pool_num_size_classes = 16;
+        HPX_CONSTEXPR_OR_CONST std::size_t pool_max_block_size =
+            pool_granularity * pool_num_size_classes;
+
+        // maximum number of unused blocks kept per thread and size class
+        HPX_CONSTEXPR_OR_CONST std::size_t pool_max_cached_blocks = 64;
+
+        // maximum number of unused blocks kept in the global pool per size
+        // class, these are handed over by exiting threads
+        HPX_CONSTEXPR_OR_CONST std::size_t pool_max_global_blocks = 1024;
+
+        struct free_block
+        {
+            free_block* next_;
+        };
+
+        void release_blocks(free_block* block, std::size_t size_class)
+        {
+            internal_allocator<char> alloc;
+            while (block != nullptr)
+            {
+                free_block* next = block->next_;
+                alloc.deallocate(reinterpret_cast<char*>(block),
+                    (size_class + 1) * pool_granularity);
+                block = next;
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The pool of a single (OS-) thread. Only the owning thread touches
+        // the free lists, the statistics are read by the counters.
+        struct thread_pool_cache
+        {
+            thread_pool_cache()
+              : allocations_(0), misses_(0)
+            {
+                for (std::size_t i = 0; i != pool_num_size_classes; ++i)
+                {
+                    free_lists_[i] = nullptr;
+                    counts_[i] = 0;
+                }
+            }
+
+            ~thread_pool_cache()
+            {
+                for (std::size_t i = 0; i != pool_num_size_classes; ++i)
+                    release_blocks(free_lists_[i], i);
+            }
+
+            free_block* free_lists_[pool_num_size_classes];
+            std::size_t counts_[pool_num_size_classes];
+
+            std::atomic<std::int64_t> allocations_;
+            std::atomic<std::int64_t> misses_;
+        };
+
+        // set once the registry has been destroyed, the pools must not be
+        // used anymore from this point on
+        std::atomic<bool> pools_destroyed(false);
+
+        ///////////////////////////////////////////////////////////////////////
+        // All thread pools ever created, this keeps the pools alive until the
+        // end of the program (threads which use native TLS can't rely on
+        // their thread local objects being destroyed). The pools of exited
+        // threads are reused by threads started later on, their unused
+        // blocks are handed over to the global pool.
+        struct pool_registry
+        {
+            pool_registry()
+            {
+                for (std::size_t i = 0; i != pool_num_size_classes; ++i)
+                {
+                    free_lists_[i] = nullptr;
+                    counts_[i].store(0, std::memory_order_relaxed);
+                }
+            }
+
+            ~pool_registry()
+            {
+                pools_destroyed.store(true);
+
+                for (std::size_t i = 0; i != pool_num_size_classes; ++i)
+                    release_blocks(free_lists_[i], i);
+            }
+
+            thread_pool_cache* create_pool()
+            {
+                {
+                    std::lock_guard<util::spinlock> l(mtx_);
+                    if (!unused_pools_.empty())
+                    {
+                        thread_pool_cache* pool = unused_pools_.back();
+                        unused_pools_.pop_back();
+                        return pool;
+                    }
+                }
+
+                std::unique_ptr<thread_pool_cache> pool(new thread_pool_cache);
+
+                std::lock_guard<util::spinlock> l(mtx_);
+                pools_.push_back(std::move(pool));
+                return pools_.back().get();
+            }
+
+            // hand the blocks of an exiting thread over to the global pool
+            void release_pool(thread_pool_cache* pool)
+            {
+                std::lock_guard<util::spinlock> l(mtx_);
+                for (std::size_t i = 0; i != pool_num_size_classes; ++i)
+                {
+                    free_block* block = pool->free_lists_[i];
+                    while (block != nullptr)
+                    {
+                        free_block* next = block->next_;
+                        if (counts_[i].load(std::memory_order_relaxed) <
+                            pool_max_global_blocks)
+                        {
+                            block->next_ = free_lists_[i];
+                            free_lists_[i] = block;
+                            counts_[i].fetch_add(1, std::memory_order_relaxed);
+                        }
+                        else
+                        {
+                            block->next_ = nullptr;
+                            release_blocks(block, i);
+                        }
+                        block = next;
+                    }
+
+                    pool->free_lists_[i] = nullptr;
+                    pool->counts_[i] = 0;
+                }
+                unused_pools_.push_back(pool);
+            }
+
+            // move up to half of the maximum number of cached blocks from
+            // the global pool to the pool of the calling thread
+            free_block* take_blocks(thread_pool_cache& pool,
+                std::size_t size_class)
+            {
+                if (counts_[size_class].load(std::memory_order_relaxed) == 0)
+                    return nullptr;
+
+                std::lock_guard<util::spinlock> l(mtx_);
+
+                free_block* first = free_lists_[size_class];
+                std::size_t count = 0;
+                free_block* last = nullptr;
+                for (free_block* block = first;
+                     block != nullptr && count != pool_max_cached_blocks / 2;
+                     block = block->next_)
+                {
+                    last = block;
+                    ++count;
+                }
+
+                if (last == nullptr)
+                    return nullptr;
+
+                free_lists_[size_class] = last->next_;
+                counts_[size_class].fetch_sub(
+                    count, std::memory_order_relaxed);
+
+                last->next_ = pool.free_lists_[size_class];
+                pool.free_lists_[size_class] = first->next_;
+                pool.counts_[size_class] += count - 1;
+
+                return first;
+            }
+
+            template <typename F>
+            std::int64_t accumulate(F && f)
+            {
+                std::int64_t result = 0;
+
+                std::lock_guard<util::spinlock> l(mtx_);
+                for (std::unique_ptr<thread_pool_cache>& pool : pools_)
+                    result += f(*pool);
+                return result;
+            }
+
+            util::spinlock mtx_;
+            std::vector<std::unique_ptr<thread_pool_cache> > pools_;
+            std::vector<thread_pool_cache*> unused_pools_;
+
+            // the global pool
+            free_block* free_lists_[pool_num_size_classes];
+            std::atomic<std::size_t> counts_[pool_num_size_classes];
+        };
+
+        pool_registry& get_pool_registry()
+        {
+            static pool_registry registry;
+            return registry;
+        }
+
+        static HPX_NATIVE_TLS thread_pool_cache* pool_cache_ = nullptr;
+
+        // Hands the pool of the calling thread back to the registry once
+        // the thread exits. This is a C++11 thread_local object as
+        // destructors are not supported for all kinds of native TLS.
+        struct pool_cache_release
+        {
+            ~pool_cache_release()
+            {
+                if (pool_cache_ != nullptr &&
+                    !pools_destroyed.load(std::memory_order_relaxed))
+                {
+                    get_pool_registry().release_pool(pool_cache_);
+                }
+                pool_cache_ = nullptr;
+            }
+        };
+
+        thread_local pool_cache_release release_pool_cache_;
+
+        // return the pool of the calling thread, returns nullptr during
+        // static destruction
+        thread_pool_cache* get_pool_cache()
+        {
+            if (HPX_UNLIKELY(pools_destroyed.load(std::memory_order_relaxed)))
+                return nullptr;
+
+            if (HPX_UNLIKELY(pool_cache_ == nullptr))
+            {
+                // make sure the pool is released on thread exit
+                static_cast<void>(&release_pool_cache_);
+                pool_cache_ = get_pool_registry().create_pool();
+            }
+
+            return pool_cache_;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void* pooled_allocate(std::size_t size)
+    {
+        if (size != 0 && size <= pool_max_block_size)
+        {
+            std::size_t const size_class = (size - 1) / pool_granularity;
+
+            thread_pool_cache* pool = get_pool_cache();
+            if (pool != nullptr)
+            {
+                free_block* block = pool->free_lists_[size_class];
+                if (block != nullptr)
+                {
+                    pool->free_lists_[size_class] = block->next_;
+                    --pool->counts_[size_class];
+
+                    pool->allocations_.fetch_add(1, std::memory_order_relaxed);
+                    return block;
+                }
+
+                // refill the pool from the blocks of exited threads
+                block = get_pool_registry().take_blocks(*pool, size_class);
+                if (block != nullptr)
+                {
+                    pool->allocations_.fetch_add(1, std::memory_order_relaxed);
+                    return block;
+                }
+                pool->misses_.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            // allocate a block of the full size class to allow reusing it
+            return internal_allocator<char>().allocate(
+                (size_class + 1) * pool_granularity);
+        }
+
+        return internal_allocator<char>().allocate(size);
+    }
+
+    void pooled_deallocate(void* p, std::size_t size) noexcept
+    {
+        if (p == nullptr)
+            return;
+
+        if (size != 0 && size <= pool_max_block_size)
+        {
+            std::size_t const size_class = (size - 1) / pool_granularity;
+
+            // blocks released by a thread other than the allocating one are
+            // kept by the releasing thread
+            thread_pool_cache* pool = get_pool_cache();
+            if (pool != nullptr &&
+                pool->counts_[size_class] < pool_max_cached_blocks)
+            {
+                free_block* block = static_cast<free_block*>(p);
+                block->next_ = pool->free_lists_[size_class];
+                pool->free_lists_[size_class] = block;
+                ++pool->counts_[size_class];
+                return;
+            }
+
+            internal_allocator<char>().deallocate(
+                static_cast<char*>(p), (size_class + 1) * pool_granularity);
+            return;
+        }
+
+        internal_allocator<char>().deallocate(static_cast<char*>(p), size);
+    }
+}}}
+
+namespace hpx { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    std::int64_t get_pooled_allocation_count(bool reset)
+    {
+        return detail::get_pool_registry().accumulate(
+            [reset](detail::thread_pool_cache& pool)
+            {
+                return util::get_and_reset_value(pool.allocations_, reset);
+            });
+    }
+
+    std::int64_t get_pooled_allocation_misses(bool reset)
+    {
+        return detail::get_pool_registry().accumulate(
+            [reset](detail::thread_pool_cache& pool)
+            {
+                return util::get_and_reset_value(pool.misses_, reset);
+            });
+    }
+}}
+
+#endif
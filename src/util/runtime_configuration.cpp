@@ -9,6 +9,7 @@
 #include <hpx/config/defaults.hpp>
 // TODO: move parcel ports into plugins
 #include <hpx/runtime/parcelset/parcelhandler.hpp>
+#include <hpx/runtime/threads/coroutines/detail/stack_pool.hpp>
 #include <hpx/util/assert.hpp>
 #include <hpx/util/detail/pp/expand.hpp>
 #include <hpx/util/detail/pp/stringize.hpp>
@@ -30,6 +31,7 @@
 #include <boost/tokenizer.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
@@ -234,6 +236,7 @@ namespace hpx { namespace util
                 HPX_PP_STRINGIZE(HPX_PP_EXPAND(HPX_HUGE_STACK_SIZE)) "}",
 #if defined(__linux) || defined(linux) || defined(__linux__) || defined(__FreeBSD__)
             "use_guard_pages = ${HPX_USE_GUARD_PAGES:1}",
+            "pool_size = ${HPX_STACK_POOL_SIZE:256}",
 #endif
 
             "[hpx.threadpools]",
@@ -253,14 +256,26 @@ namespace hpx { namespace util
             "[hpx.thread_queue]",
             "min_tasks_to_steal_pending = "
                 "${HPX_THREAD_QUEUE_MIN_TASKS_TO_STEAL_PENDING:0}",
+            "max_tasks_to_steal_pending = "
+                "${HPX_THREAD_QUEUE_MAX_TASKS_TO_STEAL_PENDING:1}",
             "min_tasks_to_steal_staged = "
                 "${HPX_THREAD_QUEUE_MIN_TASKS_TO_STEAL_STAGED:10}",
             "min_add_new_count = ${HPX_THREAD_QUEUE_MIN_ADD_NEW_COUNT:10}",
             "max_add_new_count = ${HPX_THREAD_QUEUE_MAX_ADD_NEW_COUNT:10}",
             "max_delete_count = ${HPX_THREAD_QUEUE_MAX_DELETE_COUNT:1000}",
+            "thread_cache_size = ${HPX_THREAD_QUEUE_THREAD_CACHE_SIZE:64}",
             "max_terminated_threads = ${HPX_SCHEDULER_MAX_TERMINATED_THREADS:"
               HPX_PP_STRINGIZE(HPX_PP_EXPAND(HPX_SCHEDULER_MAX_TERMINATED_THREADS)) "}",
 
+            "[hpx.scheduler]",
+            "affinity_hints = ${HPX_SCHEDULER_AFFINITY_HINTS:0}",
+            "affinity_max_queue_length = "
+                "${HPX_SCHEDULER_AFFINITY_MAX_QUEUE_LENGTH:16}",
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+            "idle_spin_count = ${HPX_SCHEDULER_IDLE_SPIN_COUNT:0}",
+            "idle_yield_count = ${HPX_SCHEDULER_IDLE_YIELD_COUNT:4}",
+#endif
+
             "[hpx.commandline]",
             // enable aliasing
             "aliasing = ${HPX_COMMANDLINE_ALIASING:1}",
@@ -521,6 +536,8 @@ namespace hpx { namespace util
 #if defined(__linux) || defined(linux) || defined(__linux__) || defined(__FreeBSD__)
         threads::coroutines::detail::posix::use_guard_pages =
             init_use_stack_guard_pages();
+        threads::coroutines::detail::posix::stack_pool_size.store(
+            init_stack_pool_size(), std::memory_order_relaxed);
 #endif
 #ifdef HPX_HAVE_VERIFY_LOCKS
         if (enable_lock_detection())
@@ -582,6 +599,8 @@ namespace hpx { namespace util
 #if defined(__linux) || defined(linux) || defined(__linux__) || defined(__FreeBSD__)
         threads::coroutines::detail::posix::use_guard_pages =
             init_use_stack_guard_pages();
+        threads::coroutines::detail::posix::stack_pool_size.store(
+            init_stack_pool_size(), std::memory_order_relaxed);
 #endif
 #ifdef HPX_HAVE_VERIFY_LOCKS
         if (enable_lock_detection())
@@ -958,6 +977,18 @@ namespace hpx { namespace util
         }
         return true;    // default is true
     }
+
+    std::size_t runtime_configuration::init_stack_pool_size() const
+    {
+        if (has_section("hpx")) {
+            util::section const* sec = get_section("hpx.stacks");
+            if (nullptr != sec) {
+                return hpx::util::get_entry_as<std::size_t>(
+                    *sec, "pool_size", "256");
+            }
+        }
+        return 256;     // default is 256
+    }
 #endif
 
     std::ptrdiff_t runtime_configuration::init_small_stack_size() const
@@ -1051,6 +1082,17 @@ namespace hpx { namespace util
         case threads::thread_stacksize_huge:
             return huge_stacksize;
 
+        case threads::thread_stacksize_nostack:
+            // stackless threads are supported by the Linux (x86) coroutine
+            // context only, everywhere else those use a small stack
+#if (defined(__linux) || defined(linux) || defined(__linux__)) && \
+    !defined(__bgq__) && !defined(__powerpc__) && \
+    !defined(HPX_HAVE_GENERIC_CONTEXT_COROUTINES)
+            return static_cast<std::ptrdiff_t>(threads::thread_stacksize_nostack);
+#else
+            break;
+#endif
+
         default:
         case threads::thread_stacksize_small:
             break;
@@ -0,0 +1,127 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the time needed to move a given number of values
+// from a single producer to a single consumer through the different local
+// channel types.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/iostreams.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/util/format.hpp>
+#include <hpx/util/high_resolution_timer.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+using boost::program_options::variables_map;
+using boost::program_options::options_description;
+using boost::program_options::value;
+
+using hpx::util::high_resolution_timer;
+
+using hpx::cout;
+using hpx::flush;
+
+///////////////////////////////////////////////////////////////////////////////
+// we use a global here to prevent the received values from being optimized
+// away
+std::uint64_t global_scratch = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Channel>
+void measure_channel(Channel c, std::string const& name,
+    char const* cdash_name, std::uint64_t count, bool csv)
+{
+    // start the clock
+    high_resolution_timer walltime;
+
+    hpx::future<void> producer = hpx::async(
+        [c, count]() mutable
+        {
+            for (std::uint64_t i = 0; i != count; ++i)
+                c.set(i);
+        });
+
+    for (std::uint64_t i = 0; i != count; ++i)
+        global_scratch += c.get(hpx::launch::sync);
+
+    producer.get();
+
+    // stop the clock
+    const double duration = walltime.elapsed();
+
+    if (csv)
+        hpx::util::format_to(cout,
+            "{1},{2},{3}\n",
+            name,
+            count,
+            duration) << flush;
+    else
+        hpx::util::format_to(cout,
+            "moved {1} values through {2} in {3} seconds\n",
+            count,
+            name,
+            duration) << flush;
+    // CDash graph plotting
+    hpx::util::print_cdash_timing(cdash_name, duration);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(
+    variables_map& vm
+    )
+{
+    {
+        const std::uint64_t count = vm["values"].as<std::uint64_t>();
+        const std::size_t capacity = vm["capacity"].as<std::size_t>();
+        const bool csv = vm.count("csv") != 0;
+
+        if (HPX_UNLIKELY(0 == count))
+            throw std::logic_error("error: count of 0 values specified\n");
+
+        measure_channel(hpx::lcos::local::channel<std::uint64_t>(),
+            "channel", "ChannelOverheadUnlimited", count, csv);
+        measure_channel(
+            hpx::lcos::local::bounded_channel<std::uint64_t>(capacity),
+            "bounded_channel", "ChannelOverheadBounded", count, csv);
+        measure_channel(
+            hpx::lcos::local::spsc_channel<std::uint64_t>(capacity),
+            "spsc_channel", "ChannelOverheadSPSC", count, csv);
+    }
+
+    hpx::finalize();
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(
+    int argc
+  , char* argv[]
+    )
+{
+    // Configure application-specific options.
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    cmdline.add_options()
+        ( "values"
+        , value<std::uint64_t>()->default_value(1000000)
+        , "number of values to move through each channel")
+
+        ( "capacity"
+        , value<std::size_t>()->default_value(1024)
+        , "capacity of the bounded channels")
+
+        ( "csv"
+        , "output results as csv (format: channel,count,duration)")
+        ;
+
+    // Initialize and run HPX.
+    return hpx::init(cmdline, argc, argv);
+}
@@ -38,8 +38,17 @@ create_tasks(std::size_t num_tasks, std::size_t delay)
     return tasks;
 }
 
+// wait for the given futures either using wait_all or using when_all
+void wait_chunk(std::vector<hpx::future<void> >& chunk, bool use_when_all)
+{
+    if (use_when_all)
+        hpx::when_all(chunk).get();
+    else
+        hpx::wait_all(chunk);
+}
+
 double wait_tasks(std::size_t num_samples, std::size_t num_tasks,
-    std::size_t num_chunks, std::size_t delay)
+    std::size_t num_chunks, std::size_t delay, bool use_when_all)
 {
     std::size_t num_chunk_tasks = ((num_tasks + num_chunks) / num_chunks) - 1;
     std::size_t last_num_chunk_tasks = num_tasks - (num_chunks - 1) * num_chunk_tasks;
@@ -63,15 +72,17 @@ double wait_tasks(std::size_t num_samples, std::size_t num_tasks,
         hpx::util::high_resolution_timer t;
         if (num_chunks == 1)
         {
-            hpx::wait_all(chunks[0]);
+            wait_chunk(chunks[0], use_when_all);
         }
         else
         {
             for (std::size_t c = 0; c != num_chunks; ++c)
             {
-                chunk_results.push_back(
-                    hpx::async([&chunks, c]() { hpx::wait_all(chunks[c]); })
-                );
+                chunk_results.push_back(hpx::async(
+                    [&chunks, c, use_when_all]()
+                    {
+                        wait_chunk(chunks[c], use_when_all);
+                    }));
             }
             hpx::wait_all(chunk_results);
         }
@@ -104,18 +115,11 @@ int hpx_main(boost::program_options::variables_map& vm)
     if (num_chunks == 0)
         num_chunks = 1;
 
-    // wait for all of the tasks sequentially
-    double elapsed_seq = wait_tasks(num_samples, num_tasks, 1, delay);
-
-    // wait of tasks in chunks
-    double elapsed_chunks = 0;
-    if (num_chunks != 1)
-        elapsed_chunks = wait_tasks(num_samples, num_tasks, num_chunks, delay);
-
     if (header)
     {
         hpx::cout
-            << "Tasks,Chunks,Delay[s],Total Walltime[s],Walltime per Task[s]"
+            << "Function,Tasks,Chunks,Delay[s],Total Walltime[s],"
+               "Walltime per Task[s]"
              << hpx::endl;
     }
 
@@ -123,19 +127,36 @@ int hpx_main(boost::program_options::variables_map& vm)
     std::string const chunks_str = hpx::util::format("{}", num_chunks);
     std::string const delay_str = hpx::util::format("{}", delay);
 
-    hpx::util::format_to(hpx::cout,
-        "{:10},{:10},{:10},{:10},{:10.12},{:10.12}\n",
-        tasks_str, std::string("1"), delay_str,
-        elapsed_seq, elapsed_seq / num_tasks) << hpx::endl;
-    hpx::util::print_cdash_timing("WaitAll", elapsed_seq / num_tasks);
-
-    if (num_chunks != 1)
+    for (bool use_when_all : {false, true})
     {
+        std::string const function_str =
+            use_when_all ? "when_all" : "wait_all";
+        std::string const timing_name = use_when_all ? "WhenAll" : "WaitAll";
+
+        // wait for all of the tasks sequentially
+        double elapsed_seq =
+            wait_tasks(num_samples, num_tasks, 1, delay, use_when_all);
+
         hpx::util::format_to(hpx::cout,
             "{:10},{:10},{:10},{:10},{:10.12},{:10.12}\n",
-            tasks_str, chunks_str, delay_str,
-            elapsed_chunks, elapsed_chunks / num_tasks) << hpx::endl;
-        hpx::util::print_cdash_timing("WaitAllChunks", elapsed_chunks / num_tasks);
+            function_str, tasks_str, std::string("1"), delay_str,
+            elapsed_seq, elapsed_seq / num_tasks) << hpx::endl;
+        hpx::util::print_cdash_timing(
+            timing_name.c_str(), elapsed_seq / num_tasks);
+
+        // wait of tasks in chunks
+        if (num_chunks != 1)
+        {
+            double elapsed_chunks = wait_tasks(
+                num_samples, num_tasks, num_chunks, delay, use_when_all);
+
+            hpx::util::format_to(hpx::cout,
+                "{:10},{:10},{:10},{:10},{:10.12},{:10.12}\n",
+                function_str, tasks_str, chunks_str, delay_str,
+                elapsed_chunks, elapsed_chunks / num_tasks) << hpx::endl;
+            hpx::util::print_cdash_timing(
+                (timing_name + "Chunks").c_str(), elapsed_chunks / num_tasks);
+        }
     }
     return hpx::finalize();
 }
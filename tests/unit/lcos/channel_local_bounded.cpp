@@ -0,0 +1,259 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/util/function.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define NUM_PRODUCERS 4
+#define NUM_ITEMS 10000
+#define BATCH_SIZE 16
+
+///////////////////////////////////////////////////////////////////////////////
+void try_set_get()
+{
+    hpx::lcos::local::bounded_channel<int> c(4);
+    HPX_TEST_EQ(c.capacity(), std::size_t(4));
+
+    for (int i = 0; i != 4; ++i)
+        HPX_TEST(c.try_set(i));
+    HPX_TEST(!c.try_set(4));            // the channel is full
+
+    for (int i = 0; i != 4; ++i)
+    {
+        int value = -1;
+        HPX_TEST(c.try_get(value));
+        HPX_TEST_EQ(value, i);
+    }
+
+    int value = -1;
+    HPX_TEST(!c.try_get(value));        // the channel is empty
+    HPX_TEST_EQ(value, -1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void backpressure()
+{
+    hpx::lcos::local::bounded_channel<std::string> c(2);
+
+    c.set(std::string("first"));
+    c.set(std::string("second"));
+
+    // the channel is full, the returned future becomes ready once the value
+    // was stored
+    hpx::future<void> f = c.set(hpx::launch::async, std::string("third"));
+
+    HPX_TEST_EQ(c.get(hpx::launch::sync), std::string("first"));
+    f.get();
+
+    HPX_TEST_EQ(c.get(hpx::launch::sync), std::string("second"));
+    HPX_TEST_EQ(c.get(hpx::launch::sync), std::string("third"));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void pending_requests()
+{
+    hpx::lcos::local::bounded_channel<int> c(2);
+
+    // the request is completed by the thread storing the value
+    hpx::future<int> f = c.get(hpx::launch::async);
+    HPX_TEST(!f.is_ready());
+
+    HPX_TEST(c.try_set(42));
+    HPX_TEST(f.is_ready());
+    HPX_TEST_EQ(f.get(), 42);
+
+    // the request is completed by the thread receiving a value
+    HPX_TEST(c.try_set(1));
+    HPX_TEST(c.try_set(2));
+
+    hpx::future<void> s = c.set(hpx::launch::async, 3);
+    HPX_TEST(!s.is_ready());
+
+    int value = 0;
+    HPX_TEST(c.try_get(value));
+    HPX_TEST_EQ(value, 1);
+    HPX_TEST(s.is_ready());
+    s.get();
+
+    // closing the channel fails the remaining requests
+    HPX_TEST_EQ(c.try_get_n(&value, 1), std::size_t(1));
+    HPX_TEST_EQ(c.try_get_n(&value, 1), std::size_t(1));
+    HPX_TEST_EQ(value, 3);
+
+    f = c.get(hpx::launch::async);
+    HPX_TEST(!f.is_ready());
+
+    c.close();
+    HPX_TEST(f.has_exception());
+}
+
+void generations_are_rejected()
+{
+    hpx::lcos::local::bounded_channel<int> c(2);
+
+    HPX_TEST(c.set(hpx::launch::async, 1, 1).has_exception());
+    HPX_TEST(c.get(hpx::launch::async, 1).has_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void produce(hpx::lcos::local::bounded_channel<int> c, int first)
+{
+    std::vector<int> values(BATCH_SIZE);
+    for (int i = 0; i < NUM_ITEMS; i += BATCH_SIZE)
+    {
+        std::iota(values.begin(), values.end(), first + i);
+        c.set_n(values.begin(), values.size());
+    }
+}
+
+void batch_set_get()
+{
+    hpx::lcos::local::bounded_channel<int> c(BATCH_SIZE);
+
+    std::vector<hpx::future<void> > producers;
+    for (int i = 0; i != NUM_PRODUCERS; ++i)
+        producers.push_back(hpx::async(&produce, c, i * NUM_ITEMS));
+
+    std::vector<int> received;
+    received.reserve(NUM_PRODUCERS * NUM_ITEMS);
+
+    std::size_t count = 0;
+    while (count != NUM_PRODUCERS * NUM_ITEMS)
+    {
+        count += c.get_n(std::back_inserter(received), BATCH_SIZE / 2);
+    }
+
+    hpx::wait_all(producers);
+
+    // every value was received exactly once
+    std::sort(received.begin(), received.end());
+    for (std::size_t i = 0; i != received.size(); ++i)
+        HPX_TEST_EQ(received[i], int(i));
+
+    int value = 0;
+    HPX_TEST(!c.try_get(value));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void close_channel()
+{
+    hpx::lcos::local::bounded_channel<int> c(8);
+
+    int values[] = { 1, 2, 3 };
+    HPX_TEST_EQ(c.try_set_n(values, 3), std::size_t(3));
+
+    c.close();
+    HPX_TEST(!c.try_set(4));
+
+    bool caught_exception = false;
+    try
+    {
+        c.set(4);
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    // the values stored before closing the channel can still be received
+    std::vector<int> received;
+    HPX_TEST_EQ(c.get_n(std::back_inserter(received), 4), std::size_t(3));
+    HPX_TEST_EQ(received.size(), std::size_t(3));
+
+    caught_exception = false;
+    try
+    {
+        c.get(hpx::launch::sync);
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// suspending requires an HPX thread, plain OS threads get an exception instead
+// of blocking forever
+bool throws_invalid_status(hpx::util::function_nonser<void()> const& f)
+{
+    bool caught_exception = false;
+    std::thread t([&]()
+    {
+        try
+        {
+            f();
+        }
+        catch (hpx::exception const& e)
+        {
+            caught_exception = e.get_error() == hpx::invalid_status;
+        }
+    });
+    t.join();
+    return caught_exception;
+}
+
+void os_thread_does_not_suspend()
+{
+    hpx::lcos::local::bounded_channel<int> c(2);
+
+    // the operations which don't have to wait succeed
+    int values[] = { 1, 2, 3 };
+    std::thread([&]()
+    {
+        c.set_n(values, 2);
+    }).join();
+
+    std::vector<int> received;
+    HPX_TEST(throws_invalid_status([&]()
+    {
+        c.set_n(values, 3);
+    }));
+    HPX_TEST(throws_invalid_status([&]()
+    {
+        c.get_n(std::back_inserter(received), 4);
+    }));
+
+    // the elements which could be transferred were not lost
+    HPX_TEST_EQ(received.size(), std::size_t(2));
+    HPX_TEST(!c.try_get(values[0]));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    try_set_get();
+    backpressure();
+    pending_requests();
+    generations_are_rejected();
+    batch_set_get();
+    close_channel();
+    os_thread_does_not_suspend();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
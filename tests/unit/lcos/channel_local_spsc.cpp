@@ -0,0 +1,136 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#define NUM_ITEMS 100000
+
+///////////////////////////////////////////////////////////////////////////////
+void try_set_get()
+{
+    hpx::lcos::local::spsc_channel<int> c(3);
+    HPX_TEST_EQ(c.capacity(), std::size_t(4));
+
+    for (int i = 0; i != 4; ++i)
+        HPX_TEST(c.try_set(i));
+    HPX_TEST(!c.try_set(4));            // the channel is full
+
+    for (int i = 0; i != 4; ++i)
+    {
+        int value = -1;
+        HPX_TEST(c.try_get(value));
+        HPX_TEST_EQ(value, i);
+    }
+
+    int value = -1;
+    HPX_TEST(!c.try_get(value));        // the channel is empty
+    HPX_TEST_EQ(value, -1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void produce(hpx::lcos::local::spsc_channel<int> c)
+{
+    for (int i = 0; i != NUM_ITEMS; ++i)
+        c.set(i);
+    c.close();
+}
+
+void ping_pong()
+{
+    // a small buffer makes both sides suspend frequently
+    hpx::lcos::local::spsc_channel<int> c(2);
+
+    hpx::future<void> producer = hpx::async(&produce, c);
+
+    for (int i = 0; i != NUM_ITEMS; ++i)
+        HPX_TEST_EQ(c.get(hpx::launch::sync), i);
+
+    producer.get();
+
+    hpx::error_code ec(hpx::lightweight);
+    c.get(hpx::launch::sync, ec);
+    HPX_TEST(ec);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void receive_send_channel()
+{
+    hpx::lcos::local::spsc_channel<std::string> c(4);
+
+    hpx::lcos::local::send_channel<std::string> send(c);
+    hpx::lcos::local::receive_channel<std::string> receive(c);
+
+    hpx::future<void> f = hpx::async(
+        [send]() mutable
+        {
+            send.set(std::string("first"));
+            send.set(std::string("second"));
+        });
+
+    HPX_TEST_EQ(receive.get(hpx::launch::sync), std::string("first"));
+    HPX_TEST_EQ(receive.get(hpx::launch::sync), std::string("second"));
+
+    f.get();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void close_channel()
+{
+    hpx::lcos::local::spsc_channel<int> c(4);
+
+    c.set(1);
+    c.set(2);
+    c.close();
+
+    HPX_TEST(!c.try_set(3));
+
+    bool caught_exception = false;
+    try
+    {
+        c.set(3);
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    // the values stored before closing the channel can still be received
+    HPX_TEST_EQ(c.get(hpx::launch::sync), 1);
+    HPX_TEST_EQ(c.get(hpx::launch::sync), 2);
+
+    hpx::error_code ec(hpx::lightweight);
+    c.get(hpx::launch::sync, ec);
+    HPX_TEST(ec);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    try_set_get();
+    ping_pong();
+    receive_send_channel();
+    close_channel();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,109 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that continuations launched with launch::adaptive are run inline
+// whenever possible and that long chains of such continuations don't
+// overflow the stack.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#define CHAIN_LENGTH 10000
+
+///////////////////////////////////////////////////////////////////////////////
+void test_adaptive_inline()
+{
+    hpx::lcos::local::promise<void> p;
+    hpx::threads::thread_id_type id = hpx::threads::invalid_thread_id;
+
+    hpx::future<void> f = p.get_future().then(hpx::launch::adaptive,
+        [&id](hpx::future<void> && f)
+        {
+            f.get();
+            id = hpx::threads::get_self_id();
+        });
+
+    // the continuation is run inline by the thread making the future ready
+    p.set_value();
+    f.get();
+
+#if HPX_CONTINUATION_MAX_INLINE_DEPTH > 1
+    HPX_TEST_EQ(id, hpx::threads::get_self_id());
+#else
+    HPX_TEST_NEQ(id, hpx::threads::invalid_thread_id);
+#endif
+}
+
+void test_adaptive_chain()
+{
+    hpx::lcos::local::promise<std::size_t> p;
+    hpx::future<std::size_t> f = p.get_future();
+
+    // the inline depth is bounded, thus this does not overflow the stack
+    for (std::size_t i = 0; i != CHAIN_LENGTH; ++i)
+    {
+        f = f.then(hpx::launch::adaptive,
+            [](hpx::future<std::size_t> && f)
+            {
+                return f.get() + 1;
+            });
+    }
+
+    p.set_value(0);
+    HPX_TEST_EQ(f.get(), std::size_t(CHAIN_LENGTH));
+}
+
+void test_adaptive_dataflow()
+{
+    hpx::lcos::local::promise<int> p1, p2;
+
+    hpx::future<int> f = hpx::dataflow(hpx::launch::adaptive,
+        [](hpx::future<int> && f1, hpx::future<int> && f2)
+        {
+            return f1.get() + f2.get();
+        },
+        p1.get_future(), p2.get_future());
+
+    p1.set_value(20);
+    p2.set_value(22);
+
+    HPX_TEST_EQ(f.get(), 42);
+}
+
+void test_adaptive_async()
+{
+    // hpx::async treats launch::adaptive as launch::async
+    hpx::future<int> f = hpx::async(hpx::launch::adaptive, []() { return 42; });
+    HPX_TEST_EQ(f.get(), 42);
+}
+
+int hpx_main()
+{
+    test_adaptive_inline();
+    test_adaptive_chain();
+    test_adaptive_dataflow();
+    test_adaptive_async();
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,124 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that continuations attached to a shared state concurrently with the
+// shared state becoming ready are invoked exactly once and in order, and that
+// no thread waiting for the shared state is missed.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#define NUM_ITERATIONS 1000
+#define NUM_CONTINUATIONS 8
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent_then()
+{
+    for (std::size_t i = 0; i != NUM_ITERATIONS; ++i)
+    {
+        hpx::lcos::local::promise<int> p;
+        hpx::shared_future<int> sf = p.get_future().share();
+
+        std::atomic<std::size_t> count(0);
+
+        // attach continuations while the value is being set concurrently
+        hpx::future<void> setter = hpx::async([&p]() { p.set_value(42); });
+
+        std::vector<hpx::future<void> > continuations;
+        continuations.reserve(NUM_CONTINUATIONS);
+        for (std::size_t j = 0; j != NUM_CONTINUATIONS; ++j)
+        {
+            continuations.push_back(sf.then(
+                [&count](hpx::shared_future<int> && f)
+                {
+                    HPX_TEST_EQ(f.get(), 42);
+                    ++count;
+                }));
+        }
+
+        setter.get();
+        hpx::wait_all(continuations);
+
+        HPX_TEST_EQ(count.load(), std::size_t(NUM_CONTINUATIONS));
+    }
+}
+
+void test_continuation_order()
+{
+    hpx::lcos::local::promise<void> p;
+    hpx::shared_future<void> sf = p.get_future().share();
+
+    std::vector<std::size_t> order;
+    std::vector<hpx::future<void> > continuations;
+    for (std::size_t j = 0; j != NUM_CONTINUATIONS; ++j)
+    {
+        continuations.push_back(sf.then(hpx::launch::sync,
+            [&order, j](hpx::shared_future<void> &&)
+            {
+                order.push_back(j);
+            }));
+    }
+
+    p.set_value();
+    hpx::wait_all(continuations);
+
+    // continuations are invoked in the order they have been registered
+    HPX_TEST_EQ(order.size(), std::size_t(NUM_CONTINUATIONS));
+    for (std::size_t j = 0; j != order.size(); ++j)
+    {
+        HPX_TEST_EQ(order[j], j);
+    }
+}
+
+void test_concurrent_wait()
+{
+    for (std::size_t i = 0; i != NUM_ITERATIONS; ++i)
+    {
+        hpx::lcos::local::promise<int> p;
+        hpx::shared_future<int> sf = p.get_future().share();
+
+        std::vector<hpx::future<int> > waiters;
+        waiters.reserve(NUM_CONTINUATIONS);
+        for (std::size_t j = 0; j != NUM_CONTINUATIONS; ++j)
+        {
+            waiters.push_back(hpx::async([sf]() { return sf.get(); }));
+        }
+
+        p.set_value(42);
+
+        for (hpx::future<int>& f : waiters)
+        {
+            HPX_TEST_EQ(f.get(), 42);
+        }
+    }
+}
+
+int hpx_main()
+{
+    test_concurrent_then();
+    test_continuation_order();
+    test_concurrent_wait();
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,135 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/lcos/local/detail/condition_variable.hpp>
+#include <hpx/lcos/local/mcs_spinlock.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/lcos/local/ticket_spinlock.hpp>
+#include <hpx/lcos/wait_all.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t const num_tasks = 64;
+std::size_t const num_iterations = 1000;
+
+template <typename Lock>
+void test_try_lock()
+{
+    Lock mtx;
+
+    HPX_TEST(mtx.try_lock());
+    HPX_TEST(!mtx.try_lock());
+    mtx.unlock();
+
+    {
+        std::unique_lock<Lock> l(mtx, std::try_to_lock);
+        HPX_TEST(l.owns_lock());
+        HPX_TEST(!mtx.try_lock());
+    }
+
+    HPX_TEST(mtx.try_lock());
+    mtx.unlock();
+}
+
+template <typename Lock>
+void test_mutual_exclusion()
+{
+    Lock mtx;
+    std::size_t counter = 0;     // deliberately not atomic
+
+    std::vector<hpx::future<void> > tasks;
+    tasks.reserve(num_tasks);
+
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(hpx::async(
+            [&]()
+            {
+                for (std::size_t j = 0; j != num_iterations; ++j)
+                {
+                    if (j % 2)
+                    {
+                        std::lock_guard<Lock> l(mtx);
+                        ++counter;
+                    }
+                    else
+                    {
+                        while (!mtx.try_lock())
+                            hpx::this_thread::yield();
+                        ++counter;
+                        mtx.unlock();
+                    }
+                }
+            }));
+    }
+
+    hpx::wait_all(tasks);
+
+    HPX_TEST_EQ(counter, num_tasks * num_iterations);
+}
+
+// the condition variable used by futures and channels accepts any of the
+// spinlocks
+template <typename Lock>
+void test_condition_variable()
+{
+    Lock mtx;
+    hpx::lcos::local::detail::condition_variable cond;
+    bool ready = false;
+
+    hpx::future<void> f = hpx::async(
+        [&]()
+        {
+            std::unique_lock<Lock> l(mtx);
+            while (!ready)
+                cond.wait(l, "test_condition_variable");
+        });
+
+    {
+        std::unique_lock<Lock> l(mtx);
+        ready = true;
+        cond.notify_all(std::move(l));
+    }
+
+    f.get();
+    HPX_TEST(ready);
+}
+
+template <typename Lock>
+void test_lock()
+{
+    test_try_lock<Lock>();
+    test_mutual_exclusion<Lock>();
+    test_condition_variable<Lock>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_lock<hpx::lcos::local::spinlock>();
+    test_lock<hpx::lcos::local::ticket_spinlock>();
+    test_lock<hpx::lcos::local::mcs_spinlock>();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,89 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/lcos/local/tree_barrier.hpp>
+#include <hpx/lcos/wait_all.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t const num_rounds = 100;
+
+// every thread checks that all threads have finished the previous round
+// before any thread starts the next one
+void test_tree_barrier(hpx::lcos::local::tree_barrier& b)
+{
+    std::size_t const num_threads = b.size();
+    std::atomic<std::size_t> arrived(0);
+
+    std::vector<hpx::future<void> > threads;
+    threads.reserve(num_threads);
+
+    for (std::size_t rank = 0; rank != num_threads; ++rank)
+    {
+        threads.push_back(hpx::async(
+            [&, rank]()
+            {
+                for (std::size_t round = 1; round <= num_rounds; ++round)
+                {
+                    ++arrived;
+                    b.wait(rank);
+                    HPX_TEST_LTE(round * num_threads, arrived.load());
+
+                    // make sure nobody enters the next round too early
+                    b.wait(rank);
+                    HPX_TEST_LTE(arrived.load(), (round + 1) * num_threads);
+                }
+            }));
+    }
+
+    hpx::wait_all(threads);
+
+    HPX_TEST_EQ(arrived.load(), num_rounds * num_threads);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    // topology based tree layout
+    {
+        hpx::lcos::local::tree_barrier b(1);
+        test_tree_barrier(b);
+    }
+    {
+        hpx::lcos::local::tree_barrier b(hpx::get_os_thread_count());
+        test_tree_barrier(b);
+    }
+    {
+        hpx::lcos::local::tree_barrier b(37);
+        test_tree_barrier(b);
+    }
+
+    // explicit fan-in, including incomplete nodes
+    for (std::size_t fan_in : {2, 3, 8, 64})
+    {
+        hpx::lcos::local::tree_barrier b(29, fan_in);
+        test_tree_barrier(b);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
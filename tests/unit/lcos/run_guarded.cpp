@@ -9,6 +9,7 @@
 #include <hpx/hpx_init.hpp>
 
 #include <atomic>
+#include <cstddef>
 #include <iostream>
 #include <memory>
 #include <string>
@@ -50,6 +51,60 @@ void check_()
     HPX_TEST(2*increments == i1 && 2*increments == i2);
 }
 
+// a guard which runs at most 4 queued tasks on the thread holding it
+std::size_t const max_combined = 4;
+hpx::lcos::local::guard l3(max_combined);
+int counter = 0;
+std::atomic<bool> inside(false);
+
+// the HPX thread each task ran on, thread ids are reused once a thread has
+// terminated, so every thread is tagged with a number of its own instead
+std::vector<std::size_t> runners;
+std::size_t next_runner = 0;
+
+void incr3() {
+    // implicitly lock l3
+    HPX_TEST(!inside.exchange(true));
+    ++counter;
+
+    hpx::threads::thread_id_type id = hpx::threads::get_self_id();
+    std::size_t runner = hpx::threads::get_thread_data(id);
+    if (runner == 0) {
+        runner = ++next_runner;
+        hpx::threads::set_thread_data(id, runner);
+    }
+    runners.push_back(runner);
+
+    inside.store(false);
+    // implicitly unlock l3
+}
+
+void check_combining()
+{
+    std::vector<hpx::future<void> > tasks;
+    for(int i=0;i<increments;i++) {
+        tasks.push_back(hpx::async([]() { run_guarded(l3,incr3); }));
+    }
+    hpx::wait_all(tasks);
+
+    // the queued tasks may still be running on a different thread
+    hpx::lcos::local::promise<void> p;
+    hpx::future<void> f = p.get_future();
+    run_guarded(l3,[&p]() { p.set_value(); });
+    f.get();
+
+    HPX_TEST_EQ(increments, counter);
+    HPX_TEST_EQ(runners.size(), std::size_t(increments));
+
+    // a thread runs the task it acquired the guard for and at most
+    // max_combined of the tasks queued in the meantime
+    std::size_t run = 0;
+    for (std::size_t i = 0; i != runners.size(); ++i) {
+        run = (i != 0 && runners[i] == runners[i-1]) ? run + 1 : 1;
+        HPX_TEST_LTE(run, max_combined + 1);
+    }
+}
+
 int hpx_main(boost::program_options::variables_map& vm) {
     if (vm.count("increments"))
         increments = vm["increments"].as<int>();
@@ -66,6 +121,9 @@ int hpx_main(boost::program_options::variables_map& vm) {
     }
 
     run_guarded(guards, &::check_);
+
+    check_combining();
+
     return hpx::finalize();
 }
 
@@ -0,0 +1,109 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/threads.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/thread/locks.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+typedef hpx::lcos::local::scalable_shared_mutex shared_mutex_type;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_try_lock()
+{
+    shared_mutex_type rw_mutex;
+
+    // any number of readers may hold the lock
+    HPX_TEST(rw_mutex.try_lock_shared());
+    HPX_TEST(rw_mutex.try_lock_shared());
+    HPX_TEST(!rw_mutex.try_lock());
+
+    rw_mutex.unlock_shared();
+    rw_mutex.unlock_shared();
+
+    // a writer excludes everybody else
+    HPX_TEST(rw_mutex.try_lock());
+    HPX_TEST(!rw_mutex.try_lock());
+    HPX_TEST(!rw_mutex.try_lock_shared());
+
+    rw_mutex.unlock();
+
+    HPX_TEST(rw_mutex.try_lock_shared());
+    rw_mutex.unlock_shared();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_readers_and_writers()
+{
+    int const num_tasks = 100;
+    int const num_iterations = 100;
+
+    shared_mutex_type rw_mutex;
+    std::atomic<int> readers(0);
+    std::atomic<int> writers(0);
+    int value = 0;
+
+    std::vector<hpx::future<void> > tasks;
+    for (int i = 0; i != num_tasks; ++i)
+    {
+        bool const writer = (i % 10) == 0;
+        tasks.push_back(hpx::async(
+            [&, writer]()
+            {
+                for (int j = 0; j != num_iterations; ++j)
+                {
+                    if (writer)
+                    {
+                        std::lock_guard<shared_mutex_type> l(rw_mutex);
+                        HPX_TEST_EQ(++writers, 1);
+                        HPX_TEST_EQ(readers.load(), 0);
+                        ++value;
+                        hpx::this_thread::yield();
+                        --writers;
+                    }
+                    else
+                    {
+                        boost::shared_lock<shared_mutex_type> l(rw_mutex);
+                        ++readers;
+                        HPX_TEST_EQ(writers.load(), 0);
+                        hpx::this_thread::yield();
+                        --readers;
+                    }
+                }
+            }));
+    }
+    hpx::wait_all(tasks);
+
+    HPX_TEST_EQ(value, (num_tasks / 10) * num_iterations);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_try_lock();
+    test_readers_and_writers();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
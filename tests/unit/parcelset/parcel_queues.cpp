@@ -0,0 +1,286 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test is meant to be run with the thread sanitizer enabled as well.
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/parcelset/detail/parcel_queues.hpp>
+#include <hpx/runtime/parcelset/locality.hpp>
+#include <hpx/runtime/parcelset/parcel.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using hpx::parcelset::detail::destination_queue;
+using hpx::parcelset::detail::parcel_queues;
+using hpx::parcelset::detail::parcel_write_handler_type;
+using hpx::parcelset::locality;
+using hpx::parcelset::parcel;
+
+///////////////////////////////////////////////////////////////////////////////
+// a destination which does not require a parcelport
+struct test_locality
+{
+    explicit test_locality(std::size_t id = std::size_t(-1))
+      : id_(id)
+    {}
+
+    static char const* type()
+    {
+        return "test";
+    }
+
+    explicit operator bool() const
+    {
+        return id_ != std::size_t(-1);
+    }
+
+    template <typename Archive>
+    void save(Archive& ar) const
+    {
+        ar << id_;
+    }
+
+    template <typename Archive>
+    void load(Archive& ar)
+    {
+        ar >> id_;
+    }
+
+    friend bool operator==(test_locality const& lhs, test_locality const& rhs)
+    {
+        return lhs.id_ == rhs.id_;
+    }
+
+    friend bool operator<(test_locality const& lhs, test_locality const& rhs)
+    {
+        return lhs.id_ < rhs.id_;
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, test_locality const& l)
+    {
+        return os << l.id_;
+    }
+
+    std::size_t id_;
+};
+
+locality make_locality(std::size_t id)
+{
+    return locality(test_locality(id));
+}
+
+// the parcels are told apart by their size
+parcel make_parcel(std::size_t id)
+{
+    parcel p;
+    p.size() = id;
+    return p;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_order()
+{
+    destination_queue q(make_locality(0));
+
+    parcel p;
+    parcel_write_handler_type f;
+    HPX_TEST(q.empty());
+    HPX_TEST(!q.dequeue(p, f));
+
+    std::size_t next = 0;
+    for (std::size_t i = 0; i != 4; ++i)
+    {
+        q.enqueue(make_parcel(next++), parcel_write_handler_type());
+    }
+
+    // taking a single parcel leaves the others in order, parcels enqueued
+    // in the meantime come after them
+    HPX_TEST(q.dequeue(p, f));
+    HPX_TEST_EQ(p.size(), std::size_t(0));
+
+    std::vector<parcel> parcels;
+    std::vector<parcel_write_handler_type> handlers;
+    for (std::size_t i = 0; i != 3; ++i)
+    {
+        parcels.push_back(make_parcel(next++));
+        handlers.push_back(parcel_write_handler_type());
+    }
+    q.enqueue(std::move(parcels), std::move(handlers));
+    q.enqueue(make_parcel(next++), parcel_write_handler_type());
+    HPX_TEST_EQ(q.size(), std::int64_t(7));
+
+    HPX_TEST(q.dequeue(p, f));
+    HPX_TEST_EQ(p.size(), std::size_t(1));
+
+    parcels.clear();
+    handlers.clear();
+    HPX_TEST(q.dequeue(parcels, handlers));
+    HPX_TEST_EQ(parcels.size(), std::size_t(6));
+    HPX_TEST_EQ(handlers.size(), std::size_t(6));
+    for (std::size_t i = 0; i != parcels.size(); ++i)
+    {
+        HPX_TEST_EQ(parcels[i].size(), i + 2);
+    }
+
+    HPX_TEST(q.empty());
+    HPX_TEST_EQ(q.size(), std::int64_t(0));
+    HPX_TEST(!q.dequeue(parcels, handlers));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t const num_producers = 8;
+std::size_t const num_consumers = 4;
+std::size_t const num_destinations = 16;
+std::size_t const num_parcels = 10000;
+
+std::size_t make_id(std::size_t producer, std::size_t seq)
+{
+    return producer * num_parcels + seq;
+}
+
+struct consumer
+{
+    consumer()
+      : last_(num_destinations * num_producers, std::size_t(-1))
+    {}
+
+    // the parcels of one producer for one destination have to be received
+    // in the order they were enqueued in
+    void received(std::size_t dest, std::size_t id,
+        std::vector<std::atomic<int> >& seen)
+    {
+        std::size_t const producer = id / num_parcels;
+        std::size_t const seq = id % num_parcels;
+
+        std::size_t& last = last_[dest * num_producers + producer];
+        HPX_TEST(last == std::size_t(-1) || last < seq);
+        last = seq;
+
+        HPX_TEST_EQ(++seen[id], 1);
+    }
+
+    std::vector<std::size_t> last_;
+};
+
+void test_stress()
+{
+    parcel_queues queues;
+
+    std::vector<std::atomic<int> > seen(num_producers * num_parcels);
+    for (std::atomic<int>& s : seen)
+        s.store(0);
+
+    std::atomic<std::size_t> received(0);
+    std::atomic<bool> done(false);
+
+    std::vector<std::thread> producers;
+    for (std::size_t t = 0; t != num_producers; ++t)
+    {
+        producers.emplace_back([&, t]()
+        {
+            std::size_t seq = 0;
+            for (std::size_t i = 0; seq != num_parcels; ++i)
+            {
+                // new destinations are added while others are looked up
+                destination_queue& q =
+                    queues.get(make_locality((i * 7 + t) % num_destinations));
+
+                if (i % 3 == 0 && seq + 2 <= num_parcels)
+                {
+                    std::vector<parcel> parcels;
+                    std::vector<parcel_write_handler_type> handlers(2);
+                    parcels.push_back(make_parcel(make_id(t, seq++)));
+                    parcels.push_back(make_parcel(make_id(t, seq++)));
+                    q.enqueue(std::move(parcels), std::move(handlers));
+                }
+                else
+                {
+                    q.enqueue(make_parcel(make_id(t, seq++)),
+                        parcel_write_handler_type());
+                }
+
+                if (i % 5 == 0)
+                    queues.set_ready(q);
+            }
+        });
+    }
+
+    std::vector<std::thread> consumers;
+    for (std::size_t c = 0; c != num_consumers; ++c)
+    {
+        consumers.emplace_back([&, c]()
+        {
+            consumer self;
+            while (!done.load() || queues.size() != 0)
+            {
+                std::vector<destination_queue*> ready;
+                queues.take_ready(ready);
+
+                // alternate between taking single parcels and all parcels
+                // of a destination
+                if (c % 2 == 0)
+                {
+                    locality dest;
+                    parcel p;
+                    parcel_write_handler_type f;
+                    while (queues.dequeue_any(dest, p, f))
+                    {
+                        self.received(dest.get<test_locality>().id_,
+                            p.size(), seen);
+                        ++received;
+                    }
+                    continue;
+                }
+
+                for (std::size_t d = 0; d != num_destinations; ++d)
+                {
+                    destination_queue* q = queues.find(make_locality(d));
+                    if (q == nullptr)
+                        continue;
+
+                    std::vector<parcel> parcels;
+                    std::vector<parcel_write_handler_type> handlers;
+                    if (!q->dequeue(parcels, handlers))
+                        continue;
+
+                    HPX_TEST_EQ(parcels.size(), handlers.size());
+                    for (parcel const& p : parcels)
+                    {
+                        self.received(d, p.size(), seen);
+                    }
+                    received += parcels.size();
+                }
+            }
+        });
+    }
+
+    for (std::thread& t : producers)
+        t.join();
+
+    done.store(true);
+
+    for (std::thread& t : consumers)
+        t.join();
+
+    HPX_TEST_EQ(received.load(), num_producers * num_parcels);
+    HPX_TEST_EQ(queues.size(), std::int64_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_order();
+    test_stress();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,192 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/parcel_coalescing.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/util/high_resolution_timer.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// the latency budget [us], the coalescing window never drops below a quarter
+// of it
+std::size_t const budget = 1000000;
+std::size_t const numparcels_default = 10;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Action, typename T>
+hpx::parcelset::parcel
+generate_parcel(hpx::id_type const& dest_id, hpx::id_type const& cont, T && data)
+{
+    hpx::naming::address addr;
+    hpx::naming::gid_type dest = dest_id.get_gid();
+    hpx::naming::detail::strip_credits_from_gid(dest);
+    hpx::parcelset::parcel p(hpx::parcelset::detail::create_parcel::call(
+        std::true_type(), std::move(dest), std::move(addr),
+        hpx::actions::typed_continuation<hpx::id_type>(cont),
+        Action(), hpx::threads::thread_priority_normal,
+        std::forward<T>(data)));
+
+    p.set_source_id(hpx::find_here());
+    p.size() = 4096;
+
+    return p;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+hpx::id_type test1(double)
+{
+    return hpx::find_here();
+}
+HPX_DECLARE_PLAIN_ACTION(test1, test1_action);
+HPX_ACTION_USES_MESSAGE_COALESCING(test1_action);
+HPX_PLAIN_ACTION(test1, test1_action);
+
+hpx::id_type test2(double)
+{
+    return hpx::find_here();
+}
+HPX_DECLARE_PLAIN_ACTION(test2, test2_action);
+HPX_ACTION_USES_MESSAGE_COALESCING(test2_action);
+HPX_PLAIN_ACTION(test2, test2_action);
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t get_counter(char const* name)
+{
+    using namespace hpx::performance_counters;
+
+    performance_counter c(name);
+    return c.get_value<std::int64_t>(hpx::launch::sync);
+}
+
+std::int64_t get_messages_count()
+{
+    return get_counter(
+            "/coalescing{locality#0/total}/count/messages@test1_action") +
+        get_counter(
+            "/coalescing{locality#0/total}/count/messages@test2_action");
+}
+
+// send the given number of parcels, optionally alternating between both
+// actions, as a single burst, return the time [s] until all of them were
+// delivered
+double send_parcels(hpx::id_type const& id, std::size_t count,
+    bool mixed_actions)
+{
+    std::vector<hpx::future<hpx::id_type> > results;
+    results.reserve(count);
+
+    std::vector<hpx::parcelset::parcel> parcels;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        hpx::lcos::promise<hpx::id_type> p;
+        results.push_back(p.get_future());
+
+        if (mixed_actions && (i % 2) != 0)
+        {
+            parcels.push_back(
+                generate_parcel<test2_action>(id, p.get_id(), 42.0));
+        }
+        else
+        {
+            parcels.push_back(
+                generate_parcel<test1_action>(id, p.get_id(), 42.0));
+        }
+    }
+
+    hpx::util::high_resolution_timer t;
+
+    hpx::get_runtime().get_parcel_handler().put_parcels(std::move(parcels));
+
+    // verify all messages got actually sent to the correct locality
+    hpx::wait_all(results);
+    double elapsed = t.elapsed();
+
+    for (hpx::future<hpx::id_type>& f : results)
+    {
+        HPX_TEST(f.get() == id);
+    }
+
+    return elapsed;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Without any history no further parcels are expected, a lone parcel has to
+// be sent right away instead of being held for the window.
+void test_early_flush(hpx::id_type const& id)
+{
+    std::int64_t messages = get_messages_count();
+
+    double elapsed = send_parcels(id, 1, false);
+    HPX_TEST_LT(elapsed, budget * 1e-6 / 4);
+
+    HPX_TEST_EQ(get_messages_count() - messages, std::int64_t(1));
+}
+
+// Parcels of a burst are expected to be followed by more parcels, they are
+// held for the window derived from the latency budget, which is at least a
+// quarter of the budget, but never longer than the budget.
+void test_window(hpx::id_type const& id)
+{
+    std::int64_t messages = get_messages_count();
+
+    double elapsed = send_parcels(id, numparcels_default, false);
+    HPX_TEST_LT(budget * 1e-6 / 4, elapsed);
+    HPX_TEST_LT(elapsed, 2 * budget * 1e-6);
+
+    HPX_TEST_LT(get_messages_count() - messages,
+        std::int64_t(numparcels_default));
+}
+
+// The parcels of both actions are coalesced into the same message.
+void test_cross_action(hpx::id_type const& id)
+{
+    std::int64_t messages = get_messages_count();
+
+    send_parcels(id, 2 * numparcels_default, true);
+
+    HPX_TEST_EQ(get_messages_count() - messages, std::int64_t(1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(int argc, char* argv[])
+{
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        test_early_flush(id);
+        test_window(id);
+        test_cross_action(id);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // explicitly enable message handlers (parcel coalescing), flushing from
+    // the background work would not let the parcels wait for the window
+    std::vector<std::string> const cfg = {
+        "hpx.parcel.message_handlers=1",
+        "hpx.plugins.coalescing_message_handler.adaptive=1",
+        "hpx.plugins.coalescing_message_handler.allow_background_flush=0",
+        "hpx.plugins.coalescing_message_handler.interval=" +
+            std::to_string(budget)
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,95 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/parcelset/detail/receive_buffer_pool.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+using hpx::parcelset::detail::receive_buffer_pool;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_reuse()
+{
+    receive_buffer_pool pool;
+
+    std::vector<char> buffer = pool.get(1000);
+    HPX_TEST_EQ(buffer.size(), std::size_t(1000));
+
+    char const* data = buffer.data();
+    pool.release(std::move(buffer));
+    HPX_TEST_LTE(std::size_t(1000), pool.retained_size());
+
+    // a smaller buffer is served from the retained one
+    buffer = pool.get(500);
+    HPX_TEST_EQ(buffer.size(), std::size_t(500));
+    HPX_TEST(buffer.data() == data);
+    HPX_TEST_EQ(pool.retained_size(), std::size_t(0));
+
+    // a larger one is not
+    pool.release(std::move(buffer));
+    buffer = pool.get(2000);
+    HPX_TEST_EQ(buffer.size(), std::size_t(2000));
+    HPX_TEST_LTE(std::size_t(1000), pool.retained_size());
+}
+
+void test_best_fit()
+{
+    receive_buffer_pool pool;
+
+    std::vector<char> small = pool.get(100);
+    std::vector<char> large = pool.get(10000);
+    char const* small_data = small.data();
+    char const* large_data = large.data();
+
+    pool.release(std::move(large));
+    pool.release(std::move(small));
+
+    std::vector<char> buffer = pool.get(50);
+    HPX_TEST(buffer.data() == small_data);
+
+    buffer = pool.get(5000);
+    HPX_TEST(buffer.data() == large_data);
+}
+
+void test_limits()
+{
+    std::size_t const max_buffer_size = receive_buffer_pool::max_buffer_size;
+    std::size_t const max_retained_size =
+        receive_buffer_pool::max_retained_size;
+
+    receive_buffer_pool pool;
+
+    // oversized buffers are released right away
+    pool.release(pool.get(max_buffer_size + 1));
+    HPX_TEST_EQ(pool.retained_size(), std::size_t(0));
+
+    // the overall size of the retained buffers is bounded
+    std::vector<std::vector<char> > buffers;
+    for (std::size_t i = 0; i != 2 * max_retained_size / max_buffer_size; ++i)
+    {
+        buffers.push_back(pool.get(max_buffer_size));
+    }
+    for (std::vector<char>& buffer : buffers)
+    {
+        pool.release(std::move(buffer));
+    }
+
+    HPX_TEST_LTE(pool.retained_size(), max_retained_size);
+    HPX_TEST_LTE(max_retained_size - max_buffer_size, pool.retained_size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_reuse();
+    test_best_fit();
+    test_limits();
+
+    return hpx::util::report_errors();
+}
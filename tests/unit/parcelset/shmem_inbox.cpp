@@ -0,0 +1,166 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/plugins/parcelport/shmem/inbox.hpp>
+#include <hpx/plugins/parcelport/shmem/receiver.hpp>
+#include <hpx/plugins/parcelport/shmem/segment.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using hpx::parcelset::policies::shmem::inbox;
+using hpx::parcelset::policies::shmem::receive_chunk;
+using hpx::parcelset::policies::shmem::segment;
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t const num_slots = 2;
+std::size_t const ring_size = 64;
+
+std::int32_t this_pid()
+{
+    return static_cast<std::int32_t>(::getpid());
+}
+
+std::vector<char> make_data(std::size_t size)
+{
+    std::vector<char> data(size);
+    for (std::size_t i = 0; i != size; ++i)
+        data[i] = static_cast<char>(i * 7 + 3);
+    return data;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Stream many times the size of the ring through one slot. The sizes of the
+// pieces written and read differ, this way both sides wrap around at all
+// positions of the ring.
+void test_wrap_around()
+{
+    inbox here;
+    here.create(this_pid(), num_slots, ring_size);
+
+    // the view of a sender
+    inbox there;
+    HPX_TEST(there.open(this_pid()));
+    HPX_TEST_EQ(there.num_slots(), num_slots);
+
+    std::size_t const slot = there.connect(this_pid());
+    HPX_TEST_NEQ(slot, std::size_t(inbox::npos));
+    HPX_TEST_EQ(here.state(slot), std::uint32_t(inbox::slot_connected));
+    HPX_TEST_EQ(here.sender_pid(slot), this_pid());
+
+    // a full ring does not accept any more data
+    std::vector<char> const sent = make_data(ring_size * 16 + 5);
+    HPX_TEST_EQ(there.write(slot, sent.data(), ring_size + 1), ring_size);
+    HPX_TEST_EQ(there.write(slot, sent.data(), 1), std::size_t(0));
+
+    std::vector<char> received(sent.size());
+    HPX_TEST_EQ(here.read(slot, received.data(), ring_size), ring_size);
+    HPX_TEST_EQ(here.read(slot, received.data(), 1), std::size_t(0));
+
+    std::size_t written = 0;
+    std::size_t read = 0;
+    while (read != sent.size())
+    {
+        written += there.write(slot, sent.data() + written,
+            (std::min)(std::size_t(23), sent.size() - written));
+        HPX_TEST(written - read <= ring_size);
+
+        read += here.read(slot, received.data() + read,
+            (std::min)(std::size_t(17), sent.size() - read));
+        HPX_TEST(read <= written);
+    }
+    HPX_TEST(sent == received);
+
+    // a closed slot is handed out again once it has been drained
+    there.disconnect(slot);
+    HPX_TEST(here.try_release(slot));
+    HPX_TEST_EQ(here.state(slot), std::uint32_t(inbox::slot_free));
+    HPX_TEST_EQ(there.connect(this_pid()), slot);
+
+    here.unlink();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Large chunks are handed over in a segment of their own which the receiver
+// maps directly.
+void test_segment_handover()
+{
+    std::string const name = inbox::chunk_name(this_pid(), 1);
+    std::vector<char> const data = make_data(3 * ring_size + 1);
+
+    // the sender unmaps the segment once the chunk has been copied
+    {
+        segment s;
+        s.create(name, data.size());
+        std::memcpy(s.data(), data.data(), data.size());
+    }
+
+    receive_chunk chunk;
+    HPX_TEST(chunk.map(name));
+    HPX_TEST_EQ(chunk.size(), data.size());
+    HPX_TEST(std::equal(data.begin(), data.end(), chunk.data()));
+
+    // the name of the segment is removed while it is mapped
+    segment again;
+    HPX_TEST(!again.open(name));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// The slots of senders which have terminated without disconnecting are
+// recognized and can be reclaimed.
+void test_dead_sender()
+{
+    pid_t const child = ::fork();
+    if (child == 0)
+        ::_exit(0);
+
+    HPX_TEST(child > 0);
+    HPX_TEST_EQ(::waitpid(child, nullptr, 0), child);
+
+    inbox here;
+    here.create(this_pid(), num_slots, ring_size);
+
+    inbox there;
+    HPX_TEST(there.open(this_pid()));
+
+    std::size_t const slot = there.connect(static_cast<std::int32_t>(child));
+    HPX_TEST_NEQ(slot, std::size_t(inbox::npos));
+    HPX_TEST_EQ(there.write(slot, "abc", 3), std::size_t(3));
+
+    HPX_TEST(!here.sender_alive(slot));
+    HPX_TEST(!here.try_release(slot));
+
+    here.reclaim(slot);
+    HPX_TEST_EQ(here.state(slot), std::uint32_t(inbox::slot_free));
+
+    std::size_t const next = there.connect(this_pid());
+    HPX_TEST_EQ(next, slot);
+    HPX_TEST(here.sender_alive(next));
+
+    char c = 0;
+    HPX_TEST_EQ(here.read(next, &c, 1), std::size_t(0));
+
+    here.unlink();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_wrap_around();
+    test_segment_handover();
+    test_dead_sender();
+
+    return hpx::util::report_errors();
+}
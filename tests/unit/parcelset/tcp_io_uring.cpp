@@ -0,0 +1,347 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/plugins/parcelport/tcp/io_uring.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/asio/error.hpp>
+#include <boost/system/error_code.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+using hpx::parcelset::policies::tcp::io_uring_service;
+
+///////////////////////////////////////////////////////////////////////////////
+// A connected pair of TCP sockets on the loopback interface.
+struct loopback_connection
+{
+    loopback_connection()
+      : client_(-1), server_(-1)
+    {
+        int const acceptor = ::socket(AF_INET, SOCK_STREAM, 0);
+        HPX_TEST(acceptor != -1);
+
+        sockaddr_in addr;
+        std::memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = 0;
+
+        socklen_t len = sizeof(addr);
+        HPX_TEST_EQ(::bind(acceptor,
+            reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), 0);
+        HPX_TEST_EQ(::listen(acceptor, 1), 0);
+        HPX_TEST_EQ(::getsockname(acceptor,
+            reinterpret_cast<sockaddr*>(&addr), &len), 0);
+
+        client_ = ::socket(AF_INET, SOCK_STREAM, 0);
+        HPX_TEST_EQ(::connect(client_,
+            reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), 0);
+        server_ = ::accept(acceptor, nullptr, nullptr);
+        HPX_TEST(server_ != -1);
+
+        ::close(acceptor);
+    }
+
+    ~loopback_connection()
+    {
+        ::close(client_);
+        ::close(server_);
+    }
+
+    int client_;
+    int server_;
+};
+
+std::vector<char> make_data(std::size_t size, std::size_t seed)
+{
+    std::vector<char> data(size);
+    for (std::size_t i = 0; i != size; ++i)
+        data[i] = static_cast<char>(i * 13 + seed);
+    return data;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Send a message through a registered buffer and receive it with a read
+// ahead into another registered buffer, the way small parcels are sent.
+void test_fixed_buffers(io_uring_service& s, loopback_connection& c)
+{
+    std::vector<char> const data = make_data(3000, 1);
+
+    io_uring_service::buffer out, in;
+    HPX_TEST(s.acquire_buffer(out));
+    HPX_TEST(s.acquire_buffer(in));
+    std::memcpy(out.data_, data.data(), data.size());
+
+    std::promise<std::size_t> written;
+    std::future<std::size_t> f = written.get_future();
+    s.async_write_fixed(c.client_, out, data.size(),
+        [&](boost::system::error_code const& ec, std::size_t n)
+        {
+            HPX_TEST(!ec);
+            written.set_value(n);
+        });
+    HPX_TEST_EQ(f.get(), data.size());
+
+    std::size_t received = 0;
+    while (received != data.size())
+    {
+        std::promise<std::size_t> read;
+        std::future<std::size_t> r = read.get_future();
+        s.async_read_some(c.server_, in, received,
+            [&](boost::system::error_code const& ec, std::size_t n)
+            {
+                HPX_TEST(!ec);
+                read.set_value(n);
+            });
+        std::size_t const n = r.get();
+        HPX_TEST(n != 0);
+        received += n;
+    }
+    HPX_TEST_EQ(std::memcmp(in.data_, data.data(), data.size()), 0);
+
+    s.release_buffer(out);
+    s.release_buffer(in);
+}
+
+// Send more data than the socket buffers hold, the transfers are completed
+// in several steps.
+void test_large_message(io_uring_service& s, loopback_connection& c)
+{
+    std::vector<char> const data = make_data(8 << 20, 2);
+    std::vector<char> received(data.size());
+
+    std::size_t const half = data.size() / 2;
+    std::vector<iovec> out(2);
+    out[0].iov_base = const_cast<char*>(data.data());
+    out[0].iov_len = half;
+    out[1].iov_base = const_cast<char*>(data.data()) + half;
+    out[1].iov_len = data.size() - half;
+
+    std::vector<iovec> in(1);
+    in[0].iov_base = received.data();
+    in[0].iov_len = received.size();
+
+    std::promise<std::size_t> written, read;
+    std::future<std::size_t> w = written.get_future();
+    std::future<std::size_t> r = read.get_future();
+    s.async_write(c.client_, std::move(out),
+        [&](boost::system::error_code const& ec, std::size_t n)
+        {
+            HPX_TEST(!ec);
+            written.set_value(n);
+        });
+    s.async_read(c.server_, std::move(in),
+        [&](boost::system::error_code const& ec, std::size_t n)
+        {
+            HPX_TEST(!ec);
+            read.set_value(n);
+        });
+
+    HPX_TEST_EQ(w.get(), data.size());
+    HPX_TEST_EQ(r.get(), data.size());
+    HPX_TEST(data == received);
+}
+
+// Queue many more operations than fit into the rings at once, the
+// remaining operations are submitted as the earlier ones complete.
+void test_many_operations(io_uring_service& s, loopback_connection& c)
+{
+    std::size_t const num_messages = 256;
+    std::size_t const message_size = 64;
+
+    std::vector<std::vector<char> > messages;
+    std::vector<std::promise<void> > written(num_messages);
+    std::vector<std::future<void> > done;
+    for (std::size_t i = 0; i != num_messages; ++i)
+    {
+        messages.push_back(make_data(message_size, i));
+
+        std::vector<iovec> out(1);
+        out[0].iov_base = messages.back().data();
+        out[0].iov_len = message_size;
+
+        std::promise<void>& p = written[i];
+        done.push_back(p.get_future());
+        s.async_write(c.client_, std::move(out),
+            [&p, message_size](boost::system::error_code const& ec,
+                std::size_t n)
+            {
+                HPX_TEST(!ec);
+                HPX_TEST_EQ(n, message_size);
+                p.set_value();
+            });
+    }
+
+    for (std::future<void>& f : done)
+        f.get();
+
+    std::vector<char> received(num_messages * message_size);
+    std::vector<iovec> in(1);
+    in[0].iov_base = received.data();
+    in[0].iov_len = received.size();
+
+    std::promise<std::size_t> read;
+    std::future<std::size_t> r = read.get_future();
+    s.async_read(c.server_, std::move(in),
+        [&](boost::system::error_code const& ec, std::size_t n)
+        {
+            HPX_TEST(!ec);
+            read.set_value(n);
+        });
+    HPX_TEST_EQ(r.get(), received.size());
+
+    for (std::size_t i = 0; i != num_messages; ++i)
+    {
+        HPX_TEST_EQ(std::memcmp(received.data() + i * message_size,
+            messages[i].data(), message_size), 0);
+    }
+}
+
+// Reads waiting on idle connections must not keep other operations from
+// being submitted, even if there are more of them than the completion queue
+// has entries (twice the number of submission queue entries).
+std::size_t const num_idle = 24;
+
+struct idle_read
+{
+    idle_read()
+      : data_(16)
+    {
+        buffer_.data_ = data_.data();
+        buffer_.size_ = data_.size();
+    }
+
+    loopback_connection c_;
+    std::vector<char> data_;
+    io_uring_service::buffer buffer_;
+    std::promise<boost::system::error_code> done_;
+};
+
+void start_idle_reads(io_uring_service& s,
+    std::vector<std::unique_ptr<idle_read> >& reads)
+{
+    for (std::size_t i = 0; i != num_idle; ++i)
+    {
+        reads.emplace_back(new idle_read);
+        idle_read& r = *reads.back();
+        s.async_read_some(r.c_.server_, r.buffer_, 0,
+            [&r](boost::system::error_code const& ec, std::size_t)
+            {
+                r.done_.set_value(ec);
+            });
+    }
+}
+
+void test_idle_reads(io_uring_service& s, loopback_connection& c)
+{
+    std::vector<std::unique_ptr<idle_read> > reads;
+    start_idle_reads(s, reads);
+
+    std::vector<char> const data = make_data(64, 3);
+    std::vector<iovec> out(1);
+    out[0].iov_base = const_cast<char*>(data.data());
+    out[0].iov_len = data.size();
+
+    std::promise<std::size_t> written;
+    std::future<std::size_t> w = written.get_future();
+    s.async_write(c.client_, std::move(out),
+        [&](boost::system::error_code const& ec, std::size_t n)
+        {
+            HPX_TEST(!ec);
+            written.set_value(n);
+        });
+    HPX_TEST_EQ(w.get(), data.size());
+
+    std::vector<char> received(data.size());
+    std::vector<iovec> in(1);
+    in[0].iov_base = received.data();
+    in[0].iov_len = received.size();
+
+    std::promise<std::size_t> read;
+    std::future<std::size_t> r = read.get_future();
+    s.async_read(c.server_, std::move(in),
+        [&](boost::system::error_code const& ec, std::size_t n)
+        {
+            HPX_TEST(!ec);
+            read.set_value(n);
+        });
+    HPX_TEST_EQ(r.get(), data.size());
+    HPX_TEST(data == received);
+
+    // let the idle reads complete
+    for (std::unique_ptr<idle_read>& p : reads)
+    {
+        char const byte = 42;
+        HPX_TEST_EQ(::write(p->c_.client_, &byte, 1), 1);
+        HPX_TEST(!p->done_.get_future().get());
+        HPX_TEST_EQ(p->data_[0], byte);
+    }
+}
+
+// Operations which have not completed when run() exits complete with
+// operation_aborted, so do operations started afterwards.
+void test_abort(io_uring_service& s, std::thread& t)
+{
+    std::vector<std::unique_ptr<idle_read> > reads;
+    start_idle_reads(s, reads);
+
+    s.stop();
+    t.join();
+
+    for (std::unique_ptr<idle_read>& p : reads)
+    {
+        HPX_TEST(p->done_.get_future().get() ==
+            boost::asio::error::operation_aborted);
+    }
+
+    idle_read late;
+    s.async_read_some(late.c_.server_, late.buffer_, 0,
+        [&late](boost::system::error_code const& ec, std::size_t)
+        {
+            late.done_.set_value(ec);
+        });
+    HPX_TEST(late.done_.get_future().get() ==
+        boost::asio::error::operation_aborted);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    // a small ring makes sure the submission and completion queues fill up
+    io_uring_service s;
+    if (!s.open(8, 4, 4096))
+    {
+        std::cout << "io_uring is not available, skipping the test\n";
+        return hpx::util::report_errors();
+    }
+
+    loopback_connection c;
+    std::thread t([&s]() { s.run(); });
+
+    test_fixed_buffers(s, c);
+    test_large_message(s, c);
+    test_many_operations(s, c);
+    test_idle_reads(s, c);
+    test_abort(s, t);
+
+    HPX_TEST(s.get_operation_count(false) != 0);
+
+    return hpx::util::report_errors();
+}
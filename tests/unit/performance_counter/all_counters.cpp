@@ -51,9 +51,20 @@ char const* const locality_pool_thread_counter_names[] =
     "/threads/count/pending-misses",
     "/threads/count/pending-accesses",
     "/threads/count/stolen-from-pending",
+    "/threads/count/stolen-from-pending-batches",
     "/threads/count/stolen-from-staged",
     "/threads/count/stolen-to-pending",
     "/threads/count/stolen-to-staged",
+#endif
+    "/threads/count/thread-cache-hits",
+    "/threads/count/thread-cache-misses",
+    "/threads/count/deadline-misses",
+    "/threads/count/affinity-hits",
+    "/threads/count/affinity-misses",
+#ifdef HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF
+    "/threads/count/idle-parks",
+    "/threads/count/idle-wakeups",
+    "/threads/time/idle-wake-latency",
 #endif
     nullptr
 };
@@ -76,8 +87,22 @@ char const* const locality_counter_names[] =
     "/threads/count/stack-recycles",
 #if !defined(HPX_WINDOWS) && !defined(HPX_HAVE_GENERIC_CONTEXT_COROUTINES)
     "/threads/count/stack-unbinds",
+#endif
+#if !defined(HPX_WINDOWS)
+    "/threads/count/stack-pool-hits",
+    "/threads/count/stack-pool-misses",
+    "/threads/count/stack-pool-resident-bytes",
 #endif
     "/scheduler/utilization/instantaneous",
+#if defined(HPX_HAVE_POOLED_ALLOCATOR)
+    "/runtime/count/pooled-allocations",
+    "/runtime/count/pooled-allocation-misses",
+#endif
+#if defined(HPX_HAVE_SPINLOCK_COUNTERS)
+    "/lcos/spinlock/count/acquisitions",
+    "/lcos/spinlock/count/contentions",
+    "/lcos/spinlock/time/spin",
+#endif
     nullptr
 };
 
@@ -129,6 +129,7 @@ int main(int argc, char* argv[])
                 hpx::resource::scheduling_policy::local,
                 hpx::resource::scheduling_policy::local_priority_fifo,
                 hpx::resource::scheduling_policy::local_priority_lifo,
+                hpx::resource::scheduling_policy::local_priority_chase_lev,
 #endif
 #if defined(HPX_HAVE_ABP_SCHEDULER)
                 hpx::resource::scheduling_policy::abp_priority_fifo,
@@ -136,6 +137,9 @@ int main(int argc, char* argv[])
 #endif
 #if defined(HPX_HAVE_SHARED_PRIORITY_SCHEDULER)
                 hpx::resource::scheduling_policy::shared_priority,
+#endif
+#if defined(HPX_HAVE_DEADLINE_SCHEDULER)
+                hpx::resource::scheduling_policy::deadline,
 #endif
             };
 
@@ -11,6 +11,7 @@
 #include <hpx/util/lightweight_test.hpp>
 #include <hpx/runtime/serialization/serialize_buffer.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 #include <vector>
@@ -128,6 +129,78 @@ void test_initialization_from_vector(std::size_t max_size)
     }
 }
 
+// Large buffers are used in place if the archive owns the memory of the
+// zero-copy chunks, otherwise they are copied.
+template <typename T>
+void test_load_in_place(std::size_t size)
+{
+    using namespace hpx::serialization;
+
+    serialize_buffer<T> send_buffer(size);
+    for (std::size_t i = 0; i != size; ++i)
+        send_buffer[i] = T(i);
+
+    std::vector<char> data;
+    std::vector<serialization_chunk> send_chunks;
+    {
+        output_archive archive(data, 0, &send_chunks);
+        archive << send_buffer;
+        archive.flush();
+    }
+
+    // emulate a parcelport which received the zero-copy chunks into
+    // memory of their own
+    std::shared_ptr<std::vector<std::vector<char> > > received =
+        std::make_shared<std::vector<std::vector<char> > >();
+    std::vector<serialization_chunk> chunks;
+    for (serialization_chunk const& c : send_chunks)
+    {
+        if (c.type_ == chunk_type_pointer)
+        {
+            char const* p = static_cast<char const*>(c.data_.cpos_);
+            received->emplace_back(p, p + c.size_);
+            chunks.push_back(
+                create_pointer_chunk(received->back().data(), c.size_));
+        }
+        else
+        {
+            chunks.push_back(c);
+        }
+    }
+
+    serialize_buffer<T> in_place;
+    {
+        input_archive archive(data, data.size(), &chunks, received);
+        archive >> in_place;
+    }
+
+    serialize_buffer<T> copied;
+    {
+        input_archive archive(data, data.size(), &chunks);
+        archive >> copied;
+    }
+
+    HPX_TEST_EQ(in_place.size(), size);
+    HPX_TEST_EQ(copied.size(), size);
+    HPX_TEST(std::equal(in_place.begin(), in_place.end(), send_buffer.begin()));
+    HPX_TEST(std::equal(copied.begin(), copied.end(), send_buffer.begin()));
+
+    if (!received->empty())
+    {
+        char const* p = received->back().data();
+        HPX_TEST(reinterpret_cast<char const*>(in_place.data()) == p);
+        HPX_TEST(reinterpret_cast<char const*>(copied.data()) != p);
+
+        // the received memory is kept alive by the buffer using it
+        std::weak_ptr<std::vector<std::vector<char> > > owner = received;
+        received.reset();
+        HPX_TEST(!owner.expired());
+
+        in_place = serialize_buffer<T>();
+        HPX_TEST(owner.expired());
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(int argc, char* argv[])
 {
@@ -151,6 +224,9 @@ int hpx_main(int argc, char* argv[])
         test_fixed_size_initialization_for_persistent_buffers<char>(size);
         test_fixed_size_initialization_for_persistent_buffers<float>(size);
         test_fixed_size_initialization_for_persistent_buffers<double>(size);
+
+        test_load_in_place<char>(size);
+        test_load_in_place<double>(size);
     }
 
     return hpx::finalize();
@@ -0,0 +1,112 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the deadline scheduler runs threads in the order of their
+// deadlines and that it keeps track of missed deadlines.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/parallel_executors.hpp>
+#include <hpx/include/resource_partitioner.hpp>
+#include <hpx/include/threadmanager.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#define NUM_DEADLINE_TASKS 100
+
+///////////////////////////////////////////////////////////////////////////////
+void test_earliest_deadline_first()
+{
+    typedef hpx::lcos::local::spinlock mutex_type;
+
+    mutex_type mtx;
+    std::vector<std::size_t> order;
+    order.reserve(NUM_DEADLINE_TASKS);
+
+    hpx::parallel::execution::parallel_executor exec;
+    std::chrono::steady_clock::time_point base =
+        std::chrono::steady_clock::now() + std::chrono::hours(1);
+
+    // The only worker thread is busy running this thread, thus all tasks are
+    // queued before any of them is run. Later tasks have earlier deadlines.
+    std::vector<hpx::future<void> > tasks;
+    tasks.reserve(NUM_DEADLINE_TASKS);
+    for (std::size_t i = 0; i != NUM_DEADLINE_TASKS; ++i)
+    {
+        std::chrono::steady_clock::time_point deadline =
+            base + std::chrono::milliseconds(NUM_DEADLINE_TASKS - i);
+
+        tasks.push_back(exec.with_deadline(deadline).async_execute(
+            [&mtx, &order, i]()
+            {
+                std::lock_guard<mutex_type> l(mtx);
+                order.push_back(i);
+            }));
+    }
+
+    hpx::wait_all(tasks);
+
+    HPX_TEST_EQ(order.size(), std::size_t(NUM_DEADLINE_TASKS));
+    for (std::size_t i = 0; i != order.size(); ++i)
+    {
+        HPX_TEST_EQ(order[i], NUM_DEADLINE_TASKS - i - 1);
+    }
+}
+
+void test_deadline_misses()
+{
+    hpx::threads::thread_pool_base& pool =
+        hpx::threads::get_thread_manager().default_pool();
+    pool.get_num_deadline_misses(std::size_t(-1), true);
+
+    hpx::parallel::execution::parallel_executor exec;
+    std::chrono::steady_clock::time_point deadline =
+        std::chrono::steady_clock::now();
+
+    std::vector<hpx::future<void> > tasks;
+    tasks.reserve(NUM_DEADLINE_TASKS);
+    for (std::size_t i = 0; i != NUM_DEADLINE_TASKS; ++i)
+    {
+        tasks.push_back(
+            exec.with_deadline(deadline).async_execute([]() {}));
+    }
+
+    hpx::wait_all(tasks);
+
+    HPX_TEST_EQ(pool.get_num_deadline_misses(std::size_t(-1), false),
+        std::int64_t(NUM_DEADLINE_TASKS));
+}
+
+int hpx_main(int argc, char* argv[])
+{
+    test_earliest_deadline_first();
+    test_deadline_misses();
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // A single worker thread makes the order of execution deterministic
+    std::vector<std::string> cfg = {
+        "hpx.os_threads=1"
+    };
+
+    hpx::resource::partitioner rp(argc, argv, std::move(cfg));
+    rp.create_thread_pool("default",
+        hpx::resource::scheduling_policy::deadline);
+
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,123 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/compat/thread.hpp>
+#include <hpx/util/bind.hpp>
+#include <hpx/util/lockfree/chase_lev_deque.hpp>
+
+#include <boost/program_options.hpp>
+
+#include <boost/detail/lightweight_test.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+namespace compat = hpx::compat;
+
+std::uint64_t threads = 2;
+std::uint64_t items = 500000;
+
+std::atomic<bool> done(false);
+std::vector<std::uint64_t> received;
+
+void thief_thread(boost::lockfree::chase_lev_deque<std::uint64_t>& q)
+{
+    std::vector<std::uint64_t> stolen;
+
+    std::uint64_t r = 0;
+    while (!done.load() || !q.empty())
+    {
+        if (q.steal(r))
+            stolen.push_back(r);
+    }
+
+    for (std::uint64_t i : stolen)
+        ++received[i];
+}
+
+int main(int argc, char** argv)
+{
+    using boost::program_options::variables_map;
+    using boost::program_options::options_description;
+    using boost::program_options::value;
+    using boost::program_options::store;
+    using boost::program_options::command_line_parser;
+    using boost::program_options::notify;
+
+    variables_map vm;
+
+    options_description
+        desc_cmdline("Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_cmdline.add_options()
+        ("help,h", "print out program usage (this message)")
+        ("threads,t", value<std::uint64_t>(&threads)->default_value(2),
+         "the number of thief threads stealing from the deque")
+        ("items,i", value<std::uint64_t>(&items)->default_value(500000),
+         "the number of items to push onto the deque")
+    ;
+
+    store(
+        command_line_parser(argc,
+            argv).options(desc_cmdline).allow_unregistered().run(),vm);
+
+    notify(vm);
+
+    // print help screen
+    if (vm.count("help"))
+    {
+        std::cout << desc_cmdline;
+        return boost::report_errors();
+    }
+
+    // the deque has to grow several times
+    boost::lockfree::chase_lev_deque<std::uint64_t> q(2);
+
+    std::vector<std::uint64_t> popped(items, 0);
+    received.resize(items, 0);
+
+    {
+        std::vector<compat::thread> tg;
+
+        for (std::uint64_t i = 0; i != threads; ++i)
+        {
+            tg.push_back(compat::thread(
+                hpx::util::bind(&thief_thread, std::ref(q))));
+        }
+
+        // the owner pushes all items and pops some of them back
+        std::uint64_t r = 0;
+        for (std::uint64_t i = 0; i != items; ++i)
+        {
+            q.push(i);
+            if (i % 3 == 0 && q.pop(r))
+                ++popped[r];
+        }
+
+        while (!q.empty())
+        {
+            if (q.pop(r))
+                ++popped[r];
+        }
+
+        done.store(true);
+
+        for (compat::thread& t : tg)
+        {
+            if (t.joinable())
+                t.join();
+        }
+    }
+
+    // every item has to be received exactly once
+    for (std::uint64_t i = 0; i != items; ++i)
+        BOOST_TEST_EQ(popped[i] + received[i], 1u);
+
+    return boost::report_errors();
+}
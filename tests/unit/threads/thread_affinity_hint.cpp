@@ -0,0 +1,82 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that resumed threads and continuations are scheduled back onto the
+// worker thread they (or their producer) ran on before.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/include/threadmanager.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#define NUM_CONTINUATIONS 100
+
+///////////////////////////////////////////////////////////////////////////////
+void test_self_affinity_hint()
+{
+    hpx::threads::thread_schedule_hint hint =
+        hpx::threads::get_self_affinity_hint();
+
+    HPX_TEST_EQ(hint.mode, hpx::threads::thread_schedule_hint_mode_affinity);
+    HPX_TEST_EQ(std::size_t(hint.hint), hpx::get_worker_thread_num());
+}
+
+void test_continuation_affinity()
+{
+    hpx::threads::thread_pool_base& pool =
+        hpx::threads::get_thread_manager().default_pool();
+    pool.get_affinity_hits(std::size_t(-1), true);
+    pool.get_affinity_misses(std::size_t(-1), true);
+
+    for (std::size_t i = 0; i != NUM_CONTINUATIONS; ++i)
+    {
+        hpx::lcos::local::promise<void> p;
+        hpx::future<void> f = p.get_future().then(hpx::launch::async,
+            [](hpx::future<void>&& f)
+            {
+                f.get();
+            });
+
+        // the continuation is scheduled onto the current worker thread
+        p.set_value();
+        f.get();
+    }
+
+    std::int64_t hits = pool.get_affinity_hits(std::size_t(-1), false);
+    std::int64_t misses = pool.get_affinity_misses(std::size_t(-1), false);
+
+    HPX_TEST_LTE(std::int64_t(NUM_CONTINUATIONS), hits + misses);
+    HPX_TEST_LT(misses, hits);
+}
+
+int hpx_main()
+{
+    test_self_affinity_hint();
+    test_continuation_affinity();
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores, resumed
+    // threads and continuations are given affinity hints
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all",
+        "hpx.scheduler.affinity_hints=1"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,115 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/threadmanager.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#define NUM_STACKLESS_THREADS 1000
+
+///////////////////////////////////////////////////////////////////////////////
+void register_stackless(hpx::util::unique_function_nonser<void()> f)
+{
+    hpx::threads::register_thread_nullary(std::move(f), "stackless",
+        hpx::threads::pending, true, hpx::threads::thread_priority_normal,
+        hpx::threads::thread_schedule_hint(),
+        hpx::threads::thread_stacksize_nostack);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_run_to_completion()
+{
+    std::vector<hpx::lcos::local::promise<void> > promises(
+        NUM_STACKLESS_THREADS);
+
+    std::vector<hpx::future<void> > finished;
+    finished.reserve(NUM_STACKLESS_THREADS);
+
+    for (hpx::lcos::local::promise<void>& p : promises)
+    {
+        finished.push_back(p.get_future());
+        register_stackless(
+            [&p]()
+            {
+                HPX_TEST(hpx::threads::get_self_ptr() != nullptr);
+                HPX_TEST(hpx::threads::get_self().is_stackless());
+                HPX_TEST_EQ(hpx::this_thread::get_stack_size(),
+                    hpx::threads::get_stack_size(
+                        hpx::threads::thread_stacksize_small));
+                p.set_value();
+            });
+    }
+
+    hpx::wait_all(finished);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_yield_is_converted()
+{
+    hpx::lcos::local::promise<bool> p;
+    hpx::future<bool> f = p.get_future();
+
+    register_stackless(
+        [&p]()
+        {
+            hpx::error_code ec(hpx::lightweight);
+            hpx::threads::thread_state_ex_enum statex =
+                hpx::this_thread::suspend(hpx::threads::pending,
+                    "test_yield_is_converted", ec);
+            p.set_value(!ec && statex == hpx::threads::wait_signaled);
+        });
+
+    HPX_TEST(f.get());
+}
+
+void test_suspension_is_rejected()
+{
+    hpx::lcos::local::promise<bool> p;
+    hpx::future<bool> f = p.get_future();
+
+    register_stackless(
+        [&p]()
+        {
+            hpx::error_code ec(hpx::lightweight);
+            hpx::this_thread::suspend(hpx::threads::suspended,
+                "test_suspension_is_rejected", ec);
+            p.set_value(ec && ec.value() == hpx::invalid_status);
+        });
+
+    HPX_TEST(f.get());
+}
+
+int hpx_main()
+{
+    // stackless threads are supported on some platforms only
+    if (hpx::threads::get_stack_size(hpx::threads::thread_stacksize_nostack) ==
+        hpx::threads::thread_stacksize_nostack)
+    {
+        test_run_to_completion();
+        test_yield_is_converted();
+        test_suspension_is_rejected();
+    }
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,137 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/util/lightweight_test.hpp>
+#include <hpx/util/pooled_allocator.hpp>
+#include <hpx/util/unique_function.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#define NUM_BLOCKS 32
+
+///////////////////////////////////////////////////////////////////////////////
+void pooled_blocks_are_reused()
+{
+    hpx::util::pooled_allocator<char> alloc;
+
+    std::vector<char*> blocks;
+    for (std::size_t i = 0; i != NUM_BLOCKS; ++i)
+        blocks.push_back(alloc.allocate(100));
+    for (char* p : blocks)
+        alloc.deallocate(p, 100);
+
+    hpx::util::get_pooled_allocation_count(true);
+    hpx::util::get_pooled_allocation_misses(true);
+
+    // all blocks are served from the pool of this thread now
+    std::vector<char*> reused;
+    for (std::size_t i = 0; i != NUM_BLOCKS; ++i)
+        reused.push_back(alloc.allocate(100));
+
+    HPX_TEST_EQ(hpx::util::get_pooled_allocation_count(false),
+        std::int64_t(NUM_BLOCKS));
+    HPX_TEST_EQ(hpx::util::get_pooled_allocation_misses(false),
+        std::int64_t(0));
+
+    for (char* p : reused)
+        alloc.deallocate(p, 100);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void blocks_of_exited_threads_are_reused()
+{
+    // the blocks cached by the thread are handed over to the global pool
+    // once it exits
+    std::thread t(
+        []()
+        {
+            hpx::util::pooled_allocator<char> alloc;
+
+            std::vector<char*> blocks;
+            for (std::size_t i = 0; i != NUM_BLOCKS; ++i)
+                blocks.push_back(alloc.allocate(500));
+            for (char* p : blocks)
+                alloc.deallocate(p, 500);
+        });
+    t.join();
+
+    hpx::util::get_pooled_allocation_count(true);
+    hpx::util::get_pooled_allocation_misses(true);
+
+    hpx::util::pooled_allocator<char> alloc;
+
+    std::vector<char*> reused;
+    for (std::size_t i = 0; i != NUM_BLOCKS; ++i)
+        reused.push_back(alloc.allocate(500));
+
+    HPX_TEST_EQ(hpx::util::get_pooled_allocation_count(false),
+        std::int64_t(NUM_BLOCKS));
+    HPX_TEST_EQ(hpx::util::get_pooled_allocation_misses(false),
+        std::int64_t(0));
+
+    for (char* p : reused)
+        alloc.deallocate(p, 500);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+struct alignas(64) overaligned
+{
+    char data_[100];
+};
+
+void overaligned_blocks()
+{
+    hpx::util::pooled_allocator<overaligned> alloc;
+
+    overaligned* p = alloc.allocate(1);
+    HPX_TEST_EQ(reinterpret_cast<std::uintptr_t>(p) % 64, std::uintptr_t(0));
+    alloc.deallocate(p, 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+struct large_function_object
+{
+    int operator()() const
+    {
+        return data_[0];
+    }
+
+    int data_[64];
+};
+
+void pooled_function_objects()
+{
+    large_function_object f;
+    f.data_[0] = 42;
+
+    hpx::util::get_pooled_allocation_count(true);
+
+    for (std::size_t i = 0; i != NUM_BLOCKS; ++i)
+    {
+        hpx::util::unique_function_nonser<int()> uf(f);
+        hpx::util::unique_function_nonser<int()> moved(std::move(uf));
+        HPX_TEST_EQ(moved(), 42);
+    }
+
+    // all but the first function object are served from the pool
+    HPX_TEST_LTE(std::int64_t(NUM_BLOCKS - 1),
+        hpx::util::get_pooled_allocation_count(false));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    pooled_blocks_are_reused();
+    blocks_of_exited_threads_are_reused();
+    overaligned_blocks();
+    pooled_function_objects();
+
+    return hpx::util::report_errors();
+}